@@ -1090,6 +1090,10 @@ class HermesRuntimeImpl final : public HermesRuntime,
   uint64_t getUniqueID(const jsi::Value &val) const override;
   jsi::Value getObjectForID(uint64_t id) override;
   const ::hermes::vm::GCExecTrace &getGCExecTrace() const override;
+  void compactHeap(double maxOccupancy) override;
+  void notifyIdle(uint32_t budgetInMs) override;
+  void notifyBusy() override;
+  void setMemoryPressure(double pressure) override;
   std::string getIOTrackingInfoJSON() override;
 #ifdef HERMESVM_PROFILER_BB
   void dumpBasicBlockProfileTrace(std::ostream &os) const override;
@@ -1363,6 +1367,22 @@ const ::hermes::vm::GCExecTrace &HermesRuntimeImpl::getGCExecTrace() const {
       ->runtime_.getGCExecTrace();
 }
 
+void HermesRuntimeImpl::compactHeap(double maxOccupancy) {
+  runtime_.getHeap().compact("compact", maxOccupancy);
+}
+
+void HermesRuntimeImpl::notifyIdle(uint32_t budgetInMs) {
+  runtime_.getHeap().notifyIdle(std::chrono::milliseconds(budgetInMs));
+}
+
+void HermesRuntimeImpl::notifyBusy() {
+  runtime_.getHeap().notifyBusy();
+}
+
+void HermesRuntimeImpl::setMemoryPressure(double pressure) {
+  runtime_.getHeap().setMemoryPressure(pressure);
+}
+
 std::string HermesRuntimeImpl::getIOTrackingInfoJSON() {
   std::string buf;
   llvh::raw_string_ostream strstrm(buf);
@@ -154,6 +154,29 @@ class HERMES_EXPORT HermesRuntime : public jsi::Runtime {
   /// non-deterministic execution.
   virtual const ::hermes::vm::GCExecTrace &getGCExecTrace() const = 0;
 
+  /// Collect garbage, then compact every part of the heap that is less than
+  /// \p maxOccupancy (between 0 and 1) full and return its memory to the OS.
+  /// This takes a full collection for each part that is compacted, so it is
+  /// best called while the application is idle, in long running processes
+  /// whose heap has become fragmented.
+  virtual void compactHeap(double maxOccupancy) = 0;
+
+  /// Tell the GC that the application expects to be idle for \p budgetInMs
+  /// milliseconds, for instance between two requests, so that it can do
+  /// collection work now instead of interrupting later execution. This also
+  /// ends a busy period started by notifyBusy.
+  virtual void notifyIdle(uint32_t budgetInMs) = 0;
+
+  /// Tell the GC that the application is busy until the next call to
+  /// notifyIdle, so that collection work that isn't needed yet is deferred.
+  virtual void notifyBusy() = 0;
+
+  /// Tell the GC how much memory pressure the process is under, from 0 (none)
+  /// to 1 (critical), e.g. derived from the cgroup's memory.pressure stall
+  /// information. Under pressure the heap is kept smaller and empty segments
+  /// are returned to the OS; it can grow again once the pressure is lowered.
+  virtual void setMemoryPressure(double pressure) = 0;
+
   /// Get IO tracking (aka HBC page access) info as a JSON string.
   /// See hermes::vm::Runtime::getIOTrackingInfoJSON() for conditions
   /// needed for there to be useful output.
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libcompileJS.a"
+  "libcompileJS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compileJS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
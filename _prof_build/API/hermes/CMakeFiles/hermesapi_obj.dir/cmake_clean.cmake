@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesapi_obj.dir/AsyncDebuggerAPI.cpp.o"
+  "CMakeFiles/hermesapi_obj.dir/AsyncDebuggerAPI.cpp.o.d"
+  "CMakeFiles/hermesapi_obj.dir/DebuggerAPI.cpp.o"
+  "CMakeFiles/hermesapi_obj.dir/DebuggerAPI.cpp.o.d"
+  "CMakeFiles/hermesapi_obj.dir/RuntimeTaskRunner.cpp.o"
+  "CMakeFiles/hermesapi_obj.dir/RuntimeTaskRunner.cpp.o.d"
+  "CMakeFiles/hermesapi_obj.dir/hermes.cpp.o"
+  "CMakeFiles/hermesapi_obj.dir/hermes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesapi_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
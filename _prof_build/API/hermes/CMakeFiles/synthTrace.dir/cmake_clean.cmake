@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libsynthTrace.a"
+  "libsynthTrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
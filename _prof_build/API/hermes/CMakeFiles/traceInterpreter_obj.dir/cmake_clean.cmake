@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceInterpreter_obj.dir/TraceInterpreter.cpp.o"
+  "CMakeFiles/traceInterpreter_obj.dir/TraceInterpreter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traceInterpreter_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
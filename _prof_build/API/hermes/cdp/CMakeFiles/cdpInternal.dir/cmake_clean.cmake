@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libcdpInternal.a"
+  "libcdpInternal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdpInternal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cdpInternal_obj.dir/ConsoleMessage.cpp.o"
+  "CMakeFiles/cdpInternal_obj.dir/ConsoleMessage.cpp.o.d"
+  "CMakeFiles/cdpInternal_obj.dir/DomainState.cpp.o"
+  "CMakeFiles/cdpInternal_obj.dir/DomainState.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cdpInternal_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/API/hermes_abi/HermesABIRuntimeWrapper.cpp" "API/hermes_abi/CMakeFiles/hermesABIRuntimeWrapper.dir/HermesABIRuntimeWrapper.cpp.o" "gcc" "API/hermes_abi/CMakeFiles/hermesABIRuntimeWrapper.dir/HermesABIRuntimeWrapper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/public/hermes/Public/CMakeFiles/hermesPublic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
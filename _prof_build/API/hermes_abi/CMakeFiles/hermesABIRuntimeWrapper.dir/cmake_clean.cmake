@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesABIRuntimeWrapper.dir/HermesABIRuntimeWrapper.cpp.o"
+  "CMakeFiles/hermesABIRuntimeWrapper.dir/HermesABIRuntimeWrapper.cpp.o.d"
+  "libhermesABIRuntimeWrapper.a"
+  "libhermesABIRuntimeWrapper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesABIRuntimeWrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
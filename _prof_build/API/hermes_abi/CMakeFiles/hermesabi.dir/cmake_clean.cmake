@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesabi.dir/c_compat.c.o"
+  "CMakeFiles/hermesabi.dir/c_compat.c.o.d"
+  "CMakeFiles/hermesabi.dir/hermes_vtable.cpp.o"
+  "CMakeFiles/hermesabi.dir/hermes_vtable.cpp.o.d"
+  "libhermesabi.a"
+  "libhermesabi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/hermesabi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
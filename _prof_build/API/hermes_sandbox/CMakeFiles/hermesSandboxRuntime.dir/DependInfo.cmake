@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_0.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_0.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_0.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_1.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_1.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_1.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_2.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_2.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_2.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_3.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_3.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_3.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_4.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_4.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_4.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_5.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_5.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_5.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_6.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_6.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_6.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/hermes_sandbox_impl_compiled_7.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_7.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_7.c.o.d"
+  "/root/repo/API/hermes_sandbox/external/wasm-rt-impl.c" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/wasm-rt-impl.c.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/external/wasm-rt-impl.c.o.d"
+  "/root/repo/API/hermes_sandbox/HermesSandboxRuntime.cpp" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/HermesSandboxRuntime.cpp.o" "gcc" "API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/HermesSandboxRuntime.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/public/hermes/Public/CMakeFiles/hermesPublic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSandboxRuntime.dir/HermesSandboxRuntime.cpp.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/HermesSandboxRuntime.cpp.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_0.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_0.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_1.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_1.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_2.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_2.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_3.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_3.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_4.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_4.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_5.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_5.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_6.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_6.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_7.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/hermes_sandbox_impl_compiled_7.c.o.d"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/wasm-rt-impl.c.o"
+  "CMakeFiles/hermesSandboxRuntime.dir/external/wasm-rt-impl.c.o.d"
+  "libhermesSandboxRuntime.a"
+  "libhermesSandboxRuntime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/hermesSandboxRuntime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
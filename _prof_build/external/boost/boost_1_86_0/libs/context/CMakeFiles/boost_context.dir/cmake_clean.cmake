@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libboost_context.a"
+  "libboost_context.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM CXX)
+  include(CMakeFiles/boost_context.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
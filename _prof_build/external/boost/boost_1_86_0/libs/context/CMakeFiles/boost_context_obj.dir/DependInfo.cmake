@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/external/boost/boost_1_86_0/libs/context/src/asm/jump_x86_64_sysv_elf_gas.S" "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context_obj.dir/src/asm/jump_x86_64_sysv_elf_gas.S.o"
+  "/root/repo/external/boost/boost_1_86_0/libs/context/src/asm/make_x86_64_sysv_elf_gas.S" "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context_obj.dir/src/asm/make_x86_64_sysv_elf_gas.S.o"
+  "/root/repo/external/boost/boost_1_86_0/libs/context/src/asm/ontop_x86_64_sysv_elf_gas.S" "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context_obj.dir/src/asm/ontop_x86_64_sysv_elf_gas.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "HERMESVM_ALLOW_CONCURRENT_GC"
+  "HERMESVM_ALLOW_INLINE_ASM"
+  "HERMESVM_GC_HADES"
+  "HERMESVM_INDIRECT_THREADING"
+  "HERMESVM_LOG_HEAP_SEGMENT_SIZE=22"
+  "HERMESVM_PROFILER_OPCODE"
+  "HERMES_CHECK_NATIVE_STACK"
+  "HERMES_ENABLE_UNICODE_REGEXP_PROPERTY_ESCAPES"
+  "HERMES_RELEASE_VERSION=\"0.12.0\""
+  "HERMES_USE_BOOST_CONTEXT=1"
+  "STATIC_HERMES"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "/root/repo/external"
+  "/root/repo/include"
+  "include"
+  "lib/config"
+  "/usr/include"
+  "/root/repo/external/llvh/include"
+  "/root/repo/external/llvh/gen/include"
+  "external/llvh/include"
+  "/root/repo/external/boost/boost_1_86_0"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/boost/boost_1_86_0/libs/context/src/posix/stack_traits.cpp" "external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context_obj.dir/src/posix/stack_traits.cpp.o" "gcc" "external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context_obj.dir/src/posix/stack_traits.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boost_context_obj.dir/src/asm/jump_x86_64_sysv_elf_gas.S.o"
+  "CMakeFiles/boost_context_obj.dir/src/asm/make_x86_64_sysv_elf_gas.S.o"
+  "CMakeFiles/boost_context_obj.dir/src/asm/ontop_x86_64_sysv_elf_gas.S.o"
+  "CMakeFiles/boost_context_obj.dir/src/posix/stack_traits.cpp.o"
+  "CMakeFiles/boost_context_obj.dir/src/posix/stack_traits.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM CXX)
+  include(CMakeFiles/boost_context_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/dtoa/dtoa.c" "external/dtoa/CMakeFiles/dtoa_obj.dir/dtoa.c.o" "gcc" "external/dtoa/CMakeFiles/dtoa_obj.dir/dtoa.c.o.d"
+  "/root/repo/external/dtoa/g_fmt.c" "external/dtoa/CMakeFiles/dtoa_obj.dir/g_fmt.c.o" "gcc" "external/dtoa/CMakeFiles/dtoa_obj.dir/g_fmt.c.o.d"
+  "/root/repo/external/dtoa/locks.cpp" "external/dtoa/CMakeFiles/dtoa_obj.dir/locks.cpp.o" "gcc" "external/dtoa/CMakeFiles/dtoa_obj.dir/locks.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtoa_obj.dir/dtoa.c.o"
+  "CMakeFiles/dtoa_obj.dir/dtoa.c.o.d"
+  "CMakeFiles/dtoa_obj.dir/g_fmt.c.o"
+  "CMakeFiles/dtoa_obj.dir/g_fmt.c.o.d"
+  "CMakeFiles/dtoa_obj.dir/locks.cpp.o"
+  "CMakeFiles/dtoa_obj.dir/locks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dtoa_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LLVHDemangle_obj.dir/ItaniumDemangle.cpp.o"
+  "CMakeFiles/LLVHDemangle_obj.dir/ItaniumDemangle.cpp.o.d"
+  "CMakeFiles/LLVHDemangle_obj.dir/MicrosoftDemangle.cpp.o"
+  "CMakeFiles/LLVHDemangle_obj.dir/MicrosoftDemangle.cpp.o.d"
+  "CMakeFiles/LLVHDemangle_obj.dir/MicrosoftDemangleNodes.cpp.o"
+  "CMakeFiles/LLVHDemangle_obj.dir/MicrosoftDemangleNodes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LLVHDemangle_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
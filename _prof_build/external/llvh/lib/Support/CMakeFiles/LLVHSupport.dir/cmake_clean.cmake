@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libLLVHSupport.a"
+  "libLLVHSupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/LLVHSupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
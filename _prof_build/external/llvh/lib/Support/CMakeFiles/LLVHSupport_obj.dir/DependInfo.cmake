@@ -0,0 +1,76 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/llvh/lib/Support/regcomp.c" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regcomp.c.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regcomp.c.o.d"
+  "/root/repo/external/llvh/lib/Support/regerror.c" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regerror.c.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regerror.c.o.d"
+  "/root/repo/external/llvh/lib/Support/regexec.c" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regexec.c.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regexec.c.o.d"
+  "/root/repo/external/llvh/lib/Support/regfree.c" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regfree.c.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regfree.c.o.d"
+  "/root/repo/external/llvh/lib/Support/regstrlcpy.c" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regstrlcpy.c.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/regstrlcpy.c.o.d"
+  "/root/repo/external/llvh/lib/Support/APFloat.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/APFloat.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/APFloat.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/APInt.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/APInt.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/APInt.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/CommandLine.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/CommandLine.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/CommandLine.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/ConvertUTF.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ConvertUTF.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ConvertUTF.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/ConvertUTFWrapper.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ConvertUTFWrapper.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ConvertUTFWrapper.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Debug.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Debug.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Debug.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Errno.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Errno.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Errno.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Error.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Error.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Error.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/ErrorHandling.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ErrorHandling.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ErrorHandling.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/FileCheck.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FileCheck.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FileCheck.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/FoldingSet.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FoldingSet.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FoldingSet.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/FormatVariadic.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FormatVariadic.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/FormatVariadic.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/GraphWriter.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/GraphWriter.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/GraphWriter.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Hashing.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Hashing.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Hashing.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Host.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Host.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Host.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/InitLLVM.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/InitLLVM.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/InitLLVM.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/JSON.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/JSON.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/JSON.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/LineIterator.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/LineIterator.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/LineIterator.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Locale.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Locale.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Locale.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/MD5.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/MD5.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/MD5.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/ManagedStatic.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ManagedStatic.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ManagedStatic.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Memory.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Memory.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Memory.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/MemoryBuffer.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/MemoryBuffer.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/MemoryBuffer.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Mutex.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Mutex.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Mutex.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/NativeFormatting.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/NativeFormatting.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/NativeFormatting.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Path.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Path.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Path.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/PrettyStackTrace.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/PrettyStackTrace.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/PrettyStackTrace.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Process.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Process.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Process.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Program.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Program.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Program.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Regex.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Regex.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Regex.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/SHA1.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SHA1.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SHA1.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Signals.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Signals.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Signals.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/SmallPtrSet.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SmallPtrSet.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SmallPtrSet.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/SmallVector.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SmallVector.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SmallVector.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/SourceMgr.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SourceMgr.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/SourceMgr.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Statistic.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Statistic.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Statistic.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/StringExtras.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringExtras.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringExtras.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/StringMap.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringMap.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringMap.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/StringRef.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringRef.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringRef.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/StringSaver.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringSaver.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/StringSaver.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/TargetParser.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/TargetParser.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/TargetParser.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Threading.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Threading.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Threading.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Timer.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Timer.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Timer.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/ToolOutputFile.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ToolOutputFile.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/ToolOutputFile.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Triple.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Triple.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Triple.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Twine.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Twine.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Twine.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Unicode.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Unicode.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Unicode.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Valgrind.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Valgrind.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Valgrind.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/Watchdog.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Watchdog.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/Watchdog.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/WithColor.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/WithColor.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/WithColor.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/circular_raw_ostream.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/circular_raw_ostream.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/circular_raw_ostream.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/raw_os_ostream.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/raw_os_ostream.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/raw_os_ostream.cpp.o.d"
+  "/root/repo/external/llvh/lib/Support/raw_ostream.cpp" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/raw_ostream.cpp.o" "gcc" "external/llvh/lib/Support/CMakeFiles/LLVHSupport_obj.dir/raw_ostream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
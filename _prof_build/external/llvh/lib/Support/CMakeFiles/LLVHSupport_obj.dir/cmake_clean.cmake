@@ -0,0 +1,123 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LLVHSupport_obj.dir/APFloat.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/APFloat.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/APInt.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/APInt.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/CommandLine.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/CommandLine.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/ConvertUTF.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/ConvertUTF.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/ConvertUTFWrapper.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/ConvertUTFWrapper.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Debug.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Debug.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Errno.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Errno.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Error.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Error.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/ErrorHandling.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/FileCheck.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/FileCheck.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/FoldingSet.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/FoldingSet.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/FormatVariadic.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/FormatVariadic.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/GraphWriter.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/GraphWriter.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Hashing.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Hashing.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Host.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Host.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/InitLLVM.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/InitLLVM.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/JSON.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/JSON.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/LineIterator.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/LineIterator.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Locale.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Locale.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/MD5.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/MD5.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/ManagedStatic.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/ManagedStatic.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Memory.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Memory.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/MemoryBuffer.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/MemoryBuffer.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Mutex.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Mutex.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/NativeFormatting.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/NativeFormatting.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Path.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Path.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/PrettyStackTrace.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/PrettyStackTrace.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Process.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Process.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Program.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Program.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Regex.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Regex.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/SHA1.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/SHA1.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Signals.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Signals.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/SmallPtrSet.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/SmallPtrSet.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/SmallVector.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/SmallVector.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/SourceMgr.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/SourceMgr.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Statistic.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Statistic.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/StringExtras.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/StringExtras.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/StringMap.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/StringMap.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/StringRef.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/StringRef.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/StringSaver.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/StringSaver.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/TargetParser.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/TargetParser.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Threading.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Threading.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Timer.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Timer.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/ToolOutputFile.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/ToolOutputFile.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Triple.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Triple.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Twine.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Twine.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Unicode.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Unicode.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Valgrind.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Valgrind.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/Watchdog.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/Watchdog.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/WithColor.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/WithColor.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/circular_raw_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/circular_raw_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/raw_os_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/raw_os_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/raw_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport_obj.dir/raw_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/regcomp.c.o"
+  "CMakeFiles/LLVHSupport_obj.dir/regcomp.c.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/regerror.c.o"
+  "CMakeFiles/LLVHSupport_obj.dir/regerror.c.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/regexec.c.o"
+  "CMakeFiles/LLVHSupport_obj.dir/regexec.c.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/regfree.c.o"
+  "CMakeFiles/LLVHSupport_obj.dir/regfree.c.o.d"
+  "CMakeFiles/LLVHSupport_obj.dir/regstrlcpy.c.o"
+  "CMakeFiles/LLVHSupport_obj.dir/regstrlcpy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/LLVHSupport_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
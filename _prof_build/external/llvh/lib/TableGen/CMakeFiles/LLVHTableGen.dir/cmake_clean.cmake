@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libLLVHTableGen.a"
+  "libLLVHTableGen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LLVHTableGen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/llvh/lib/TableGen/Error.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Error.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Error.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/JSONBackend.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/JSONBackend.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/JSONBackend.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/Main.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Main.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Main.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/Record.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Record.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/Record.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/SetTheory.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/SetTheory.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/SetTheory.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/StringMatcher.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/StringMatcher.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/StringMatcher.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/TGLexer.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TGLexer.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TGLexer.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/TGParser.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TGParser.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TGParser.cpp.o.d"
+  "/root/repo/external/llvh/lib/TableGen/TableGenBackend.cpp" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TableGenBackend.cpp.o" "gcc" "external/llvh/lib/TableGen/CMakeFiles/LLVHTableGen_obj.dir/TableGenBackend.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/FileCheck"
+  "../../../../bin/FileCheck.pdb"
+  "CMakeFiles/FileCheck.dir/FileCheck.cpp.o"
+  "CMakeFiles/FileCheck.dir/FileCheck.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FileCheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvh-tblgen.dir/Example.cpp.o"
+  "CMakeFiles/llvh-tblgen.dir/Example.cpp.o.d"
+  "CMakeFiles/llvh-tblgen.dir/TableGen.cpp.o"
+  "CMakeFiles/llvh-tblgen.dir/TableGen.cpp.o.d"
+  "llvh-tblgen"
+  "llvh-tblgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/llvh-tblgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
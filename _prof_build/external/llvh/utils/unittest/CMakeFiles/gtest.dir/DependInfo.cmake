@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/llvh/utils/unittest/googlemock/src/gmock-all.cc" "external/llvh/utils/unittest/CMakeFiles/gtest.dir/googlemock/src/gmock-all.cc.o" "gcc" "external/llvh/utils/unittest/CMakeFiles/gtest.dir/googlemock/src/gmock-all.cc.o.d"
+  "/root/repo/external/llvh/utils/unittest/googletest/src/gtest-all.cc" "external/llvh/utils/unittest/CMakeFiles/gtest.dir/googletest/src/gtest-all.cc.o" "gcc" "external/llvh/utils/unittest/CMakeFiles/gtest.dir/googletest/src/gtest-all.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
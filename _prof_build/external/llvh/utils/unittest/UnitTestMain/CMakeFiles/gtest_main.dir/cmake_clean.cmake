@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libgtest_main.a"
+  "libgtest_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
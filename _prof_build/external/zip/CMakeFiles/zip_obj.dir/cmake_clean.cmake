@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zip_obj.dir/src/zip.c.o"
+  "CMakeFiles/zip_obj.dir/src/zip.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zip_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesAST.a"
+  "libhermesAST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/AST/ASTBuilder.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/ASTBuilder.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/ASTBuilder.cpp.o.d"
+  "/root/repo/lib/AST/ASTUtils.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/ASTUtils.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/ASTUtils.cpp.o.d"
+  "/root/repo/lib/AST/CommonJS.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/CommonJS.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/CommonJS.cpp.o.d"
+  "/root/repo/lib/AST/Context.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/Context.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/Context.cpp.o.d"
+  "/root/repo/lib/AST/ESTree.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/ESTree.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/ESTree.cpp.o.d"
+  "/root/repo/lib/AST/ESTreeJSONDumper.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/ESTreeJSONDumper.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/ESTreeJSONDumper.cpp.o.d"
+  "/root/repo/lib/AST/NativeContext.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/NativeContext.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/NativeContext.cpp.o.d"
+  "/root/repo/lib/AST/TS2Flow.cpp" "lib/AST/CMakeFiles/hermesAST_obj.dir/TS2Flow.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST_obj.dir/TS2Flow.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesAST_obj.dir/ASTBuilder.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/ASTBuilder.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/ASTUtils.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/ASTUtils.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/CommonJS.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/CommonJS.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/Context.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/Context.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/ESTree.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/ESTree.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/ESTreeJSONDumper.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/ESTreeJSONDumper.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/NativeContext.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/NativeContext.cpp.o.d"
+  "CMakeFiles/hermesAST_obj.dir/TS2Flow.cpp.o"
+  "CMakeFiles/hermesAST_obj.dir/TS2Flow.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
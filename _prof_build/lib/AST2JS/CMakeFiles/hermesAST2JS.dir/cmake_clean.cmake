@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesAST2JS.a"
+  "libhermesAST2JS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST2JS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
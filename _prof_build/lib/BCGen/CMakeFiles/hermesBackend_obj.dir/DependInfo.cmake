@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BCGen/BackendContext.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/BackendContext.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/BackendContext.cpp.o.d"
+  "/root/repo/lib/BCGen/Exceptions.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/Exceptions.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/Exceptions.cpp.o.d"
+  "/root/repo/lib/BCGen/LiteralBufferBuilder.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/LiteralBufferBuilder.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/LiteralBufferBuilder.cpp.o.d"
+  "/root/repo/lib/BCGen/LowerScopes.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/LowerScopes.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/LowerScopes.cpp.o.d"
+  "/root/repo/lib/BCGen/Lowering.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/Lowering.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/Lowering.cpp.o.d"
+  "/root/repo/lib/BCGen/OptEnvironmentInit.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/OptEnvironmentInit.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/OptEnvironmentInit.cpp.o.d"
+  "/root/repo/lib/BCGen/RegAlloc.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/RegAlloc.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/RegAlloc.cpp.o.d"
+  "/root/repo/lib/BCGen/SerializedLiteralGenerator.cpp" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/SerializedLiteralGenerator.cpp.o" "gcc" "lib/BCGen/CMakeFiles/hermesBackend_obj.dir/SerializedLiteralGenerator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
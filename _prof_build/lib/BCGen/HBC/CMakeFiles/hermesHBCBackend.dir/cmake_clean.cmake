@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesHBCBackend.a"
+  "libhermesHBCBackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BCGen/HBC/BCProvider.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/BCProvider.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/BCProvider.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/ConsecutiveStringStorage.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/DebugInfo.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/HBCStub.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/HBCStub.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/HBCStub.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/SimpleBytecodeBuilder.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/UniquingFilenameTable.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/BCProvider.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/BCProvider.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/HBCStub.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/HBCStub.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o"
+  "CMakeFiles/hermesHBCBackendLean_obj.dir/UniquingFilenameTable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackendLean_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BCGen/HBC/BCProvider.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BCProvider.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BCProvider.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BCProviderFromSrc.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BCProviderFromSrc.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BCProviderFromSrc.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Bytecode.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeDisassembler.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeFormConverter.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeGenerator.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeStream.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/ConsecutiveStringStorage.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/DebugInfo.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/HBC.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/ISel.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/LoweringPipelines.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/LoweringPipelines.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/LoweringPipelines.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/InsertProfilePoint.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/OptParentEnvironment.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptParentEnvironment.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptParentEnvironment.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/PeepholeLowering.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/PeepholeLowering.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/PeepholeLowering.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/ReorderRegisters.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/ReorderRegisters.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/ReorderRegisters.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/SuperInstructions.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/SuperInstructions.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/Passes/SuperInstructions.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/SimpleBytecodeBuilder.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/StringKind.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/UniquingFilenameTable.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/UniquingStringLiteralTable.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesHBCBackend_obj.dir/BCProvider.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BCProvider.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BCProviderFromSrc.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BCProviderFromSrc.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Bytecode.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeDisassembler.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeFormConverter.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeGenerator.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/BytecodeStream.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ConsecutiveStringStorage.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/HBC.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/ISel.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/LoweringPipelines.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/LoweringPipelines.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/InsertProfilePoint.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptParentEnvironment.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/OptParentEnvironment.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/PeepholeLowering.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/PeepholeLowering.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/ReorderRegisters.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/ReorderRegisters.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/SuperInstructions.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/Passes/SuperInstructions.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/StringKind.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingFilenameTable.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend_obj.dir/UniquingStringLiteralTable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackend_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesSHBackend.a"
+  "libhermesSHBackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSHBackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BCGen/SH/LineDirectiveEmitter.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LineDirectiveEmitter.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LineDirectiveEmitter.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/LoadConstants.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LoadConstants.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LoadConstants.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/LowerCalls.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LowerCalls.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LowerCalls.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/LowerNanBoxedUnionNarrowT.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LowerNanBoxedUnionNarrowT.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/LowerNanBoxedUnionNarrowT.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/PeepholeLowering.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/PeepholeLowering.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/PeepholeLowering.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/RecreateCheapValues.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/RecreateCheapValues.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/RecreateCheapValues.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/SH.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/SH.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/SH.cpp.o.d"
+  "/root/repo/lib/BCGen/SH/SHRegAlloc.cpp" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/SHRegAlloc.cpp.o" "gcc" "lib/BCGen/SH/CMakeFiles/hermesSHBackend_obj.dir/SHRegAlloc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesFrontend_obj.dir/IR/Analysis.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/Analysis.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/CFG.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/CFG.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IR.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IR.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRBuilder.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRBuilder.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IREval.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IREval.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRUtils.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRUtils.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRVerifier.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/IRVerifier.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/Instrs.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IR/Instrs.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-except.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-except.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-expr.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-expr.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-func.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-func.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-legacy-class.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-legacy-class.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-stmt.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-stmt.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-typed-class.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen-typed-class.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/ESTreeIRGen.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/IRGen.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/IRGen/IRGen.cpp.o.d"
+  "CMakeFiles/hermesFrontend_obj.dir/Utils/Dumper.cpp.o"
+  "CMakeFiles/hermesFrontend_obj.dir/Utils/Dumper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontend_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
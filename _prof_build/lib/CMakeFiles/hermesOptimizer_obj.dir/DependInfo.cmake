@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Optimizer/PassManager/PassManager.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/PassManager.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/PassManager.cpp.o.d"
+  "/root/repo/lib/Optimizer/PassManager/Pipeline.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/Pipeline.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/PassManager/Pipeline.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/Auditor.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Auditor.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Auditor.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/CSE.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CSE.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CSE.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/CacheNewObject.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CacheNewObject.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CacheNewObject.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/CodeMotion.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CodeMotion.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/CodeMotion.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/DCE.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/DCE.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/DCE.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/FrameLoadStoreOpts.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FrameLoadStoreOpts.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FrameLoadStoreOpts.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/FuncSigOpts.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FuncSigOpts.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FuncSigOpts.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/FunctionAnalysis.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FunctionAnalysis.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/FunctionAnalysis.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/Inlining.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Inlining.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Inlining.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/InstSimplify.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstSimplify.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstSimplify.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/InstructionEscapeAnalysis.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/LowerBuiltinCalls.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/LowerBuiltinCalls.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/LowerBuiltinCalls.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/LowerGeneratorFunction.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/LowerGeneratorFunction.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/LowerGeneratorFunction.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/Mem2Reg.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Mem2Reg.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Mem2Reg.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/MetroRequireOpt.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/MetroRequireOpt.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/MetroRequireOpt.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/ObjectMergeNewStores.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ObjectMergeNewStores.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ObjectMergeNewStores.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/ObjectStackPromotion.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ObjectStackPromotion.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ObjectStackPromotion.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/ResolveStaticRequire.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/ScopeElimination.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ScopeElimination.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ScopeElimination.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/ScopeHoisting.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ScopeHoisting.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/ScopeHoisting.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/SimpleMem2Reg.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleMem2Reg.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleMem2Reg.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/SimpleStackPromotion.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleStackPromotion.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimpleStackPromotion.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/SimplifyCFG.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimplifyCFG.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/SimplifyCFG.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/StripDebugInsts.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/StripDebugInsts.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/StripDebugInsts.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/TDZDedup.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TDZDedup.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TDZDedup.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/TypeInference.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TypeInference.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/TypeInference.cpp.o.d"
+  "/root/repo/lib/Optimizer/Scalar/Utils.cpp" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Utils.cpp.o" "gcc" "lib/CMakeFiles/hermesOptimizer_obj.dir/Optimizer/Scalar/Utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermescompiler.a"
+  "libhermescompiler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/hermescompiler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
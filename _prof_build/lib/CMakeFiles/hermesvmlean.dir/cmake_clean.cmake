@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesvmlean.dir/dummy.cpp.o"
+  "CMakeFiles/hermesvmlean.dir/dummy.cpp.o.d"
+  "libhermesvmlean.pdb"
+  "libhermesvmlean.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesvmlean.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesCompilerDriver.a"
+  "libhermesCompilerDriver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesCompilerDriver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
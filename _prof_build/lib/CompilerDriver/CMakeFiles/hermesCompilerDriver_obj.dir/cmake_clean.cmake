@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesCompilerDriver_obj.dir/CompilerDriver.cpp.o"
+  "CMakeFiles/hermesCompilerDriver_obj.dir/CompilerDriver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesCompilerDriver_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
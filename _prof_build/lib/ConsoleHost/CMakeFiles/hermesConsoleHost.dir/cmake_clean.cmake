@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesConsoleHost.a"
+  "libhermesConsoleHost.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesConsoleHost.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesConsoleHost_obj.dir/ConsoleHost.cpp.o"
+  "CMakeFiles/hermesConsoleHost_obj.dir/ConsoleHost.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesConsoleHost_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesDependencyExtractor.a"
+  "libhermesDependencyExtractor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesDependencyExtractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesDependencyExtractor_obj.dir/DependencyExtractor.cpp.o"
+  "CMakeFiles/hermesDependencyExtractor_obj.dir/DependencyExtractor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesDependencyExtractor_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesFrontEndDefs.a"
+  "libhermesFrontEndDefs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontEndDefs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesFrontEndDefs_obj.dir/Builtins.cpp.o"
+  "CMakeFiles/hermesFrontEndDefs_obj.dir/Builtins.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontEndDefs_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesInst.a"
+  "libhermesInst.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
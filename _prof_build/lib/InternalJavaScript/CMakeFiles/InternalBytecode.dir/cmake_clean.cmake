@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InternalBytecode"
+  "InternalBytecode.hbc"
+  "InternalBytecode.js"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/InternalBytecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InternalBytecodeInclude"
+  "InternalBytecode.hbc"
+  "InternalBytecode.inc"
+  "InternalBytecode.js"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/InternalBytecodeInclude.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
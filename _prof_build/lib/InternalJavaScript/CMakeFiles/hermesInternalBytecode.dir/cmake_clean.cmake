@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesInternalBytecode.a"
+  "libhermesInternalBytecode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInternalBytecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInternalBytecode_obj.dir/InternalBytecode.cpp.o"
+  "CMakeFiles/hermesInternalBytecode_obj.dir/InternalBytecode.cpp.o.d"
+  "InternalBytecode.hbc"
+  "InternalBytecode.inc"
+  "InternalBytecode.js"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInternalBytecode_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
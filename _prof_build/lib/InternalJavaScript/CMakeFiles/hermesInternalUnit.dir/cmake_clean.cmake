@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesInternalUnit.a"
+  "libhermesInternalUnit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hermesInternalUnit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInternalUnit_obj.dir/internal_unit.c.o"
+  "CMakeFiles/hermesInternalUnit_obj.dir/internal_unit.c.o.d"
+  "InternalBytecode.js"
+  "internal_unit.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hermesInternalUnit_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Parser/FlowHelpers.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/FlowHelpers.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/FlowHelpers.cpp.o.d"
+  "/root/repo/lib/Parser/JSLexer.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSLexer.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSLexer.cpp.o.d"
+  "/root/repo/lib/Parser/JSONParser.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSONParser.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSONParser.cpp.o.d"
+  "/root/repo/lib/Parser/JSParser.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParser.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParser.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-flow.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-flow.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-flow.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-jsx.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-jsx.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-jsx.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-ts.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-ts.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl-ts.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/JSParserImpl.cpp.o.d"
+  "/root/repo/lib/Parser/rust-api.cpp" "lib/Parser/CMakeFiles/hermesParser_obj.dir/rust-api.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser_obj.dir/rust-api.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesParser_obj.dir/FlowHelpers.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/FlowHelpers.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSLexer.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSLexer.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSONParser.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSONParser.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSParser.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSParser.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-flow.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-flow.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-jsx.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-jsx.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-ts.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl-ts.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/JSParserImpl.cpp.o.d"
+  "CMakeFiles/hermesParser_obj.dir/rust-api.cpp.o"
+  "CMakeFiles/hermesParser_obj.dir/rust-api.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesParser_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPlatform_obj.dir/Logging.cpp.o"
+  "CMakeFiles/hermesPlatform_obj.dir/Logging.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatform_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesBCP47Parser_obj.dir/BCP47Parser.cpp.o"
+  "CMakeFiles/hermesBCP47Parser_obj.dir/BCP47Parser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesBCP47Parser_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesPlatformUnicode.a"
+  "libhermesPlatformUnicode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatformUnicode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
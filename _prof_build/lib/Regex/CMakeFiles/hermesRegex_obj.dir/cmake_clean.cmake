@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesRegex_obj.dir/Executor.cpp.o"
+  "CMakeFiles/hermesRegex_obj.dir/Executor.cpp.o.d"
+  "CMakeFiles/hermesRegex_obj.dir/RegexParser.cpp.o"
+  "CMakeFiles/hermesRegex_obj.dir/RegexParser.cpp.o.d"
+  "CMakeFiles/hermesRegex_obj.dir/RegexSerialization.cpp.o"
+  "CMakeFiles/hermesRegex_obj.dir/RegexSerialization.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesRegex_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Sema/ASTEval.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ASTEval.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ASTEval.cpp.o.d"
+  "/root/repo/lib/Sema/ASTLowering.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ASTLowering.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ASTLowering.cpp.o.d"
+  "/root/repo/lib/Sema/CheckImplicitReturn.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/CheckImplicitReturn.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/CheckImplicitReturn.cpp.o.d"
+  "/root/repo/lib/Sema/DeclCollector.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/DeclCollector.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/DeclCollector.cpp.o.d"
+  "/root/repo/lib/Sema/ESTreeClone.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ESTreeClone.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ESTreeClone.cpp.o.d"
+  "/root/repo/lib/Sema/FlowChecker-expr.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker-expr.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker-expr.cpp.o.d"
+  "/root/repo/lib/Sema/FlowChecker-scopetypes.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker-scopetypes.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker-scopetypes.cpp.o.d"
+  "/root/repo/lib/Sema/FlowChecker.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowChecker.cpp.o.d"
+  "/root/repo/lib/Sema/FlowContext.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowContext.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowContext.cpp.o.d"
+  "/root/repo/lib/Sema/FlowTypesDumper.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowTypesDumper.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/FlowTypesDumper.cpp.o.d"
+  "/root/repo/lib/Sema/Keywords.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/Keywords.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/Keywords.cpp.o.d"
+  "/root/repo/lib/Sema/ScopedFunctionPromoter.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ScopedFunctionPromoter.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/ScopedFunctionPromoter.cpp.o.d"
+  "/root/repo/lib/Sema/SemContext.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemContext.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemContext.cpp.o.d"
+  "/root/repo/lib/Sema/SemResolve.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemResolve.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemResolve.cpp.o.d"
+  "/root/repo/lib/Sema/SemanticResolver.cpp" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemanticResolver.cpp.o" "gcc" "lib/Sema/CMakeFiles/hermesSema_obj.dir/SemanticResolver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
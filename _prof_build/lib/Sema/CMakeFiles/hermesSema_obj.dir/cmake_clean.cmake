@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSema_obj.dir/ASTEval.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/ASTEval.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/ASTLowering.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/ASTLowering.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/CheckImplicitReturn.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/CheckImplicitReturn.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/DeclCollector.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/DeclCollector.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/ESTreeClone.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/ESTreeClone.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker-expr.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker-expr.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker-scopetypes.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker-scopetypes.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/FlowChecker.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/FlowContext.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/FlowContext.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/FlowTypesDumper.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/FlowTypesDumper.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/Keywords.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/Keywords.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/ScopedFunctionPromoter.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/ScopedFunctionPromoter.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/SemContext.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/SemContext.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/SemResolve.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/SemResolve.cpp.o.d"
+  "CMakeFiles/hermesSema_obj.dir/SemanticResolver.cpp.o"
+  "CMakeFiles/hermesSema_obj.dir/SemanticResolver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSema_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
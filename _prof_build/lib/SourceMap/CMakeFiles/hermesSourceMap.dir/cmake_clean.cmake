@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesSourceMap.a"
+  "libhermesSourceMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSourceMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/SourceMap/SourceMap.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMap.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMap.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapGenerator.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapGenerator.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapGenerator.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapParser.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapParser.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapParser.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapTranslator.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapTranslator.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/SourceMapTranslator.cpp.o.d"
+  "/root/repo/lib/SourceMap/c-api.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/c-api.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap_obj.dir/c-api.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMap.cpp.o"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMap.cpp.o.d"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapGenerator.cpp.o"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapGenerator.cpp.o.d"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapParser.cpp.o"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapParser.cpp.o.d"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapTranslator.cpp.o"
+  "CMakeFiles/hermesSourceMap_obj.dir/SourceMapTranslator.cpp.o.d"
+  "CMakeFiles/hermesSourceMap_obj.dir/c-api.cpp.o"
+  "CMakeFiles/hermesSourceMap_obj.dir/c-api.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSourceMap_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Support/Allocator.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Allocator.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Allocator.cpp.o.d"
+  "/root/repo/lib/Support/Base64.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Base64.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Base64.cpp.o.d"
+  "/root/repo/lib/Support/Base64vlq.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Base64vlq.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Base64vlq.cpp.o.d"
+  "/root/repo/lib/Support/BigIntSupport.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/BigIntSupport.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/BigIntSupport.cpp.o.d"
+  "/root/repo/lib/Support/CheckedMalloc.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/CheckedMalloc.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/CheckedMalloc.cpp.o.d"
+  "/root/repo/lib/Support/Conversions.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Conversions.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/Conversions.cpp.o.d"
+  "/root/repo/lib/Support/ErrorHandling.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/ErrorHandling.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/ErrorHandling.cpp.o.d"
+  "/root/repo/lib/Support/JSONEmitter.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/JSONEmitter.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/JSONEmitter.cpp.o.d"
+  "/root/repo/lib/Support/LEB128.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/LEB128.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/LEB128.cpp.o.d"
+  "/root/repo/lib/Support/MD5.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/MD5.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/MD5.cpp.o.d"
+  "/root/repo/lib/Support/MemorySizeParser.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/MemorySizeParser.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/MemorySizeParser.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatCommon.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatCommon.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatCommon.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatEmscripten.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatEmscripten.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatEmscripten.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatPosix.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatPosix.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatPosix.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatWindows.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatWindows.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/OSCompatWindows.cpp.o.d"
+  "/root/repo/lib/Support/PageAccessTrackerPosix.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/PageAccessTrackerPosix.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/PageAccessTrackerPosix.cpp.o.d"
+  "/root/repo/lib/Support/PerfSection.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/PerfSection.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/PerfSection.cpp.o.d"
+  "/root/repo/lib/Support/RandomSeedParser.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/RandomSeedParser.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/RandomSeedParser.cpp.o.d"
+  "/root/repo/lib/Support/SHA1.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SHA1.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SHA1.cpp.o.d"
+  "/root/repo/lib/Support/SNPrintfBuf.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SNPrintfBuf.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SNPrintfBuf.cpp.o.d"
+  "/root/repo/lib/Support/SemaphorePosix.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SemaphorePosix.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SemaphorePosix.cpp.o.d"
+  "/root/repo/lib/Support/SerialExecutor.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SerialExecutor.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SerialExecutor.cpp.o.d"
+  "/root/repo/lib/Support/SimpleDiagHandler.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SimpleDiagHandler.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SimpleDiagHandler.cpp.o.d"
+  "/root/repo/lib/Support/SourceErrorManager.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SourceErrorManager.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/SourceErrorManager.cpp.o.d"
+  "/root/repo/lib/Support/StackExecutor.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StackExecutor.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StackExecutor.cpp.o.d"
+  "/root/repo/lib/Support/StackOverflowGuard.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StackOverflowGuard.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StackOverflowGuard.cpp.o.d"
+  "/root/repo/lib/Support/StringTable.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StringTable.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/StringTable.cpp.o.d"
+  "/root/repo/lib/Support/UTF16Stream.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/UTF16Stream.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/UTF16Stream.cpp.o.d"
+  "/root/repo/lib/Support/UTF8.cpp" "lib/Support/CMakeFiles/hermesSupport_obj.dir/UTF8.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport_obj.dir/UTF8.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,152 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/VM/AllocationSiteTracker.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/AllocationSiteTracker.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/AllocationSiteTracker.cpp.o.d"
+  "/root/repo/lib/VM/ArrayStorage.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/ArrayStorage.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/ArrayStorage.cpp.o.d"
+  "/root/repo/lib/VM/BasicBlockExecutionInfo.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BasicBlockExecutionInfo.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BasicBlockExecutionInfo.cpp.o.d"
+  "/root/repo/lib/VM/BigIntPrimitive.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BigIntPrimitive.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BigIntPrimitive.cpp.o.d"
+  "/root/repo/lib/VM/BoxedDouble.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BoxedDouble.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BoxedDouble.cpp.o.d"
+  "/root/repo/lib/VM/BuildMetadata.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BuildMetadata.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/BuildMetadata.cpp.o.d"
+  "/root/repo/lib/VM/Callable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Callable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Callable.cpp.o.d"
+  "/root/repo/lib/VM/CellKind.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CellKind.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CellKind.cpp.o.d"
+  "/root/repo/lib/VM/CheckHeapWellFormedAcceptor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CheckHeapWellFormedAcceptor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CheckHeapWellFormedAcceptor.cpp.o.d"
+  "/root/repo/lib/VM/CodeBlock.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CodeBlock.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/CodeBlock.cpp.o.d"
+  "/root/repo/lib/VM/Debugger/Debugger.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Debugger/Debugger.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Debugger/Debugger.cpp.o.d"
+  "/root/repo/lib/VM/DecoratedObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DecoratedObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DecoratedObject.cpp.o.d"
+  "/root/repo/lib/VM/DictPropertyMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DictPropertyMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DictPropertyMap.cpp.o.d"
+  "/root/repo/lib/VM/Domain.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Domain.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Domain.cpp.o.d"
+  "/root/repo/lib/VM/DummyObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DummyObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/DummyObject.cpp.o.d"
+  "/root/repo/lib/VM/FastArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/FastArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/FastArray.cpp.o.d"
+  "/root/repo/lib/VM/GCBase.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/GCBase.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/GCBase.cpp.o.d"
+  "/root/repo/lib/VM/HandleRootOwner.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HandleRootOwner.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HandleRootOwner.cpp.o.d"
+  "/root/repo/lib/VM/HeapSnapshot.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HeapSnapshot.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HeapSnapshot.cpp.o.d"
+  "/root/repo/lib/VM/HermesValue.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HermesValue.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HermesValue.cpp.o.d"
+  "/root/repo/lib/VM/HiddenClass.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HiddenClass.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HiddenClass.cpp.o.d"
+  "/root/repo/lib/VM/HostModel.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HostModel.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/HostModel.cpp.o.d"
+  "/root/repo/lib/VM/IdentifierTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/IdentifierTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/IdentifierTable.cpp.o.d"
+  "/root/repo/lib/VM/Interpreter-slowpaths.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Interpreter-slowpaths.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Interpreter-slowpaths.cpp.o.d"
+  "/root/repo/lib/VM/Interpreter.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Interpreter.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Interpreter.cpp.o.d"
+  "/root/repo/lib/VM/JIT/DiscoverBB.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JIT/DiscoverBB.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JIT/DiscoverBB.cpp.o.d"
+  "/root/repo/lib/VM/JSArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSArray.cpp.o.d"
+  "/root/repo/lib/VM/JSArrayBuffer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSArrayBuffer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSArrayBuffer.cpp.o.d"
+  "/root/repo/lib/VM/JSCallSite.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSCallSite.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSCallSite.cpp.o.d"
+  "/root/repo/lib/VM/JSCallableProxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSCallableProxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSCallableProxy.cpp.o.d"
+  "/root/repo/lib/VM/JSDataView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSDataView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSDataView.cpp.o.d"
+  "/root/repo/lib/VM/JSDate.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSDate.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSDate.cpp.o.d"
+  "/root/repo/lib/VM/JSError.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSError.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSError.cpp.o.d"
+  "/root/repo/lib/VM/JSGeneratorObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSGeneratorObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSGeneratorObject.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Array.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Array.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Array.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/ArrayBuffer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayBuffer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayBuffer.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/ArrayIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/AsyncFunction.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/AsyncFunction.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/AsyncFunction.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Base64.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Base64Util.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64Util.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64Util.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/BigInt.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/BigInt.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/BigInt.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Boolean.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Boolean.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Boolean.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/CallSite.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/CallSite.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/CallSite.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DataView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DataView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DataView.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Date.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Date.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Date.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DateCache.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateCache.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateCache.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DateUtil.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateUtil.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateUtil.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DebuggerInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DebuggerInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DebuggerInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Error.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Error.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Error.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Function.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Function.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Function.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GeneratorFunction.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorFunction.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorFunction.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GeneratorPrototype.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorPrototype.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorPrototype.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GlobalObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GlobalObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GlobalObject.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/HermesBuiltin.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesBuiltin.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesBuiltin.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/HermesInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Intl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Intl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Intl.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/IteratorPrototype.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/IteratorPrototype.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/IteratorPrototype.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSLibInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSLibStorage.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibStorage.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibStorage.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSON.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSON.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSON.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSONLexer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSONLexer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSONLexer.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Map.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Map.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Map.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Math.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Math.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Math.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Number.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Number.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Number.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Object.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Object.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Object.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Proxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Proxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Proxy.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Reflect.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Reflect.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Reflect.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RegExp.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExp.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExp.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RegExpStringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExpStringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExpStringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RuntimeJSONUtils.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RuntimeJSONUtils.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RuntimeJSONUtils.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Set.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Set.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Set.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Sorting.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Sorting.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Sorting.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/String.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/String.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/String.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/StringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/StringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/StringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Symbol.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Symbol.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Symbol.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/TextEncoder.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TextEncoder.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TextEncoder.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/TypedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TypedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TypedArray.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/WeakMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakMap.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/WeakRef.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakRef.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakRef.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/WeakSet.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakSet.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakSet.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/escape.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/escape.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/escape.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/eval.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/eval.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/eval.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/print.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/print.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/print.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/require.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/require.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSLib/require.cpp.o.d"
+  "/root/repo/lib/VM/JSMapImpl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSMapImpl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSMapImpl.cpp.o.d"
+  "/root/repo/lib/VM/JSNativeFunctions.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSNativeFunctions.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSNativeFunctions.cpp.o.d"
+  "/root/repo/lib/VM/JSObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSObject.cpp.o.d"
+  "/root/repo/lib/VM/JSProxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSProxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSProxy.cpp.o.d"
+  "/root/repo/lib/VM/JSRegExp.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSRegExp.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSRegExp.cpp.o.d"
+  "/root/repo/lib/VM/JSRegExpStringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSRegExpStringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSRegExpStringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSTypedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSTypedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSTypedArray.cpp.o.d"
+  "/root/repo/lib/VM/JSWeakMapImpl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSWeakMapImpl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSWeakMapImpl.cpp.o.d"
+  "/root/repo/lib/VM/JSWeakRef.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSWeakRef.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/JSWeakRef.cpp.o.d"
+  "/root/repo/lib/VM/LimitedStorageProvider.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/LimitedStorageProvider.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/LimitedStorageProvider.cpp.o.d"
+  "/root/repo/lib/VM/Metadata.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Metadata.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Metadata.cpp.o.d"
+  "/root/repo/lib/VM/ModuleExportsCache.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/ModuleExportsCache.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/ModuleExportsCache.cpp.o.d"
+  "/root/repo/lib/VM/NativeState.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/NativeState.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/NativeState.cpp.o.d"
+  "/root/repo/lib/VM/Operations.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Operations.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Operations.cpp.o.d"
+  "/root/repo/lib/VM/OrderedHashMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/OrderedHashMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/OrderedHashMap.cpp.o.d"
+  "/root/repo/lib/VM/PredefinedStringIDs.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PredefinedStringIDs.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PredefinedStringIDs.cpp.o.d"
+  "/root/repo/lib/VM/PrimitiveBox.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PrimitiveBox.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PrimitiveBox.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/CodeCoverageProfiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/CodeCoverageProfiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/CodeCoverageProfiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/ProfileGenerator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/ProfileGenerator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/ProfileGenerator.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/SamplingProfiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/SamplingProfilerPosix.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerPosix.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerPosix.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/SamplingProfilerSampler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerSampler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerSampler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/SamplingProfilerWindows.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerWindows.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerWindows.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/TraceSerializer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/TraceSerializer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Profiler/TraceSerializer.cpp.o.d"
+  "/root/repo/lib/VM/PropertyAccessor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PropertyAccessor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PropertyAccessor.cpp.o.d"
+  "/root/repo/lib/VM/PropertyCache.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PropertyCache.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/PropertyCache.cpp.o.d"
+  "/root/repo/lib/VM/Runtime-profilers.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Runtime-profilers.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Runtime-profilers.cpp.o.d"
+  "/root/repo/lib/VM/Runtime.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Runtime.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/Runtime.cpp.o.d"
+  "/root/repo/lib/VM/RuntimeFlags.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/RuntimeFlags.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/RuntimeFlags.cpp.o.d"
+  "/root/repo/lib/VM/RuntimeModule.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/RuntimeModule.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/RuntimeModule.cpp.o.d"
+  "/root/repo/lib/VM/SegmentedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SegmentedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SegmentedArray.cpp.o.d"
+  "/root/repo/lib/VM/SingleObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SingleObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SingleObject.cpp.o.d"
+  "/root/repo/lib/VM/StackFrame.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StackFrame.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StackFrame.cpp.o.d"
+  "/root/repo/lib/VM/StackTracesTree.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StackTracesTree.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StackTracesTree.cpp.o.d"
+  "/root/repo/lib/VM/StaticH.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticH.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticH.cpp.o.d"
+  "/root/repo/lib/VM/StaticHInit.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticHInit.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticHInit.cpp.o.d"
+  "/root/repo/lib/VM/StaticHUnit.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticHUnit.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StaticHUnit.cpp.o.d"
+  "/root/repo/lib/VM/StorageProvider.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StorageProvider.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StorageProvider.cpp.o.d"
+  "/root/repo/lib/VM/StringPrimitive.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringPrimitive.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringPrimitive.cpp.o.d"
+  "/root/repo/lib/VM/StringRefUtils.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringRefUtils.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringRefUtils.cpp.o.d"
+  "/root/repo/lib/VM/StringView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/StringView.cpp.o.d"
+  "/root/repo/lib/VM/SymbolRegistry.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SymbolRegistry.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/SymbolRegistry.cpp.o.d"
+  "/root/repo/lib/VM/TimeLimitMonitor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/TimeLimitMonitor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/TimeLimitMonitor.cpp.o.d"
+  "/root/repo/lib/VM/TwineChar16.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/TwineChar16.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/TwineChar16.cpp.o.d"
+  "/root/repo/lib/VM/VTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/VTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/VTable.cpp.o.d"
+  "/root/repo/lib/VM/detail/IdentifierHashTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/detail/IdentifierHashTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/detail/IdentifierHashTable.cpp.o.d"
+  "/root/repo/lib/VM/gcs/AlignedHeapSegment.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/AlignedHeapSegment.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/AlignedHeapSegment.cpp.o.d"
+  "/root/repo/lib/VM/gcs/CardBoundaryTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/CardBoundaryTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/CardBoundaryTable.cpp.o.d"
+  "/root/repo/lib/VM/gcs/FillerCell.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/FillerCell.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/FillerCell.cpp.o.d"
+  "/root/repo/lib/VM/gcs/HadesGC.cpp" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/HadesGC.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime_obj.dir/gcs/HadesGC.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
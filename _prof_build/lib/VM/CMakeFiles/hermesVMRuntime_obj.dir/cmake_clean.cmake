@@ -0,0 +1,275 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesVMRuntime_obj.dir/AllocationSiteTracker.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/AllocationSiteTracker.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/ArrayStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/ArrayStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BasicBlockExecutionInfo.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BasicBlockExecutionInfo.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BigIntPrimitive.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BigIntPrimitive.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BoxedDouble.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BoxedDouble.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BuildMetadata.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/BuildMetadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Callable.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Callable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CellKind.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CellKind.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CheckHeapWellFormedAcceptor.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CheckHeapWellFormedAcceptor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CodeBlock.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/CodeBlock.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Debugger/Debugger.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Debugger/Debugger.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DecoratedObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DecoratedObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DictPropertyMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DictPropertyMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Domain.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Domain.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DummyObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/DummyObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/FastArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/FastArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/GCBase.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/GCBase.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HandleRootOwner.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HandleRootOwner.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HeapSnapshot.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HeapSnapshot.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HermesValue.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HermesValue.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HiddenClass.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HiddenClass.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HostModel.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/HostModel.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/IdentifierTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/IdentifierTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Interpreter-slowpaths.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Interpreter-slowpaths.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Interpreter.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Interpreter.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JIT/DiscoverBB.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JIT/DiscoverBB.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSCallSite.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSCallSite.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSCallableProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSCallableProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSDataView.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSDataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSDate.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSDate.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSError.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSError.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSGeneratorObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSGeneratorObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Array.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Array.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/ArrayIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/AsyncFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/AsyncFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64Util.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Base64Util.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/BigInt.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/BigInt.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Boolean.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Boolean.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/CallSite.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/CallSite.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DataView.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Date.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Date.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateCache.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateCache.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateUtil.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DateUtil.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DebuggerInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/DebuggerInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Error.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Error.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Function.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Function.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GeneratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GlobalObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/GlobalObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesBuiltin.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesBuiltin.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/HermesInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Intl.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Intl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/IteratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/IteratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSLibStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSON.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSON.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSONLexer.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/JSONLexer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Map.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Map.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Math.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Math.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Number.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Number.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Object.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Object.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Proxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Proxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Reflect.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Reflect.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RuntimeJSONUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/RuntimeJSONUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Set.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Set.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Sorting.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Sorting.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/String.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/String.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/StringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/StringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Symbol.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/Symbol.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TextEncoder.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TextEncoder.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/TypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakRef.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakRef.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakSet.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/WeakSet.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/escape.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/escape.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/eval.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/eval.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/print.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/print.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/require.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSLib/require.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSNativeFunctions.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSNativeFunctions.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSRegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSRegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSRegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSRegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSTypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSTypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSWeakMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSWeakMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSWeakRef.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/JSWeakRef.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/LimitedStorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/LimitedStorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Metadata.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Metadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/ModuleExportsCache.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/ModuleExportsCache.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/NativeState.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/NativeState.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Operations.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Operations.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/OrderedHashMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/OrderedHashMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PredefinedStringIDs.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PredefinedStringIDs.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PrimitiveBox.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PrimitiveBox.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/CodeCoverageProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/CodeCoverageProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/ProfileGenerator.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/ProfileGenerator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerPosix.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerPosix.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerSampler.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerSampler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerWindows.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/SamplingProfilerWindows.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/TraceSerializer.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Profiler/TraceSerializer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PropertyAccessor.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PropertyAccessor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PropertyCache.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/PropertyCache.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Runtime-profilers.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Runtime-profilers.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Runtime.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/Runtime.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/RuntimeFlags.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/RuntimeFlags.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/RuntimeModule.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/RuntimeModule.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SegmentedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SegmentedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SingleObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SingleObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StackFrame.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StackFrame.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StackTracesTree.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StackTracesTree.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticH.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticH.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticHInit.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticHInit.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticHUnit.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StaticHUnit.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringPrimitive.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringPrimitive.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringRefUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringRefUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringView.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/StringView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SymbolRegistry.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/SymbolRegistry.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/TimeLimitMonitor.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/TimeLimitMonitor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/TwineChar16.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/TwineChar16.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/VTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/VTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/detail/IdentifierHashTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/detail/IdentifierHashTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/AlignedHeapSegment.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/AlignedHeapSegment.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/CardBoundaryTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/CardBoundaryTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/FillerCell.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/FillerCell.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/HadesGC.cpp.o"
+  "CMakeFiles/hermesVMRuntime_obj.dir/gcs/HadesGC.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesVMRuntime_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
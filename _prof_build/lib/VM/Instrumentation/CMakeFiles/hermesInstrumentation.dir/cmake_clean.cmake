@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesInstrumentation.a"
+  "libhermesInstrumentation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInstrumentation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
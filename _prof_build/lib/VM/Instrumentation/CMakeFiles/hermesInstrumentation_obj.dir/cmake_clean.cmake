@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInstrumentation_obj.dir/PerfEventsLinux.cpp.o"
+  "CMakeFiles/hermesInstrumentation_obj.dir/PerfEventsLinux.cpp.o.d"
+  "CMakeFiles/hermesInstrumentation_obj.dir/ProcessStats.cpp.o"
+  "CMakeFiles/hermesInstrumentation_obj.dir/ProcessStats.cpp.o.d"
+  "CMakeFiles/hermesInstrumentation_obj.dir/StatSamplingThread.cpp.o"
+  "CMakeFiles/hermesInstrumentation_obj.dir/StatSamplingThread.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInstrumentation_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libhermesPublic.a"
+  "libhermesPublic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPublic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
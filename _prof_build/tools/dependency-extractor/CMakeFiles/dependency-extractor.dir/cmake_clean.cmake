@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/dependency-extractor"
+  "../../bin/dependency-extractor.pdb"
+  "CMakeFiles/dependency-extractor.dir/dependency-extractor.cpp.o"
+  "CMakeFiles/dependency-extractor.dir/dependency-extractor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dependency-extractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hbc-attribute"
+  "../../bin/hbc-attribute.pdb"
+  "CMakeFiles/hbc-attribute.dir/hbc-attribute.cpp.o"
+  "CMakeFiles/hbc-attribute.dir/hbc-attribute.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hbc-attribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hbc-deltaprep"
+  "../../bin/hbc-deltaprep.pdb"
+  "CMakeFiles/hbc-deltaprep.dir/hbc-deltaprep.cpp.o"
+  "CMakeFiles/hbc-deltaprep.dir/hbc-deltaprep.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hbc-deltaprep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
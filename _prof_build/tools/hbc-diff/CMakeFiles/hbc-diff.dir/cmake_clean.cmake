@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hbc-diff"
+  "../../bin/hbc-diff.pdb"
+  "CMakeFiles/hbc-diff.dir/hbc-diff.cpp.o"
+  "CMakeFiles/hbc-diff.dir/hbc-diff.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hbc-diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/hcdp/IPC.cpp" "tools/hcdp/CMakeFiles/hcdp.dir/IPC.cpp.o" "gcc" "tools/hcdp/CMakeFiles/hcdp.dir/IPC.cpp.o.d"
+  "/root/repo/tools/hcdp/JSONHelpers.cpp" "tools/hcdp/CMakeFiles/hcdp.dir/JSONHelpers.cpp.o" "gcc" "tools/hcdp/CMakeFiles/hcdp.dir/JSONHelpers.cpp.o.d"
+  "/root/repo/tools/hcdp/hcdp.cpp" "tools/hcdp/CMakeFiles/hcdp.dir/hcdp.cpp.o" "gcc" "tools/hcdp/CMakeFiles/hcdp.dir/hcdp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/lib/CMakeFiles/hermesvm_a.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/hcdp"
+  "../../bin/hcdp.pdb"
+  "CMakeFiles/hcdp.dir/IPC.cpp.o"
+  "CMakeFiles/hcdp.dir/IPC.cpp.o.d"
+  "CMakeFiles/hcdp.dir/JSONHelpers.cpp.o"
+  "CMakeFiles/hcdp.dir/JSONHelpers.cpp.o.d"
+  "CMakeFiles/hcdp.dir/hcdp.cpp.o"
+  "CMakeFiles/hcdp.dir/hcdp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hcdp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
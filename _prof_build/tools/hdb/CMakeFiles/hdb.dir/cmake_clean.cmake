@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hdb"
+  "../../bin/hdb.pdb"
+  "CMakeFiles/hdb.dir/hdb.cpp.o"
+  "CMakeFiles/hdb.dir/hdb.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
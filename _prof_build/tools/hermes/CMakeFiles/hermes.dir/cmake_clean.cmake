@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/hermes"
+  "../../bin/hermes.pdb"
+  "CMakeFiles/hermes.dir/hermes.cpp.o"
+  "CMakeFiles/hermes.dir/hermes.cpp.o.d"
+  "CMakeFiles/hermes.dir/repl.cpp.o"
+  "CMakeFiles/hermes.dir/repl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
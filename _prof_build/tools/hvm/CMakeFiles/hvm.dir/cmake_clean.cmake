@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hvm"
+  "../../bin/hvm.pdb"
+  "CMakeFiles/hvm.dir/hvm.cpp.o"
+  "CMakeFiles/hvm.dir/hvm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hvm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/shermes/ParseJSFile.cpp" "tools/shermes/CMakeFiles/shermes.dir/ParseJSFile.cpp.o" "gcc" "tools/shermes/CMakeFiles/shermes.dir/ParseJSFile.cpp.o.d"
+  "/root/repo/tools/shermes/compile.cpp" "tools/shermes/CMakeFiles/shermes.dir/compile.cpp.o" "gcc" "tools/shermes/CMakeFiles/shermes.dir/compile.cpp.o.d"
+  "/root/repo/tools/shermes/shermes.cpp" "tools/shermes/CMakeFiles/shermes.dir/shermes.cpp.o" "gcc" "tools/shermes/CMakeFiles/shermes.dir/shermes.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/lib/CMakeFiles/hermescompiler.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
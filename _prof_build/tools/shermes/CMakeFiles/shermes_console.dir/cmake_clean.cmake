@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shermes_console.dir/ConsoleBindings.cpp.o"
+  "CMakeFiles/shermes_console.dir/ConsoleBindings.cpp.o.d"
+  "libshermes_console.pdb"
+  "libshermes_console.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shermes_console.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
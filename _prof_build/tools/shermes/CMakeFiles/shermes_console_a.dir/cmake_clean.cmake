@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shermes_console_a.dir/ConsoleBindings.cpp.o"
+  "CMakeFiles/shermes_console_a.dir/ConsoleBindings.cpp.o.d"
+  "libshermes_console_a.a"
+  "libshermes_console_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shermes_console_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
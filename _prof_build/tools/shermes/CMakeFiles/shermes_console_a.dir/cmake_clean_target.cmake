@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libshermes_console_a.a"
+)
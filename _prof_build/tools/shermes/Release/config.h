@@ -0,0 +1,5 @@
+#define SHERMES_CC                    R"(cc)"
+#define SHERMES_CC_SYSCFLAGS          R"()"
+#define SHERMES_CC_SYSLDFLAGS         R"()"
+#define SHERMES_CC_INCLUDE_PATH       R"(/root/repo/_prof_build/lib/config:/root/repo/include)"
+#define SHERMES_CC_LIB_PATH           R"(/root/repo/_prof_build/lib:/root/repo/_prof_build/jsi:/root/repo/_prof_build/tools/shermes)"
\ No newline at end of file
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/synth"
+  "../../bin/synth.pdb"
+  "CMakeFiles/synth.dir/synth.cpp.o"
+  "CMakeFiles/synth.dir/synth.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesADTTests.dir/BitArrayTest.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/BitArrayTest.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/CompactArrayTest.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/CompactArrayTest.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/ConsumableRangeTest.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/ConsumableRangeTest.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/OwningFoldingSet.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/OwningFoldingSet.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/PersistentScopedMapTest.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/PersistentScopedMapTest.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/SafeIntTest.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/SafeIntTest.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/ScopedHashTable.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/ScopedHashTable.cpp.o.d"
+  "CMakeFiles/HermesADTTests.dir/WordBitSet.cpp.o"
+  "CMakeFiles/HermesADTTests.dir/WordBitSet.cpp.o.d"
+  "HermesADTTests"
+  "HermesADTTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesADTTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "APILeanTests"
+  "APILeanTests.pdb"
+  "CMakeFiles/APILeanTests.dir/APILeanTest.cpp.o"
+  "CMakeFiles/APILeanTests.dir/APILeanTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/APILeanTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/API/APITest.cpp" "unittests/API/CMakeFiles/APITests.dir/APITest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/APITest.cpp.o.d"
+  "/root/repo/unittests/API/APITestFactory.cpp" "unittests/API/CMakeFiles/APITests.dir/APITestFactory.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/APITestFactory.cpp.o.d"
+  "/root/repo/unittests/API/AsyncDebuggerAPITest.cpp" "unittests/API/CMakeFiles/APITests.dir/AsyncDebuggerAPITest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/AsyncDebuggerAPITest.cpp.o.d"
+  "/root/repo/unittests/API/CDPAgentTest.cpp" "unittests/API/CMakeFiles/APITests.dir/CDPAgentTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/CDPAgentTest.cpp.o.d"
+  "/root/repo/unittests/API/CDPJSONHelpers.cpp" "unittests/API/CMakeFiles/APITests.dir/CDPJSONHelpers.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/CDPJSONHelpers.cpp.o.d"
+  "/root/repo/unittests/API/ConsoleMessageTest.cpp" "unittests/API/CMakeFiles/APITests.dir/ConsoleMessageTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/ConsoleMessageTest.cpp.o.d"
+  "/root/repo/unittests/API/DebuggerTest.cpp" "unittests/API/CMakeFiles/APITests.dir/DebuggerTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/DebuggerTest.cpp.o.d"
+  "/root/repo/unittests/API/DomainStateTest.cpp" "unittests/API/CMakeFiles/APITests.dir/DomainStateTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/DomainStateTest.cpp.o.d"
+  "/root/repo/unittests/API/HeapSnapshotAPITest.cpp" "unittests/API/CMakeFiles/APITests.dir/HeapSnapshotAPITest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/HeapSnapshotAPITest.cpp.o.d"
+  "/root/repo/unittests/API/SynchronizedCallbackTest.cpp" "unittests/API/CMakeFiles/APITests.dir/SynchronizedCallbackTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/SynchronizedCallbackTest.cpp.o.d"
+  "/root/repo/unittests/API/SynthTraceParserTest.cpp" "unittests/API/CMakeFiles/APITests.dir/SynthTraceParserTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/SynthTraceParserTest.cpp.o.d"
+  "/root/repo/unittests/API/SynthTraceSerializationTest.cpp" "unittests/API/CMakeFiles/APITests.dir/SynthTraceSerializationTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/SynthTraceSerializationTest.cpp.o.d"
+  "/root/repo/unittests/API/SynthTraceTest.cpp" "unittests/API/CMakeFiles/APITests.dir/SynthTraceTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/SynthTraceTest.cpp.o.d"
+  "/root/repo/unittests/API/TimerStatsTest.cpp" "unittests/API/CMakeFiles/APITests.dir/TimerStatsTest.cpp.o" "gcc" "unittests/API/CMakeFiles/APITests.dir/TimerStatsTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/compileJS.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/traceInterpreter.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/timerStats.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/CMakeFiles/hermesvm_a.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes_sandbox/CMakeFiles/hermesSandboxRuntime.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/cdp/CMakeFiles/cdpInternal.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/synthTraceParser.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/synthTrace.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/API/hermes/CMakeFiles/hermesapi.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/public/hermes/Public/CMakeFiles/hermesPublic.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "APITests"
+  "APITests.pdb"
+  "CMakeFiles/APITests.dir/APITest.cpp.o"
+  "CMakeFiles/APITests.dir/APITest.cpp.o.d"
+  "CMakeFiles/APITests.dir/APITestFactory.cpp.o"
+  "CMakeFiles/APITests.dir/APITestFactory.cpp.o.d"
+  "CMakeFiles/APITests.dir/AsyncDebuggerAPITest.cpp.o"
+  "CMakeFiles/APITests.dir/AsyncDebuggerAPITest.cpp.o.d"
+  "CMakeFiles/APITests.dir/CDPAgentTest.cpp.o"
+  "CMakeFiles/APITests.dir/CDPAgentTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/CDPJSONHelpers.cpp.o"
+  "CMakeFiles/APITests.dir/CDPJSONHelpers.cpp.o.d"
+  "CMakeFiles/APITests.dir/ConsoleMessageTest.cpp.o"
+  "CMakeFiles/APITests.dir/ConsoleMessageTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/DebuggerTest.cpp.o"
+  "CMakeFiles/APITests.dir/DebuggerTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/DomainStateTest.cpp.o"
+  "CMakeFiles/APITests.dir/DomainStateTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/HeapSnapshotAPITest.cpp.o"
+  "CMakeFiles/APITests.dir/HeapSnapshotAPITest.cpp.o.d"
+  "CMakeFiles/APITests.dir/SynchronizedCallbackTest.cpp.o"
+  "CMakeFiles/APITests.dir/SynchronizedCallbackTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/SynthTraceParserTest.cpp.o"
+  "CMakeFiles/APITests.dir/SynthTraceParserTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/SynthTraceSerializationTest.cpp.o"
+  "CMakeFiles/APITests.dir/SynthTraceSerializationTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/SynthTraceTest.cpp.o"
+  "CMakeFiles/APITests.dir/SynthTraceTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/TimerStatsTest.cpp.o"
+  "CMakeFiles/APITests.dir/TimerStatsTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/APITests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
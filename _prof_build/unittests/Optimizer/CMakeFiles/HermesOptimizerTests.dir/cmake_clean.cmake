@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesOptimizerTests.dir/Scalar/InstructionEscapeAnalysisTest.cpp.o"
+  "CMakeFiles/HermesOptimizerTests.dir/Scalar/InstructionEscapeAnalysisTest.cpp.o.d"
+  "HermesOptimizerTests"
+  "HermesOptimizerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesOptimizerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesParserTests.dir/JSLexerTest.cpp.o"
+  "CMakeFiles/HermesParserTests.dir/JSLexerTest.cpp.o.d"
+  "CMakeFiles/HermesParserTests.dir/JSONParserTest.cpp.o"
+  "CMakeFiles/HermesParserTests.dir/JSONParserTest.cpp.o.d"
+  "CMakeFiles/HermesParserTests.dir/JSParserTest.cpp.o"
+  "CMakeFiles/HermesParserTests.dir/JSParserTest.cpp.o.d"
+  "HermesParserTests"
+  "HermesParserTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesParserTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BCP47ParserTests"
+  "BCP47ParserTests.pdb"
+  "CMakeFiles/BCP47ParserTests.dir/BCP47ParserTest.cpp.o"
+  "CMakeFiles/BCP47ParserTests.dir/BCP47ParserTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BCP47ParserTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
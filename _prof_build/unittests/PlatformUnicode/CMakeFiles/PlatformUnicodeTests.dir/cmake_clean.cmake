@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PlatformUnicodeTests.dir/CharacterPropertyTest.cpp.o"
+  "CMakeFiles/PlatformUnicodeTests.dir/CharacterPropertyTest.cpp.o.d"
+  "CMakeFiles/PlatformUnicodeTests.dir/PlatformUnicodeTest.cpp.o"
+  "CMakeFiles/PlatformUnicodeTests.dir/PlatformUnicodeTest.cpp.o.d"
+  "PlatformUnicodeTests"
+  "PlatformUnicodeTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PlatformUnicodeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/VMRuntime/AlignedHeapSegmentTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/AlignedHeapSegmentTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/AlignedHeapSegmentTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/ArrayStorageTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ArrayStorageTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ArrayStorageTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/ArrayTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ArrayTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ArrayTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/BCProviderTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/BCProviderTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/BCProviderTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/Base64UtilTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/Base64UtilTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/Base64UtilTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/BigIntPrimitiveTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/BigIntPrimitiveTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/BigIntPrimitiveTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CallResultTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CallResultTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CallResultTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CardObjectBoundaryNCTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CardObjectBoundaryNCTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CardObjectBoundaryNCTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CardTableNCTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CardTableNCTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CardTableNCTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CastingTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CastingTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CastingTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CodeCoverageProfilerTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CodeCoverageProfilerTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CodeCoverageProfilerTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CopyableVectorTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CopyableVectorTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CopyableVectorTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/CrashManagerTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CrashManagerTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/CrashManagerTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/DateUtilTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DateUtilTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DateUtilTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/DecoratedObjectTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DecoratedObjectTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DecoratedObjectTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/DictPropertyMapTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DictPropertyMapTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/DictPropertyMapTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/FPContractTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/FPContractTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/FPContractTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCBasicsTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCBasicsTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCBasicsTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCFinalizerTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCFinalizerTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCFinalizerTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCFragmentationTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCFragmentationTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCFragmentationTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCGuardPageNCTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCGuardPageNCTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCGuardPageNCTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCInitTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCInitTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCInitTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCLazySegmentNCTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCLazySegmentNCTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCLazySegmentNCTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCOOMTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCOOMTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCOOMTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCObjectIterationTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCObjectIterationTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCObjectIterationTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCReturnUnusedMemoryTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCReturnUnusedMemoryTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCReturnUnusedMemoryTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/GCSanitizeHandlesTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCSanitizeHandlesTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/GCSanitizeHandlesTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/HandleTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HandleTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HandleTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/HeapSnapshotTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HeapSnapshotTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HeapSnapshotTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/HermesValueTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HermesValueTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HermesValueTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/HiddenClassTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HiddenClassTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/HiddenClassTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/IdentifierTableTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/IdentifierTableTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/IdentifierTableTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/InstrumentationAPITest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InstrumentationAPITest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InstrumentationAPITest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/InternalPropertiesTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InternalPropertiesTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InternalPropertiesTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/InterpreterTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InterpreterTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/InterpreterTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/JSLibTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSLibTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSLibTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/JSONParseTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSONParseTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSONParseTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/JSTypedArrayTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSTypedArrayTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/JSTypedArrayTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/MarkBitArrayNCTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/MarkBitArrayNCTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/MarkBitArrayNCTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/MetadataTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/MetadataTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/MetadataTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/NativeFrameTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeFrameTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeFrameTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/NativeFunctionTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeFunctionTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeFunctionTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/NativeStateTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeStateTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/NativeStateTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/ObjectModelTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ObjectModelTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/ObjectModelTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/OperationsTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/OperationsTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/OperationsTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/PredefinedStringsTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/PredefinedStringsTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/PredefinedStringsTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/RuntimeConfigTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/RuntimeConfigTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/RuntimeConfigTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SamplingHeapProfilerTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SamplingHeapProfilerTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SamplingHeapProfilerTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SamplingProfilerTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SamplingProfilerTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SamplingProfilerTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SegmentedArrayTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SegmentedArrayTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SegmentedArrayTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SmallHermesValueTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SmallHermesValueTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SmallHermesValueTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SmallXStringTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SmallXStringTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SmallXStringTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StackTracesTreeTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StackTracesTreeTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StackTracesTreeTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StaticBuiltinsTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StaticBuiltinsTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StaticBuiltinsTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StorageProviderTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StorageProviderTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StorageProviderTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StringBuilderTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringBuilderTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringBuilderTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StringPrimitiveTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringPrimitiveTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringPrimitiveTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/StringViewTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringViewTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/StringViewTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/SymbolIDTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SymbolIDTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/SymbolIDTest.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/TestHelpers1.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers1.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers1.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/TwineChar16Test.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/TwineChar16Test.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/TwineChar16Test.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/VMRuntimeTestHelpers.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/VMRuntimeTestHelpers.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/VMRuntimeTestHelpers.cpp.o.d"
+  "/root/repo/unittests/VMRuntime/WeakValueMapTest.cpp" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/WeakValueMapTest.cpp.o" "gcc" "unittests/VMRuntime/CMakeFiles/HermesVMRuntimeTests.dir/WeakValueMapTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/lib/CMakeFiles/hermesvm_a.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/boost/boost_1_86_0/libs/context/CMakeFiles/boost_context.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
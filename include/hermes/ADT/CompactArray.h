@@ -12,6 +12,7 @@
 #include "llvh/Support/ErrorHandling.h"
 
 #include <cassert>
+#include <cstring>
 #include <limits>
 
 namespace hermes {
@@ -38,7 +39,8 @@ class CompactArray {
   ~CompactArray() {
     ::free(raw_);
   }
-  /// swap is the only bulk transfer method.
+  /// Bulk transfer is done with swap, or with copyFrom to make copies
+  /// explicit.
   CompactArray(const CompactArray &) = delete;
   CompactArray &operator=(const CompactArray &) = delete;
   void swap(CompactArray &other) {
@@ -46,6 +48,12 @@ class CompactArray {
     std::swap(scale_, other.scale_);
     std::swap(raw_, other.raw_);
   }
+  /// Replace the contents of this array with a copy of \p other.
+  void copyFrom(const CompactArray &other) {
+    CompactArray copy(other.size_, other.scale_);
+    std::memcpy(copy.raw_, other.raw_, other.additionalMemorySize());
+    swap(copy);
+  }
   uint32_t get(uint32_t idx) const {
     assert(idx < size_);
     switch (scale_) {
@@ -124,6 +132,9 @@ class CompactTable : private CompactArray {
   void swap(CompactTable &other) {
     CompactArray::swap(other);
   }
+  void copyFrom(const CompactTable &other) {
+    CompactArray::copyFrom(other);
+  }
   bool isEmpty(uint32_t idx) const {
     return CompactArray::get(idx) == EMPTY;
   }
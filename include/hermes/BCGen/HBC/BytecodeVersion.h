@@ -19,8 +19,8 @@ namespace hermes {
 namespace hbc {
 
 // Bytecode version generated by this version of the compiler.
-// Updated: Aug 29, 2024
-const static uint32_t BYTECODE_VERSION = 98;
+// Updated: Oct 17, 2026
+const static uint32_t BYTECODE_VERSION = 101;
 
 } // namespace hbc
 } // namespace hermes
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_BCGEN_HBC_PASSES_SUPERINSTRUCTIONS_H
+#define HERMES_BCGEN_HBC_PASSES_SUPERINSTRUCTIONS_H
+
+#include "hermes/BCGen/HBC/Passes.h"
+
+namespace hermes::hbc {
+
+/// Fuse frequently executed instruction sequences into single instructions
+/// that are dispatched once by the interpreter:
+/// - A LoadParamInst whose only user is a LoadPropertyInst with a literal name
+///   becomes a HBCLoadParamPropertyInst.
+/// - A HBCGetGlobalObjectInst whose only user is a LoadPropertyInst or
+///   TryLoadGlobalPropertyInst with a literal name is folded back into the
+///   load as the GlobalObject literal, for which ISel emits GetByIdGlobal or
+///   TryGetByIdGlobal.
+/// Runs after register allocation and spilling, the fused instruction reuses
+/// the register of the instruction it replaces.
+class SuperInstructions : public FunctionPass {
+ public:
+  explicit SuperInstructions(HVMRegisterAllocator &RA)
+      : FunctionPass("SuperInstructions"), RA_(RA) {}
+
+  bool runOnFunction(Function *F) override;
+
+ private:
+  HVMRegisterAllocator &RA_;
+};
+
+} // namespace hermes::hbc
+
+#endif // HERMES_BCGEN_HBC_PASSES_SUPERINSTRUCTIONS_H
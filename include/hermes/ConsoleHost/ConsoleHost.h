@@ -145,9 +145,18 @@ struct ExecuteOptions {
   /// JIT compilation threshold.
   uint32_t jitThreshold{1 << 5};
 
+  /// Number of loop iterations in the interpreter before entering the JIT.
+  uint32_t jitOSRThreshold{1 << 10};
+
   /// JIT memory limit, after which no more code will be JIT'ed.
   uint32_t jitMemoryLimit{32u << 20};
 
+  /// JIT compile on a background thread.
+  bool jitAsync{false};
+
+  /// JIT compile speculatively based on type feedback.
+  bool jitSpeculate{false};
+
   /// Dump JIT'ed code.
   unsigned dumpJITCode{0};
 
@@ -621,6 +621,10 @@ class IRBuilder {
 
   LoadParamInst *createLoadParamInst(JSDynamicParam *param);
 
+  HBCLoadParamPropertyInst *createHBCLoadParamPropertyInst(
+      JSDynamicParam *param,
+      LiteralString *property);
+
   HBCCreateFunctionEnvironmentInst *createHBCCreateFunctionEnvironmentInst(
       VariableScope *scope,
       JSSpecialParam *parentScopeParam);
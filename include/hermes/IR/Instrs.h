@@ -4637,6 +4637,52 @@ class HBCSpillMovInst : public SingleOperandInst {
   }
 };
 
+/// Load a named property of a parameter. This is the fusion of a LoadParamInst
+/// with its only user, a LoadPropertyInst with a literal property name, and is
+/// only created after register allocation.
+class HBCLoadParamPropertyInst : public Instruction {
+  HBCLoadParamPropertyInst(const HBCLoadParamPropertyInst &) = delete;
+  void operator=(const HBCLoadParamPropertyInst &) = delete;
+
+ public:
+  enum { ParamIdx, PropertyIdx };
+
+  explicit HBCLoadParamPropertyInst(
+      JSDynamicParam *param,
+      LiteralString *property)
+      : Instruction(ValueKind::HBCLoadParamPropertyInstKind) {
+    pushOperand(param);
+    pushOperand(property);
+  }
+  explicit HBCLoadParamPropertyInst(
+      const HBCLoadParamPropertyInst *src,
+      llvh::ArrayRef<Value *> operands)
+      : Instruction(src, operands) {}
+
+  JSDynamicParam *getParam() const {
+    return cast<JSDynamicParam>(getOperand(ParamIdx));
+  }
+  LiteralString *getProperty() const {
+    return cast<LiteralString>(getOperand(PropertyIdx));
+  }
+
+  static bool hasOutput() {
+    return true;
+  }
+  static bool isTyped() {
+    return false;
+  }
+
+  SideEffect getSideEffectImpl() const {
+    return SideEffect::createExecute();
+  }
+
+  static bool classof(const Value *V) {
+    ValueKind kind = V->getKind();
+    return kind == ValueKind::HBCLoadParamPropertyInstKind;
+  }
+};
+
 class HBCCompareBranchInst : public TerminatorInst {
   HBCCompareBranchInst(const HBCCompareBranchInst &) = delete;
   void operator=(const HBCCompareBranchInst &) = delete;
@@ -72,6 +72,9 @@ struct BytecodeGenerationOptions {
   /// Whether to run the HBC ReorderRegisters pass.
   bool reorderRegisters = true;
 
+  /// Whether to fuse common instruction sequences into superinstructions.
+  bool superInstructions = false;
+
   /// Add this much garbage after each function body (relative to its size).
   unsigned padFunctionBodiesPercent = 0;
 
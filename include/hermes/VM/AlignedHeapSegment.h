@@ -389,6 +389,16 @@ class AlignedHeapSegment {
     markBits->set(ind, true);
   }
 
+  /// Mark the given \p cell atomically with respect to other threads marking
+  /// cells in the same segment. Assumes the given address is a valid heap
+  /// object.
+  /// \return true if the cell was already marked.
+  static bool atomicTestAndSetCellMarkBit(const GCCell *cell) {
+    auto *markBits = markBitArrayCovering(cell);
+    size_t ind = addressToMarkBitArrayIndex(cell);
+    return markBits->atomicTestAndSet(ind);
+  }
+
   /// Return whether the given \p cell is marked. Assumes the given address is
   /// a valid heap object.
   static bool getCellMarkBit(const GCCell *cell) {
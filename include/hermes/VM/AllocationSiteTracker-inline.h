@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_ALLOCATIONSITETRACKER_INLINE_H
+#define HERMES_VM_ALLOCATIONSITETRACKER_INLINE_H
+
+#include "hermes/VM/AllocationSiteTracker.h"
+
+#include "hermes/VM/CodeBlock.h"
+
+namespace hermes {
+namespace vm {
+
+inline LongLived AllocationSiteTracker::beginAllocation(
+    CodeBlock *codeBlock,
+    const inst::Inst *ip) {
+  if (LLVM_LIKELY(!enabled_))
+    return LongLived::No;
+  if (LLVM_UNLIKELY(--sampleCountdown_ == 0)) {
+    // Sampled objects always go in the young gen, otherwise a pretenured site
+    // could never find out that its objects stopped surviving.
+    sampleAllocation(codeBlock, ip);
+    return LongLived::No;
+  }
+  // The common case is that no site is pretenured, which only needs the
+  // decrement above.
+  if (LLVM_LIKELY(numPretenuredSites_ == 0))
+    return LongLived::No;
+  return codeBlock->isPretenuredSite(codeBlock->getOffsetOf(ip))
+      ? LongLived::Yes
+      : LongLived::No;
+}
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_ALLOCATIONSITETRACKER_INLINE_H
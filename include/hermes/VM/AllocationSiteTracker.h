@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_ALLOCATIONSITETRACKER_H
+#define HERMES_VM_ALLOCATIONSITETRACKER_H
+
+#include "hermes/Inst/Inst.h"
+#include "hermes/VM/AllocOptions.h"
+
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/Support/Compiler.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+class CodeBlock;
+class GCCell;
+class RuntimeModule;
+
+/// Decides which allocation sites should allocate their objects directly in
+/// the old generation ("pretenuring"). An allocation site is an allocating
+/// instruction, identified by its CodeBlock and bytecode offset.
+///
+/// Every kSampleInterval-th allocation made through the tracker is sampled:
+/// the allocated cell is remembered together with its site, and at the end of
+/// the next young gen collection the GC reports whether the cell survived.
+/// Once a site has accumulated enough samples, it is pretenured if nearly all
+/// of them survived, or goes back to young gen allocation if most of them
+/// died. Sampled objects are always allocated in the young gen, so pretenured
+/// sites keep being measured and the decision can be reverted when the
+/// program changes phase.
+///
+/// The decision for each site is mirrored in its CodeBlock, so that
+/// allocations that are not sampled never look up the site itself. Sites live
+/// as long as the runtime module of their CodeBlock, which must call
+/// removeSites when it is destroyed. Samples are weak: they are only valid
+/// until the end of the next young gen collection, and the GC must drop them
+/// if that collection does not evacuate the young gen.
+class AllocationSiteTracker {
+ public:
+  /// Number of allocations between two samples.
+  static constexpr uint32_t kSampleInterval = 64;
+
+  /// Number of samples a site needs before a decision is made about it.
+  static constexpr uint32_t kMinSamples = 16;
+
+  explicit AllocationSiteTracker(bool enabled) : enabled_(enabled) {}
+
+  bool isEnabled() const {
+    return enabled_;
+  }
+
+  /// Called before the instruction at \p ip in \p codeBlock allocates an
+  /// object. If the allocation is sampled, the cell must then be passed to
+  /// recordAllocation.
+  /// \return LongLived::Yes if the object should be allocated directly in the
+  ///   old generation.
+  /// Defined in AllocationSiteTracker-inline.h.
+  inline LongLived beginAllocation(CodeBlock *codeBlock, const inst::Inst *ip);
+
+  /// Called with the cell allocated after beginAllocation.
+  void recordAllocation(GCCell *cell) {
+    if (LLVM_UNLIKELY(pendingSite_ != kNoSite)) {
+      samples_.push_back({cell, pendingSite_});
+      pendingSite_ = kNoSite;
+    }
+  }
+
+  /// Called instead of recordAllocation when the allocation following
+  /// beginAllocation failed.
+  void abandonAllocation() {
+    pendingSite_ = kNoSite;
+  }
+
+  /// Forget all sites in the CodeBlocks of \p runtimeModule, which is being
+  /// destroyed.
+  void removeSites(const RuntimeModule *runtimeModule);
+
+  /// Called by the GC at the end of a young gen collection, before the young
+  /// gen is reused. \p survived is called on every sampled cell and must
+  /// return whether the cell is still alive after the collection.
+  template <typename Fn>
+  void updateSurvivalRates(Fn survived) {
+    for (const Sample &sample : samples_) {
+      Site &site = sites_[sample.site];
+      ++site.numSampled;
+      if (survived(sample.cell))
+        ++site.numSurvived;
+      if (site.numSampled >= kMinSamples)
+        decide(site);
+    }
+    samples_.clear();
+  }
+
+  /// Forget all samples without using them, for young gen collections that
+  /// do not tell which cells survived.
+  void clearSamples() {
+    samples_.clear();
+    pendingSite_ = kNoSite;
+  }
+
+  /// \return the number of sites that currently allocate in the old
+  ///   generation.
+  uint32_t numPretenuredSites() const {
+    return numPretenuredSites_;
+  }
+
+ private:
+  /// Index of a site in sites_.
+  using SiteIndex = uint32_t;
+  static constexpr SiteIndex kNoSite = UINT32_MAX;
+
+  struct Site {
+    /// The allocating instruction.
+    CodeBlock *codeBlock;
+    uint32_t offset;
+    /// The runtime module that owns codeBlock.
+    const RuntimeModule *runtimeModule;
+    /// Number of samples taken since the last decision.
+    uint32_t numSampled{0};
+    /// Number of those samples that survived a young gen collection.
+    uint32_t numSurvived{0};
+    /// Whether objects from this site are allocated in the old generation.
+    bool pretenured{false};
+  };
+
+  struct Sample {
+    GCCell *cell;
+    SiteIndex site;
+  };
+
+  /// Take a sample of the allocation made by the instruction at \p ip in
+  /// \p codeBlock.
+  void sampleAllocation(CodeBlock *codeBlock, const inst::Inst *ip);
+
+  /// Pretenure \p site or revert it to young gen allocation according to its
+  /// survival rate, and start a new measurement period.
+  void decide(Site &site);
+
+  /// Whether pretenuring is enabled at all.
+  const bool enabled_;
+
+  /// Allocations left until the next sample.
+  uint32_t sampleCountdown_{kSampleInterval};
+
+  /// Number of sites in sites_ with pretenured set.
+  uint32_t numPretenuredSites_{0};
+
+  /// The site of a sampled allocation between beginAllocation and
+  /// recordAllocation, or kNoSite.
+  SiteIndex pendingSite_{kNoSite};
+
+  std::vector<Site> sites_;
+
+  /// Maps a CodeBlock and bytecode offset to the index of its site. The
+  /// CodeBlock is only used for its address.
+  llvh::DenseMap<std::pair<const void *, uint32_t>, SiteIndex> siteIndices_;
+
+  /// Cells sampled since the last young gen collection.
+  std::vector<Sample> samples_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_ALLOCATIONSITETRACKER_H
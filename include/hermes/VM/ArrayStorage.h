@@ -148,10 +148,10 @@ class ArrayStorageBase final
   }
 
   /// \return the element at index \p index
-  template <Inline inl = Inline::No>
+  template <Inline inl = Inline::No, typename NeedsBarriers = std::true_type>
   void set(size_type index, HVType val, GC &gc) {
     assert(index < size() && "index out of range");
-    data()[index].set(val, gc);
+    data()[index].template set<NeedsBarriers>(val, gc);
   }
 
   /// \return the element at index \p index
@@ -161,6 +161,18 @@ class ArrayStorageBase final
     data()[index].setNonPtr(val, gc);
   }
 
+  /// Set the element at index \p index to \p val, skipping the write barrier
+  /// when neither the old nor the new value is a pointer and the old value is
+  /// not a symbol.
+  void setWithBarrierIfNeeded(size_type index, HVType val, GC &gc) {
+    assert(index < size() && "index out of range");
+    auto &ref = data()[index];
+    if (!val.isPointer() && !ref.isPointer() && !ref.isSymbol())
+      ref.template set<std::false_type>(val, gc);
+    else
+      ref.set(val, gc);
+  }
+
   size_type capacity() const {
     return capacityForAllocationSize(getAllocatedSize());
   }
@@ -1089,6 +1089,14 @@ class JSFunction : public Callable {
       JITCompiledFunctionPtr functionPtr,
       Runtime &runtime);
 
+  /// Transfer the interpreter frame of the current function into its native
+  /// code through \p osrEntryPtr, which resumes at the loop header stored in
+  /// runtime.currentIP. The frame is popped when the function returns or
+  /// throws.
+  static CallResult<HermesValue> _jittedOSREntry(
+      JITCompiledFunctionPtr osrEntryPtr,
+      Runtime &runtime);
+
   /// Create a Function with no environment and a CodeBlock simply returning
   /// undefined, with the prototype property auto-initialized to new Object().
   static PseudoHandle<JSFunction> create(
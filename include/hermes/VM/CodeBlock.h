@@ -17,6 +17,7 @@
 #include "hermes/VM/IdentifierTable.h"
 #include "hermes/VM/Profiler.h"
 #include "hermes/VM/PropertyCache.h"
+#include "llvh/ADT/BitVector.h"
 #include "llvh/ADT/DenseSet.h"
 #include "llvh/ADT/Optional.h"
 #include "llvh/Support/TrailingObjects.h"
@@ -65,10 +66,32 @@ class CodeBlock final : private llvh::TrailingObjects<
   /// If this CodeBlock was compiled, a pointer to the body.
   JITCompiledFunctionPtr JITCompiled_ = nullptr;
 
+  /// If this CodeBlock was compiled and contains loops, the entry point used
+  /// to transfer an interpreter frame into the native code at a loop header.
+  JITCompiledFunctionPtr JITOSREntry_ = nullptr;
+
   /// Function execution count.
   /// Ideally, a function's hotness should also include if it has a loop and how
   /// hot that loop is.
   uint32_t executionCount_ = 0;
+
+  /// Number of backward branches taken by the interpreter in this function.
+  uint32_t backEdgeCount_ = 0;
+
+  /// Set while this CodeBlock is waiting to be compiled in the background.
+  bool JITQueued_ = false;
+
+  /// Set once the JIT code cache has been searched for this CodeBlock.
+  bool JITCacheChecked_ = false;
+
+  /// Number of times the native code of this function had to continue in the
+  /// interpreter because a speculation failed.
+  uint32_t deoptCount_ = 0;
+
+  /// Type feedback: one bit per bytecode offset, set for the arithmetic
+  /// instructions that the interpreter executed with operands that were not
+  /// both numbers. Empty until the first such instruction is recorded.
+  llvh::BitVector nonNumberSites_{};
 #endif
 
 #ifdef HERMES_ENABLE_DEBUGGER
@@ -76,6 +99,11 @@ class CodeBlock final : private llvh::TrailingObjects<
   uint32_t numInstalledBreakpoints_ = 0;
 #endif
 
+  /// One bit per bytecode offset, set for the allocating instructions whose
+  /// objects are allocated directly in the old generation. Maintained by the
+  /// AllocationSiteTracker. Empty until the first site is pretenured.
+  llvh::BitVector pretenuredSites_{};
+
   /// Total size of the property caches.
   const uint32_t readPropertyCacheSize_;
   const uint32_t writePropertyCacheSize_;
@@ -213,6 +241,20 @@ class CodeBlock final : private llvh::TrailingObjects<
     return offset;
   }
 
+  /// \return whether the allocating instruction at \p offset allocates its
+  ///   objects directly in the old generation.
+  bool isPretenuredSite(uint32_t offset) const {
+    return offset < pretenuredSites_.size() && pretenuredSites_.test(offset);
+  }
+
+  /// Set whether the allocating instruction at \p offset allocates its
+  /// objects directly in the old generation.
+  void setPretenuredSite(uint32_t offset, bool pretenured) {
+    if (LLVM_UNLIKELY(pretenuredSites_.empty()))
+      pretenuredSites_.resize(functionHeader_.getBytecodeSizeInBytes());
+    pretenuredSites_[offset] = pretenured;
+  }
+
   /// Checks whether this function is lazily compiled.
   bool isLazy() const {
     return !bytecode_;
@@ -273,6 +315,70 @@ class CodeBlock final : private llvh::TrailingObjects<
   void clearExecutionCount() {
     executionCount_ = 0;
   }
+
+  /// \return the on-stack replacement entry of the native code for this
+  ///   function, or null if there is none.
+  JITCompiledFunctionPtr getJITOSREntry() const {
+    return JITOSREntry_;
+  }
+
+  /// Set the on-stack replacement entry of the native code for this function.
+  void setJITOSREntry(JITCompiledFunctionPtr JITOSREntry) {
+    JITOSREntry_ = JITOSREntry;
+  }
+
+  /// Increment the backward branch count and \return the new value.
+  uint32_t incrementBackEdgeCount() {
+    return ++backEdgeCount_;
+  }
+
+  /// \return true if this CodeBlock is waiting to be compiled in the
+  ///   background.
+  bool getJITQueued() const {
+    return JITQueued_;
+  }
+
+  /// Record whether this CodeBlock is waiting to be compiled in the
+  /// background.
+  void setJITQueued(bool queued) {
+    JITQueued_ = queued;
+  }
+
+  /// \return true if the JIT code cache has been searched for this CodeBlock.
+  bool getJITCacheChecked() const {
+    return JITCacheChecked_;
+  }
+
+  /// Record that the JIT code cache has been searched for this CodeBlock.
+  void setJITCacheChecked() {
+    JITCacheChecked_ = true;
+  }
+
+  /// Increment the deoptimization count and \return the new value.
+  uint32_t incrementDeoptCount() {
+    return ++deoptCount_;
+  }
+
+  /// \return the number of times the native code of this function
+  ///   deoptimized.
+  uint32_t getDeoptCount() const {
+    return deoptCount_;
+  }
+
+  /// Record that the arithmetic instruction at \p offset was executed with
+  /// operands that were not both numbers.
+  void recordNonNumberOperands(uint32_t offset) {
+    if (LLVM_UNLIKELY(nonNumberSites_.empty()))
+      nonNumberSites_.resize(functionHeader_.getBytecodeSizeInBytes());
+    nonNumberSites_.set(offset);
+  }
+
+  /// \return a bit vector indexed by bytecode offset, with the bits of the
+  ///   arithmetic instructions that were executed with operands that were not
+  ///   both numbers set. It is empty if there are none.
+  const llvh::BitVector &getNonNumberSites() const {
+    return nonNumberSites_;
+  }
 #else
   /// \return true if JIT is disabled for this function.
   bool getDontJIT() const {
@@ -301,6 +407,19 @@ class CodeBlock final : private llvh::TrailingObjects<
 
   /// Reset the function executionCount_ count to 0
   void clearExecutionCount() {}
+
+  /// \return the on-stack replacement entry, always null without the JIT.
+  JITCompiledFunctionPtr getJITOSREntry() const {
+    return nullptr;
+  }
+
+  /// Set the on-stack replacement entry of the native code for this function.
+  void setJITOSREntry(JITCompiledFunctionPtr JITOSREntry) {}
+
+  /// Increment the backward branch count, always 0 without the JIT.
+  uint32_t incrementBackEdgeCount() {
+    return 0;
+  }
 #endif
 
   inline ReadPropertyCacheEntry *getReadCacheEntry(uint8_t idx) {
@@ -18,6 +18,7 @@
 #include "hermes/Support/OSCompat.h"
 #include "hermes/Support/StatsAccumulator.h"
 #include "hermes/VM/AllocOptions.h"
+#include "hermes/VM/AllocationSiteTracker.h"
 #include "hermes/VM/BuildMetadata.h"
 #include "hermes/VM/CellKind.h"
 #include "hermes/VM/CompressedPointer.h"
@@ -1029,6 +1030,28 @@ class GCBase {
   /// logging.
   virtual void collect(std::string cause, bool canEffectiveOOM = false) = 0;
 
+  /// Force a garbage collection cycle, then move objects out of parts of the
+  /// heap that are less than \p maxOccupancy full, so that their memory can be
+  /// returned to the OS. GCs that don't move objects only collect.
+  virtual void compact(std::string cause, double maxOccupancy) {
+    collect(std::move(cause));
+  }
+
+  /// Tell the GC that the embedder expects to be idle for \p budget, so that
+  /// collection work that would otherwise interrupt it later can be done now.
+  /// This also ends a busy period started by notifyBusy.
+  virtual void notifyIdle(std::chrono::milliseconds budget) {}
+
+  /// Tell the GC that the embedder is busy until the next call to notifyIdle,
+  /// so that collection work that isn't needed yet should be deferred.
+  virtual void notifyBusy() {}
+
+  /// Set how much memory pressure the process is under, from 0 (none) to 1
+  /// (critical), for instance from the cgroup's memory.pressure. The GC keeps
+  /// the heap smaller under pressure, and lets it grow again for throughput
+  /// once the pressure goes down. The default does nothing.
+  virtual void setMemoryPressure(double pressure) {}
+
   /// Iterate over all objects in the heap, and call \p callback on them.
   /// \param callback A function to call on each found object.
   virtual void forAllObjs(const std::function<void(GCCell *)> &callback) = 0;
@@ -1230,6 +1253,10 @@ class GCBase {
     return idTracker_;
   }
 
+  AllocationSiteTracker &getAllocationSites() {
+    return allocationSites_;
+  }
+
 #ifdef HERMES_MEMORY_INSTRUMENTATION
   AllocationLocationTracker &getAllocationLocationTracker() {
     return allocationLocationTracker_;
@@ -1481,6 +1508,9 @@ class GCBase {
   /// snapshots and the memory profiler.
   IDTracker idTracker_;
 
+  /// Decides which allocation sites allocate directly in the old generation.
+  AllocationSiteTracker allocationSites_;
+
 #ifdef HERMES_MEMORY_INSTRUMENTATION
   /// Attaches stack-traces to objects when enabled.
   AllocationLocationTracker allocationLocationTracker_;
@@ -15,9 +15,11 @@
 #include "hermes/VM/VTable.h"
 #include "hermes/VM/sh_mirror.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace hermes {
 namespace vm {
@@ -218,6 +220,36 @@ class GCCell {
     return isMarked();
   }
 
+  /// Variants of the functions above for when several threads may try to
+  /// forward this cell at the same time.
+
+  /// \return the forwarding pointer in this cell if one has been set,
+  ///   otherwise null, in which case \p kindAndSize is set to the header of
+  ///   this cell.
+  /// NOTE: this should only be used by the GC.
+  CompressedPointer loadMarkedForwardingPointer(
+      KindAndSize &kindAndSize) const {
+    const CompressedPointer::RawType raw =
+        header().load(std::memory_order_acquire);
+    if (raw & 0x1)
+      return CompressedPointer::fromRaw(raw - 0x1);
+    std::memcpy(&kindAndSize, &raw, sizeof(raw));
+    return CompressedPointer(nullptr);
+  }
+
+  /// Set a marked forwarding pointer to \p cell in this cell, unless its
+  /// header is no longer \p kindAndSize because another thread set one first.
+  /// \return true if the forwarding pointer was set.
+  /// NOTE: this should only be used by the GC.
+  bool tryInstallMarkedForwardingPointer(
+      KindAndSize kindAndSize,
+      CompressedPointer cell) {
+    CompressedPointer::RawType expected;
+    std::memcpy(&expected, &kindAndSize, sizeof(expected));
+    return header().compare_exchange_strong(
+        expected, cell.getRaw() | 0x1, std::memory_order_acq_rel);
+  }
+
   const GCCell *nextCell() const {
     return reinterpret_cast<const GCCell *>(
         reinterpret_cast<const char *>(this) + getAllocatedSize());
@@ -277,6 +309,20 @@ class GCCell {
     return forwardingPointer_.getRaw() & 0x1;
   }
 
+ private:
+  /// \return the header word of this cell, for atomic accesses.
+  std::atomic<CompressedPointer::RawType> &header() const {
+    static_assert(
+        sizeof(KindAndSize) == sizeof(CompressedPointer::RawType) &&
+            sizeof(std::atomic<CompressedPointer::RawType>) ==
+                sizeof(CompressedPointer::RawType),
+        "The header must be accessible as a single atomic word");
+    return *reinterpret_cast<std::atomic<CompressedPointer::RawType> *>(
+        const_cast<AssignableCompressedPointer *>(&forwardingPointer_));
+  }
+
+ public:
+
   static constexpr uint32_t maxSize() {
     return KindAndSize::maxSize();
   }
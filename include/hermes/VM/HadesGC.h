@@ -20,6 +20,7 @@
 #include "llvh/Support/ErrorOr.h"
 #include "llvh/Support/PointerLikeTypeTraits.h"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -27,7 +28,6 @@
 #include <future>
 #include <memory>
 #include <mutex>
-#include <stack>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -130,6 +130,28 @@ class HadesGC final : public GCBase {
   /// (Part of general GC API defined in GCBase.h).
   void collect(std::string cause, bool canEffectiveOOM = false) override;
 
+  /// Collect, then compact every OG segment that is less than \p maxOccupancy
+  /// full, and return their memory to the StorageProvider. Each compacted
+  /// segment needs its own OG collection, so this is meant for idle periods.
+  /// (Part of general GC API defined in GCBase.h).
+  void compact(std::string cause, double maxOccupancy) override;
+
+  /// Collect the YG if it is filling up and a collection is expected to fit
+  /// in \p budget, and start the OG collection somewhat early. In incremental
+  /// mode, the rest of the budget goes to OG marking and sweeping.
+  /// (Part of general GC API defined in GCBase.h).
+  void notifyIdle(std::chrono::milliseconds budget) override;
+
+  /// Start OG collections later than usual until the next notifyIdle.
+  /// (Part of general GC API defined in GCBase.h).
+  void notifyBusy() override;
+
+  /// Raise the OG occupancy target with \p pressure, so the OG shrinks, and
+  /// from moderate pressure on finish any ongoing collection and release empty
+  /// OG segments. Critical pressure also compacts sparse segments.
+  /// (Part of general GC API defined in GCBase.h).
+  void setMemoryPressure(double pressure) override;
+
   /// Run the finalizers for all heap objects.
   void finalizeAll() override;
 
@@ -310,6 +332,48 @@ class HadesGC final : public GCBase {
   /// cleaned.
   llvh::ErrorOr<size_t> getVMFootprintForTest() const;
 
+#ifdef UNIT_TEST
+  /// Start an OG collection and call \p fn before the background thread can
+  /// mark anything, then finish the collection on the mutator.
+  template <typename Fn>
+  void whileMarkingForTest(Fn fn) {
+    auto lk = ensureBackgroundTaskPaused();
+    waitForCollectionToFinish("test");
+    youngGenCollection("test", /*forceOldGenCollection*/ true);
+    fn();
+    waitForCollectionToFinish("test");
+  }
+
+  /// Start an OG collection and run it on the mutator up to the sweep phase,
+  /// then call \p fn before the background thread can sweep anything. The
+  /// background thread resumes the collection once \p fn returns.
+  template <typename Fn>
+  void whileSweepingForTest(Fn fn) {
+    auto lk = ensureBackgroundTaskPaused();
+    waitForCollectionToFinish("test");
+    youngGenCollection("test", /*forceOldGenCollection*/ true);
+    {
+      GCCycle cycle{*this, "test"};
+      while (concurrentPhase_ != Phase::Sweep)
+        incrementalCollect(false);
+    }
+    fn();
+  }
+
+  /// \return whether an OG collection is sweeping.
+  bool isSweepingForTest() {
+    auto lk = ensureBackgroundTaskPaused();
+    return concurrentPhase_ == Phase::Sweep;
+  }
+
+  /// \return the number of OG segments the current collection has left to
+  ///   sweep.
+  size_t sweepSegmentsRemainingForTest() {
+    auto lk = ensureBackgroundTaskPaused();
+    return oldGen_.sweepSegmentsRemaining();
+  }
+#endif
+
 #ifndef NDEBUG
   /// \name Debug APIs
   /// \{
@@ -353,6 +417,10 @@ class HadesGC final : public GCBase {
   class MarkWeakRootsAcceptor;
   class OldGen;
   class Executor;
+  class HelperThreadPool;
+  struct ParallelMarkState;
+  class PromotionBuffer;
+  struct ParallelEvacState;
 
   struct CopyListCell final : public GCCell {
     // Linked list of cells pointing to the next cell that was copied.
@@ -391,9 +459,22 @@ class HadesGC final : public GCBase {
     /// \return the segment that was removed.
     FixedSizeHeapSegment popSegment();
 
+    /// Remove the segment at index \p i from the OG. The last segment takes
+    /// its place.
+    /// \return the segment that was removed.
+    FixedSizeHeapSegment removeSegment(size_t i);
+
+    /// \return the number of bytes in the segment at index \p i that are not
+    ///   on a free list. This is only accurate once sweeping is done.
+    uint64_t allocatedBytesInSegment(size_t i) const;
+
     /// Indicate that OG should target having a size of \p targetSizeBytes.
     void setTargetSizeBytes(size_t targetSizeBytes);
 
+    /// Lower the target size to \p targetSizeBytes right away, instead of
+    /// averaging it in at the end of the next collection.
+    void shrinkTargetSizeBytes(size_t targetSizeBytes);
+
     /// Allocate into OG. Returns a pointer to the newly allocated space. That
     /// space must be filled before releasing the gcMutex_.
     /// \return A non-null pointer to memory in the old gen that should have a
@@ -402,6 +483,17 @@ class HadesGC final : public GCBase {
     /// \post This function either successfully allocates, or reports OOM.
     GCCell *alloc(uint32_t sz);
 
+    /// Allocate into OG on behalf of a PromotionBuffer. Unlike alloc, this
+    /// never waits for a collection to finish, and grows the OG regardless of
+    /// the maximum heap size, which the caller must have checked beforehand.
+    /// \param mayGrow if false, only free space in the existing segments is
+    ///   used, and null is returned if there is none.
+    /// \pre If the YG is evacuated in parallel, the lock of the
+    ///   ParallelEvacState must be held.
+    /// \post If mayGrow is true, this function either successfully allocates,
+    ///   or reports OOM.
+    GCCell *allocForEvacuation(uint32_t sz, bool mayGrow);
+
     /// \return the total number of bytes that are in use by the OG section of
     /// the JS heap, including any bytes allocated in a pending compactee, and
     /// excluding free list entries.
@@ -689,6 +781,57 @@ class HadesGC final : public GCBase {
     bool empty();
   };
 
+  /// A stack of marked cells whose fields haven't been visited yet, owned by a
+  /// single marking thread. The owner pushes and pops without synchronization,
+  /// and moves batches of cells to a shared list when other marking threads
+  /// have run out of work, so that they can steal them.
+  class MarkStack {
+    /// Cells that only the owner may access.
+    std::vector<GCCell *> cells_;
+
+    /// Mutex protecting batches_.
+    Mutex mtx_;
+
+    /// Batches of cells that any marking thread may take.
+    std::vector<std::vector<GCCell *>> batches_;
+
+    /// The size of batches_, which can be read without holding mtx_.
+    AtomicIfConcurrentGC<size_t> numBatches_{0};
+
+   public:
+    /// The maximum number of cells moved to a batch at once.
+    static constexpr size_t kMaxBatchSize = 256;
+
+    void push(GCCell *cell) {
+      cells_.push_back(cell);
+    }
+
+    /// Remove the most recently pushed cell, taking back a shared batch if
+    /// there is nothing else left. Can only be called by the owner.
+    /// \return the cell, or null if the stack is empty.
+    GCCell *pop();
+
+    /// Move up to half of the cells, and at most kMaxBatchSize, to a batch
+    /// that other threads may steal, unless there is already one. Can only be
+    /// called by the owner.
+    void share();
+
+    /// Move a shared batch of this stack to the stack of \p thief.
+    /// \return true if a batch was taken.
+    bool stealInto(MarkStack &thief);
+
+    /// \return true if there is a batch other threads may steal.
+    bool hasSharedWork() const {
+      return numBatches_.load(std::memory_order_relaxed);
+    }
+
+    /// \return true if the stack has no cells. Can only be called by the owner
+    ///   or while no other thread is marking.
+    bool empty() const {
+      return cells_.empty() && !hasSharedWork();
+    }
+  };
+
   /// The maximum number of bytes that the heap can hold. Once this amount has
   /// been filled up, OOM will occur.
   const uint64_t maxHeapSize_;
@@ -723,6 +866,19 @@ class HadesGC final : public GCBase {
   static constexpr double kYGInitialSizeFactor = 0.5;
   double ygSizeFactor_{kYGInitialSizeFactor};
 
+  /// The pause time in milliseconds that the YG size, the incremental OG work
+  /// done in a YG collection, and compactions are tuned to stay under.
+  const unsigned targetMaxPauseMs_;
+
+  /// The number of mutator pauses whose duration falls in each bucket. Bucket
+  /// 0 counts pauses shorter than 1ms, and bucket i > 0 counts pauses of
+  /// [2^(i-1), 2^i) ms. The last bucket also counts every longer pause.
+  static constexpr size_t kNumPauseBuckets = 12;
+  std::array<uint64_t, kNumPauseBuckets> pauseHistogram_{};
+
+  /// The number of mutator pauses longer than targetMaxPauseMs_.
+  uint64_t numPausesOverTarget_{0};
+
   /// oldGen_ is a free list space, so it needs a different segment
   /// representation.
   /// Protected by gcMutex_.
@@ -765,10 +921,25 @@ class HadesGC final : public GCBase {
 
   /// State that needs to be maintained while we are marking the old gen.
   struct MarkState {
-    /// A worklist local to the marking thread, that is only pushed onto by the
-    /// marking thread. If this is empty, the global worklist must be consulted
-    /// to ensure that pointers modified in write barriers are handled.
-    std::stack<GCCell *, std::vector<GCCell *>> localWorklist;
+    /// A worklist local to the thread holding gcMutex_ while marking. If this
+    /// is empty, the global worklist must be consulted to ensure that pointers
+    /// modified in write barriers are handled.
+    MarkStack localWorklist;
+
+    /// State of a thread that helps the thread holding gcMutex_ with marking.
+    struct Helper {
+      /// The worklist of this thread. Other threads may steal from it.
+      MarkStack worklist;
+
+      /// The symbols marked by this thread, merged into markedSymbols once
+      /// marking is complete.
+      llvh::BitVector markedSymbols;
+
+      explicit Helper(size_t numSymbols) : markedSymbols(numSymbols) {}
+    };
+
+    /// One entry per thread of helperThreadPool_ that helps with marking.
+    std::vector<std::unique_ptr<Helper>> helpers;
 
     /// A worklist that other threads may add to as objects to be marked and
     /// considered alive. These objects will *not* have their mark bits set,
@@ -798,8 +969,27 @@ class HadesGC final : public GCBase {
     /// The number of bytes that have been marked so far.
     uint64_t markedBytes{0};
 
-    explicit MarkState(size_t numSymbols)
-        : markedSymbols(numSymbols), writeBarrierMarkedSymbols(numSymbols) {}
+    MarkState(size_t numSymbols, unsigned numHelpers)
+        : markedSymbols(numSymbols), writeBarrierMarkedSymbols(numSymbols) {
+      for (unsigned i = 0; i < numHelpers; ++i)
+        helpers.push_back(std::make_unique<Helper>(numSymbols));
+    }
+
+    /// \return the worklist of marking thread \p idx, where 0 is the thread
+    ///   holding gcMutex_ and the rest are the helpers.
+    MarkStack &worklist(unsigned idx) {
+      return idx ? helpers[idx - 1]->worklist : localWorklist;
+    }
+
+    /// \return true if any marking thread has cells left to visit. Can only be
+    ///   called while no other thread is marking.
+    bool hasLocalWork() {
+      for (unsigned i = 0, e = helpers.size(); i <= e; ++i) {
+        if (!worklist(i).empty())
+          return true;
+      }
+      return false;
+    }
   };
 
   /// Store the mark state as an optional so it is convenient to create and
@@ -811,6 +1001,16 @@ class HadesGC final : public GCBase {
   /// concurrently with the mutator.
   std::unique_ptr<Executor> backgroundExecutor_;
 
+  /// The number of threads from helperThreadPool_ to use for marking.
+  const unsigned numMarkHelpers_;
+
+  /// The number of threads from helperThreadPool_ to use for YG evacuation.
+  const unsigned numEvacuationHelpers_;
+
+  /// Threads that help whichever thread holds gcMutex_ with marking and YG
+  /// evacuation. Null if both are done by a single thread.
+  std::unique_ptr<HelperThreadPool> helperThreadPool_;
+
   /// True from the time the background task is created, to the time it exits
   /// the collection loop. False otherwise. Protected by gcMutex_.
   bool backgroundTaskActive_{false};
@@ -825,13 +1025,23 @@ class HadesGC final : public GCBase {
   /// at the end of each YG collection.
   bool overwriteDeadYGObjects_;
 
-  /// Target OG occupancy ratio at the end of an OG collection.
+  /// Target OG occupancy ratio at the end of an OG collection, when there is
+  /// no memory pressure. Use occupancyTarget() instead.
   const double occupancyTarget_;
 
+  /// The memory pressure set by setMemoryPressure, between 0 and 1.
+  double memoryPressure_{0};
+
   /// The threshold, expressed as the occupied fraction of the target OG size,
   /// at which we should start an OG collection.
   ExponentialMovingAverage ogThreshold_{0.5, 0.75};
 
+  /// Set by notifyBusy, and cleared by notifyIdle.
+  bool mutatorBusy_{false};
+
+  /// True while notifyIdle is running a YG collection.
+  bool inIdleCollection_{false};
+
   /// A collection section used to track the size of YG before and after a YG
   /// collection, as well as the time a YG collection takes.
   std::unique_ptr<CollectionStats> ygCollectionStats_;
@@ -848,6 +1058,10 @@ class HadesGC final : public GCBase {
   /// each YG collection.
   ExponentialMovingAverage ygAverageSurvivalBytes_;
 
+  /// The weighted average of the number of bytes evacuated per millisecond of
+  /// a YG collection. Used to estimate the pause time of a compaction.
+  ExponentialMovingAverage ygEvacuatedBytesPerMs_;
+
   /// The amount of bytes of external memory credited to objects in the YG.
   /// Only accessible to the mutator.
   uint64_t ygExternalBytes_{0};
@@ -919,6 +1133,10 @@ class HadesGC final : public GCBase {
   /// The number of compactions this GC has performed.
   size_t numCompactions_{0};
 
+  /// The OG segment that the next OG collection should compact, set by
+  /// compact. Null lets prepareCompactee decide on its own.
+  const FixedSizeHeapSegment *requestedCompactee_{nullptr};
+
   struct NativeIDs {
     HeapSnapshot::NodeID ygFinalizables{IDTracker::kInvalidNode};
     HeapSnapshot::NodeID og{IDTracker::kInvalidNode};
@@ -952,8 +1170,29 @@ class HadesGC final : public GCBase {
   ///   allocations.
   void youngGenCollection(std::string cause, bool forceOldGenCollection);
 
-  template <typename Acceptor>
-  void youngGenEvacuateImpl(Acceptor &acceptor, bool doCompaction);
+  template <bool CompactionEnabled>
+  void youngGenEvacuateImpl(
+      EvacAcceptor<CompactionEnabled> &acceptor,
+      bool doCompaction);
+
+  /// \return whether the OG can grow enough to hold every cell that may be
+  ///   promoted from the YG, along with the unused ends of \p numBuffers
+  ///   promotion buffers, without exceeding the maximum heap size.
+  bool canPromoteWithoutCollecting(unsigned numBuffers) const;
+
+  /// Visit the cells on the copy list of \p acceptor, and everything they
+  /// lead to, with the helper threads if the collection allows it.
+  /// \return false if nothing was done because the copy list must be drained
+  ///   by this thread alone.
+  template <bool CompactionEnabled>
+  bool evacuateInParallel(EvacAcceptor<CompactionEnabled> &acceptor);
+
+  /// Visit copied cells with \p acceptor until every thread taking part in a
+  /// parallel evacuation has run out of them.
+  template <bool CompactionEnabled>
+  void evacuateFromCopyList(
+      EvacAcceptor<CompactionEnabled> &acceptor,
+      ParallelEvacState &state);
 
   /// In the "no GC before TTI" mode, move the Young Gen heap segment to the
   /// Old Gen without scanning for garbage.
@@ -977,6 +1216,14 @@ class HadesGC final : public GCBase {
   /// time goals, based on the duration of the most recently completed YG.
   void updateYoungGenSizeFactor();
 
+  /// Record a mutator pause of \p durationSecs in the pause distribution.
+  void recordPause(double durationSecs);
+
+  /// \return the factor by which to scale how far the OG may grow past its
+  /// target size before compacting. It is above 1 if evacuating the compactee
+  /// is expected to take more than half of the pause budget.
+  double compactionThresholdFactor() const;
+
   /// Perform an OG garbage collection. All live objects in OG will be left
   /// untouched, all unreachable objects will be placed into a free list that
   /// can be used by \c oldGenAlloc.
@@ -984,6 +1231,20 @@ class HadesGC final : public GCBase {
   ///   the collection regardless of heap conditions.
   void oldGenCollection(std::string cause, bool forceCompaction);
 
+  /// \return the occupied fraction of the target OG size at which a YG
+  ///   collection should start an OG collection, taking into account whether
+  ///   the embedder is idle or busy.
+  double oldGenCollectionThreshold() const;
+
+  /// \return the OG occupancy ratio to aim for at the end of an OG collection,
+  ///   taking memory pressure into account.
+  double occupancyTarget() const;
+
+  /// Return every OG segment that has no allocated cells to the
+  /// StorageProvider.
+  /// \pre No OG collection is in progress, so the free lists are up to date.
+  void releaseEmptySegments();
+
   /// If there's an OG collection going on, wait for it to complete. This
   /// function is synchronous and will block the caller if the GC background
   /// thread is still running.
@@ -1023,9 +1284,16 @@ class HadesGC final : public GCBase {
   ///   has upper bounds on the amount of work it does before reading from the
   ///   global worklist. Any individual cell can be quite large (such as an
   ///   ArrayStorage).
-  /// \return true if there is any remaining work in the local worklist.
+  ///   With helper threads, the limit applies to each thread, and marking
+  ///   also stops when the mutator asks for gcMutex_.
+  /// \return true if there is any remaining work in the local worklists.
   bool incrementalMark(size_t markLimit);
 
+  /// Visit cells from the worklist of marking thread \p idx, stealing from
+  /// the other threads when it is empty, until all the worklists are empty or
+  /// \p state says to stop.
+  void markFromWorklist(unsigned idx, ParallelMarkState &state);
+
   /// Iterate the list of `weakMapEntrySlots_`, for each non-free slot, if
   /// both the key and the owner are marked, mark the mapped value.
   /// Note that this may further cause other values to be marked, so we need to
@@ -1043,8 +1311,8 @@ class HadesGC final : public GCBase {
   /// heap limit. Should be called at the start of completeMarking.
   void updateOldGenThreshold();
 
-  /// Prepare the last segment in the OG for compaction and initialise any
-  /// necessary state.
+  /// Prepare the last segment in the OG, or requestedCompactee_ if it is
+  /// set, for compaction and initialise any necessary state.
   /// \param forceCompaction If true, a compactee will be prepared regardless of
   ///   heap conditions. Note that if there are no OG heap segments, a
   ///   compaction cannot occur no matter what.
@@ -1112,8 +1380,10 @@ class HadesGC final : public GCBase {
     return youngGen_;
   }
 
-  /// Create a new segment (to be used by either YG or OG).
-  llvh::ErrorOr<FixedSizeHeapSegment> createSegment();
+  /// Create a new segment (to be used by either YG or OG). Fails if the heap
+  /// has reached its maximum size, unless \p checkMaxHeapSize is false.
+  llvh::ErrorOr<FixedSizeHeapSegment> createSegment(
+      bool checkMaxHeapSize = true);
 
   /// Set a given segment as the YG segment.
   /// \return the previous YG segment.
@@ -140,6 +140,11 @@ class IdentifierTable {
   /// mutating the heap, or making handles.
   std::string convertSymbolToUTF8(SymbolID id);
 
+  /// Make this table, which must be empty, a copy of \p other. \p other must
+  /// only contain lazy identifiers, whose characters outlive both tables, so
+  /// that it can be shared by every Runtime in the process.
+  void copyLazyIdentifiersFrom(const IdentifierTable &other);
+
   /// Reserve enough space in the hash table to contain \p count identifiers.
   void reserve(uint32_t count) {
     lookupVector_.reserve(count);
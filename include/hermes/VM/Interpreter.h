@@ -156,23 +156,27 @@ class Interpreter {
   /// Constructs an object via literal buffers in the bytecode file.
   /// \param shapeTableIndex the index of the shape element.
   /// \param valBufferOffset the first element of the val buffer to read.
+  /// \param longLived whether to allocate the object in the old generation.
   /// \return ExecutionStatus::EXCEPTION if the property definitions throw.
   static CallResult<PseudoHandle<>> createObjectFromBuffer(
       Runtime &runtime,
       CodeBlock *curCodeBlock,
       unsigned shapeTableIndex,
-      unsigned valBufferOffset);
+      unsigned valBufferOffset,
+      LongLived longLived = LongLived::No);
 
   /// Populates an array with literal values from the array buffer.
   /// \param numLiterals the amount of literals to read from the buffer.
   /// \param bufferIndex the first element of the buffer to read.
+  /// \param longLived whether to allocate the array in the old generation.
   /// \return ExecutionStatus::EXCEPTION if the property definitions throw.
   static CallResult<PseudoHandle<>> createArrayFromBuffer(
       Runtime &runtime,
       CodeBlock *curCodeBlock,
       unsigned numElements,
       unsigned numLiterals,
-      unsigned bufferIndex);
+      unsigned bufferIndex,
+      LongLived longLived = LongLived::No);
 
   /// Create a JSRegExp for the precompiled regexp bytecode.
   /// \param patternID the pattern string.
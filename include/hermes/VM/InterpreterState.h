@@ -26,6 +26,11 @@ struct InterpreterState {
   /// execute.
   uint32_t offset{0};
 
+  /// If set, execution continues at \c offset in the current frame, which has
+  /// already been set up for \c codeBlock, instead of in a new frame. Used
+  /// when JIT'ed code deoptimizes.
+  bool resumeFrame{false};
+
   InterpreterState() {}
 
   InterpreterState(CodeBlock *codeBlock, uint32_t offset)
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JIT_CODECACHE_H
+#define HERMES_VM_JIT_CODECACHE_H
+
+#include "hermes/VM/CodeBlock.h"
+
+#if HERMESVM_JIT
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+/// The kind of a process-specific value embedded in native code, which must
+/// be recomputed when the code is loaded by another process.
+enum class JITRelocKind : uint8_t {
+  /// Address of a function of the VM. The payload is its distance from
+  /// JITCodeCache::functionAnchor().
+  FunctionPtr,
+  /// Address of the CodeBlock.
+  CodeBlock,
+  /// Address of the RuntimeModule of the CodeBlock, plus the payload.
+  RuntimeModule,
+  /// Address of the read property cache of the CodeBlock.
+  ReadPropertyCache,
+  /// Address of the write property cache of the CodeBlock.
+  WritePropertyCache,
+  /// Address of the bytecode instruction at offset payload in the CodeBlock.
+  BytecodeIP,
+  /// SymbolID of the string with ID payload in the RuntimeModule.
+  SymbolID,
+
+  _last = SymbolID,
+};
+
+/// A value embedded in native code.
+struct JITReloc {
+  /// Offset of the value from the start of the code.
+  uint32_t offset;
+  /// Size of the value in bytes, either 4 or 8.
+  uint8_t size;
+  JITRelocKind kind;
+  /// Meaning depends on the kind.
+  uint64_t payload;
+};
+
+/// The native code of a CodeBlock in a form that can be stored and loaded by
+/// another process.
+struct JITCodeImage {
+  /// The code, including its read-only data.
+  std::vector<uint8_t> code{};
+  /// Every process-specific value in \c code.
+  std::vector<JITReloc> relocs{};
+  /// Offset of the on-stack replacement entry, or kNoOSREntry.
+  uint32_t osrEntryOffset = kNoOSREntry;
+
+  static constexpr uint32_t kNoOSREntry = UINT32_MAX;
+};
+
+/// A directory of native code compiled by previous runs, one file per
+/// function. Files are keyed by the source hash of the bytecode, the function
+/// ID, and a version that changes with the JIT, the layout of the runtime
+/// structures the code accesses, and the VM binary. The bytecode and header of
+/// the function are also validated when the code is loaded.
+class JITCodeCache {
+ public:
+  /// \param dir the directory where the files are stored. It is created if it
+  ///   doesn't exist.
+  explicit JITCodeCache(std::string dir);
+
+  /// \return the address FunctionPtr relocations are relative to.
+  static uintptr_t functionAnchor();
+
+  /// Compute the payload of a FunctionPtr relocation of \p fn into \p payload.
+  /// \return false if \p fn isn't in the same binary as functionAnchor(), so
+  ///   its distance from it is not fixed.
+  static bool functionPayload(const void *fn, uint64_t &payload);
+
+  /// Store \p image as the code of \p codeBlock, compiled with options
+  /// identified by \p config. Errors are ignored, since they only cost a
+  /// recompilation in the next run. May be called on any thread.
+  void store(CodeBlock *codeBlock, uint32_t config, const JITCodeImage &image);
+
+  /// Read the code of \p codeBlock stored by a previous run with the same
+  /// \p config into \p image, and patch its relocations for this process.
+  /// Must be called on the mutator thread, since symbols may be allocated.
+  /// \return true on success.
+  bool load(CodeBlock *codeBlock, uint32_t config, JITCodeImage &image);
+
+ private:
+  /// \return the file where the code of \p codeBlock is stored, or an empty
+  ///   string if its bytecode can't be identified.
+  std::string pathFor(CodeBlock *codeBlock, uint32_t config) const;
+
+  /// The cache directory.
+  const std::string dir_;
+  /// Hash of everything the stored code depends on besides the bytecode.
+  const uint64_t version_;
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMESVM_JIT
+
+#endif // HERMES_VM_JIT_CODECACHE_H
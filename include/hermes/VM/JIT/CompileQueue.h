@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JIT_COMPILEQUEUE_H
+#define HERMES_VM_JIT_COMPILEQUEUE_H
+
+#include "hermes/VM/CodeBlock.h"
+
+#include <cstdint>
+
+#if HERMESVM_JIT
+#include "llvh/ADT/BitVector.h"
+#include "llvh/ADT/DenseMap.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace hermes {
+namespace vm {
+
+/// Statistics about background JIT compilation.
+struct JITCompileQueueStats {
+  /// Number of CodeBlocks currently waiting to be compiled.
+  uint32_t queueDepth = 0;
+  /// Largest number of CodeBlocks that were waiting at the same time.
+  uint32_t maxQueueDepth = 0;
+  /// Number of CodeBlocks compiled by the background thread.
+  uint32_t numCompiled = 0;
+  /// Total time spent compiling, in seconds.
+  double compileTime = 0;
+  /// Longest single compilation, in seconds.
+  double maxCompileTime = 0;
+  /// Total time CodeBlocks spent waiting in the queue, in seconds.
+  double waitTime = 0;
+};
+
+#if HERMESVM_JIT
+
+/// Symbols needed to compile a CodeBlock, keyed by string ID. They are
+/// resolved on the mutator thread, since the string tables of a RuntimeModule
+/// may be modified while the background thread is compiling.
+using JITSymbolMap = llvh::DenseMap<uint32_t, SymbolID>;
+
+/// Populate \p symbols with every string ID operand of \p codeBlock that
+/// already has a symbol. The patterns and flags of CreateRegExp are always
+/// given a symbol, allocating it if necessary, because the compiler needs
+/// them. Must be called on the mutator thread.
+void resolveJITSymbols(CodeBlock *codeBlock, JITSymbolMap &symbols);
+
+/// The state of a CodeBlock that the compiler reads, but that the mutator may
+/// modify while the background thread is compiling. It is copied when the
+/// CodeBlock is enqueued.
+struct JITCompileSnapshot {
+  /// Symbols of the string IDs used by the bytecode.
+  JITSymbolMap symbols{};
+  /// Type feedback, see CodeBlock::getNonNumberSites().
+  llvh::BitVector nonNumberSites{};
+  /// Number of times the native code of the CodeBlock deoptimized.
+  uint32_t deoptCount = 0;
+};
+
+/// Populate \p snapshot from \p codeBlock. Must be called on the mutator
+/// thread.
+void takeJITCompileSnapshot(CodeBlock *codeBlock, JITCompileSnapshot &snapshot);
+
+/// The outcome of compiling a CodeBlock, which the mutator installs in the
+/// CodeBlock and the JITContext.
+struct JITCompileResult {
+  /// The compiled CodeBlock.
+  CodeBlock *codeBlock;
+  /// The native code, or nullptr if it could not be compiled.
+  JITCompiledFunctionPtr fn = nullptr;
+  /// The on-stack replacement entry into \c fn, if it has one.
+  JITCompiledFunctionPtr osrEntry = nullptr;
+  /// Set when the JIT memory limit has been reached. In that case \c fn may
+  /// be null without the CodeBlock being at fault.
+  bool memoryLimitReached = false;
+};
+
+/// A queue of CodeBlocks compiled in order by a single background thread.
+/// The thread never modifies a CodeBlock: results are collected with
+/// takeResults() and installed by the mutator, which can keep interpreting the
+/// CodeBlock in the meantime.
+class JITCompileQueue {
+ public:
+  /// Compile a CodeBlock using the state copied by takeJITCompileSnapshot().
+  /// Called on the background thread.
+  using CompileFn =
+      std::function<JITCompileResult(CodeBlock *, const JITCompileSnapshot &)>;
+
+  /// Start the background thread, which calls \p compile for every CodeBlock
+  /// in the queue.
+  explicit JITCompileQueue(CompileFn compile);
+
+  /// Stop the background thread after the compilation in progress, if any,
+  /// discarding the queued CodeBlocks.
+  ~JITCompileQueue();
+
+  JITCompileQueue(const JITCompileQueue &) = delete;
+  void operator=(const JITCompileQueue &) = delete;
+
+  /// Add \p codeBlock to the queue. Must be called on the mutator thread.
+  void enqueue(CodeBlock *codeBlock);
+
+  /// \return true if there are compiled results waiting for takeResults().
+  bool hasResults() const {
+    return hasResults_.load(std::memory_order_acquire);
+  }
+
+  /// Append the results that have been completed since the last call to
+  /// \p results.
+  void takeResults(std::vector<JITCompileResult> &results);
+
+  /// Remove all work related to CodeBlocks of \p runtimeModule, waiting for
+  /// their compilation to finish if it is in progress. Called before the
+  /// CodeBlocks are freed.
+  void cancel(RuntimeModule *runtimeModule);
+
+  /// \return a snapshot of the statistics.
+  JITCompileQueueStats getStats();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  /// A CodeBlock waiting to be compiled.
+  struct Job {
+    CodeBlock *codeBlock;
+    JITCompileSnapshot snapshot;
+    Clock::time_point enqueueTime;
+  };
+
+  /// The body of the background thread.
+  void run();
+
+  /// Compile a CodeBlock.
+  CompileFn compile_;
+
+  /// Protects all mutable fields below, except hasResults_.
+  std::mutex mutex_{};
+  /// Signalled when a job is added or the thread should stop.
+  std::condition_variable workAvailable_{};
+  /// Signalled when a compilation has finished.
+  std::condition_variable jobDone_{};
+
+  /// CodeBlocks waiting to be compiled, oldest first.
+  std::deque<Job> queue_{};
+  /// Completed compilations, waiting to be installed.
+  std::vector<JITCompileResult> results_{};
+  /// Whether results_ is non-empty, checked by the mutator without locking.
+  std::atomic<bool> hasResults_{false};
+  /// The CodeBlock being compiled by the background thread, if any.
+  CodeBlock *inProgress_ = nullptr;
+  /// Set to stop the background thread.
+  bool stop_ = false;
+
+  JITCompileQueueStats stats_{};
+
+  std::thread thread_{};
+};
+
+#endif // HERMESVM_JIT
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_JIT_COMPILEQUEUE_H
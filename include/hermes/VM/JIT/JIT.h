@@ -31,7 +31,12 @@ class Emitter;
   friend class arm64::Emitter;
 #elif defined(__x86_64__) || defined(_M_X64)
 using x86_64::JITContext;
-#define FRIEND_JIT friend class x86_64::JITContext;
+namespace x86_64 {
+class Emitter;
+}
+#define FRIEND_JIT                 \
+  friend class x86_64::JITContext; \
+  friend class x86_64::Emitter;
 #endif
 
 } // namespace vm
@@ -39,7 +44,9 @@ using x86_64::JITContext;
 
 #else
 
+#include "hermes/Public/RuntimeConfig.h"
 #include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/JIT/CompileQueue.h"
 
 #define FRIEND_JIT
 
@@ -67,6 +74,15 @@ class JITContext {
     return codeBlock->getJITCompiled();
   }
 
+  /// Called by the interpreter when it takes a backward branch. Return the
+  /// entry point for transferring the current interpreter frame into native
+  /// code, or nullptr.
+  inline JITCompiledFunctionPtr compileOSR(
+      Runtime &runtime,
+      CodeBlock *codeBlock) {
+    return codeBlock->getJITOSREntry();
+  }
+
   /// \return true if JIT compilation is enabled.
   bool isEnabled() const {
     return false;
@@ -103,6 +119,18 @@ class JITContext {
   /// Can be overridden by setForceJIT(true).
   void setDefaultExecThreshold(uint32_t threshold) {}
 
+  /// Set the number of backward branches taken in a function by the
+  /// interpreter before the function is compiled.
+  void setOSRThreshold(uint32_t threshold) {}
+
+  /// Count a transfer of a running interpreter frame into native code.
+  void recordOSREntry() {}
+
+  /// \return the number of interpreter frames transferred into native code.
+  uint32_t getNumOSREntries() const {
+    return 0;
+  }
+
   /// Set the flag to emit asserts in the JIT'ed code.
   void setEmitAsserts(bool emitAsserts) {}
 
@@ -110,6 +138,26 @@ class JITContext {
   bool getEmitAsserts() {
     return false;
   }
+
+  /// Set how JIT'ed code is described to external profilers.
+  void setPerfMapMode(JITPerfMapMode mode) {}
+
+  /// Set the directory of the on-disk code cache.
+  void setCodeCacheDir(const std::string &dir) {}
+
+  /// Enable or disable compilation on a background thread.
+  void setAsyncCompile(bool async) {}
+
+  /// \return statistics about background compilation.
+  JITCompileQueueStats getCompileQueueStats() {
+    return {};
+  }
+
+  /// Discard any background compilation of CodeBlocks in \p runtimeModule.
+  void cancelCompilation(RuntimeModule *runtimeModule) {}
+
+  /// Enable or disable speculation on operand types.
+  void setSpeculate(bool speculate) {}
 };
 
 } // namespace vm
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JIT_PERFMAP_H
+#define HERMES_VM_JIT_PERFMAP_H
+
+#include "hermes/Public/RuntimeConfig.h"
+
+#include <cstddef>
+#include <string>
+
+namespace hermes {
+namespace vm {
+
+class CodeBlock;
+
+/// \return the symbol name under which the native code of \p codeBlock is
+/// reported to external profilers: "JS:<name> <file>:<line>:<column>", or just
+/// "JS:<name>" if there is no debug info.
+std::string perfMapSymbolName(const CodeBlock *codeBlock);
+
+/// Describe \p size bytes of native code starting at \p code, compiled from
+/// \p codeBlock, to external profilers in the format selected by \p mode.
+/// The output files are shared by all runtimes in the process and are created
+/// on first use. Failures to create or write them are ignored, since they
+/// only affect symbolization.
+void perfMapAddCode(
+    JITPerfMapMode mode,
+    const CodeBlock *codeBlock,
+    const void *code,
+    size_t size);
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_JIT_PERFMAP_H
@@ -8,7 +8,9 @@
 #ifndef HERMES_VM_JIT_ARM64_JIT_H
 #define HERMES_VM_JIT_ARM64_JIT_H
 
+#include "hermes/Public/RuntimeConfig.h"
 #include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/JIT/CompileQueue.h"
 
 namespace hermes {
 namespace vm {
@@ -43,6 +45,16 @@ class JITContext {
   /// be compiled, return nullptr.
   inline JITCompiledFunctionPtr compile(Runtime &runtime, CodeBlock *codeBlock);
 
+  /// Called by the interpreter when it takes a backward branch in \p
+  /// codeBlock. Once enough backward branches have been taken, compile the
+  /// function so that its next invocation runs natively.
+  /// This backend keeps frame registers in hardware registers, so it provides
+  /// no entry for transferring a running interpreter frame.
+  /// \return always nullptr.
+  inline JITCompiledFunctionPtr compileOSR(
+      Runtime &runtime,
+      CodeBlock *codeBlock);
+
   /// \return true if JIT compilation is enabled.
   bool isEnabled() const {
     return enabled_;
@@ -61,6 +73,23 @@ class JITContext {
     defaultExecThreshold_ = threshold;
   }
 
+  /// Set the number of backward branches taken in a function by the
+  /// interpreter before the function is compiled.
+  /// Can be overridden by setForceJIT(true).
+  void setOSRThreshold(uint32_t threshold) {
+    osrThreshold_ = threshold;
+  }
+
+  /// Count a transfer of a running interpreter frame into native code.
+  void recordOSREntry() {
+    ++numOSREntries_;
+  }
+
+  /// \return the number of interpreter frames transferred into native code.
+  uint32_t getNumOSREntries() const {
+    return numOSREntries_;
+  }
+
   /// Enable or disable dumping JIT'ed Code.
   void setDumpJITCode(unsigned dump) {
     dumpJITCode_ = dump;
@@ -101,6 +130,37 @@ class JITContext {
     return emitAsserts_;
   }
 
+  /// Set how JIT'ed code is described to external profilers.
+  void setPerfMapMode(JITPerfMapMode mode) {
+    perfMapMode_ = mode;
+  }
+
+  /// The code cache is not supported on arm64, functions are always compiled.
+  void setCodeCacheDir(const std::string &dir) {}
+
+  /// Background compilation is not supported on arm64, functions are always
+  /// compiled synchronously.
+  void setAsyncCompile(bool async) {}
+
+  /// \return statistics about background compilation, which are always empty.
+  JITCompileQueueStats getCompileQueueStats() {
+    return {};
+  }
+
+  /// Discard any background compilation of CodeBlocks in \p runtimeModule.
+  void cancelCompilation(RuntimeModule *runtimeModule) {}
+
+  /// Code compiled for arm64 never speculates.
+  void setSpeculate(bool speculate) {}
+
+  /// Code compiled for arm64 never speculates, so no type feedback is needed.
+  bool getSpeculate() const {
+    return false;
+  }
+
+  /// Code compiled for arm64 never deoptimizes, so this is never called.
+  void deoptimize(CodeBlock *codeBlock) {}
+
  private:
   /// Slow path that actually performs the compilation of the specified
   /// CodeBlock.
@@ -121,6 +181,8 @@ class JITContext {
   bool crashOnError_{false};
   /// Whether to emit asserts in the JIT'ed code.
   bool emitAsserts_{false};
+  /// How to describe JIT'ed code to external profilers.
+  JITPerfMapMode perfMapMode_{JITPerfMapMode::None};
   /// Whether to force jitting of all functions.
   /// If true, ignores the default exec threshold completely.
   bool forceJIT_{false};
@@ -128,6 +190,12 @@ class JITContext {
   /// The JIT threshold for function execution count.
   /// Lowered based on the loop depth before deciding whether to JIT.
   uint32_t defaultExecThreshold_ = 1 << 5;
+
+  /// The JIT threshold for backward branches taken in a single function.
+  uint32_t osrThreshold_ = 1 << 10;
+
+  /// Number of interpreter frames transferred into native code.
+  uint32_t numOSREntries_ = 0;
 };
 
 LLVM_ATTRIBUTE_ALWAYS_INLINE
@@ -156,6 +224,21 @@ inline JITCompiledFunctionPtr JITContext::compile(
   return compileImpl(runtime, codeBlock);
 }
 
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+inline JITCompiledFunctionPtr JITContext::compileOSR(
+    Runtime &runtime,
+    CodeBlock *codeBlock) {
+  if (LLVM_LIKELY(!enabled_))
+    return nullptr;
+  if (LLVM_LIKELY(codeBlock->getJITCompiled() || codeBlock->getDontJIT()))
+    return nullptr;
+
+  uint32_t osrThreshold = forceJIT_ ? 0 : osrThreshold_;
+  if (LLVM_LIKELY(codeBlock->incrementBackEdgeCount() >= osrThreshold))
+    compileImpl(runtime, codeBlock);
+  return nullptr;
+}
+
 } // namespace arm64
 } // namespace vm
 } // namespace hermes
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JIT_X86_64_JIT_H
+#define HERMES_VM_JIT_X86_64_JIT_H
+
+#include "hermes/Public/RuntimeConfig.h"
+#include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/JIT/CodeCache.h"
+#include "hermes/VM/JIT/CompileQueue.h"
+
+namespace hermes {
+namespace vm {
+namespace x86_64 {
+
+namespace DumpJitCode {
+enum : unsigned {
+  Code = 0x01,
+  CompileStatus = 0x02,
+  InstErr = 0x04,
+  BRK = 0x40,
+  EntryExit = 0x80,
+};
+}
+
+/// All state related to JIT compilation.
+class JITContext {
+  class Compiler;
+
+ public:
+  /// Construct a JIT context. No executable memory is allocated before it is
+  /// needed.
+  /// \param enable whether JIT is enabled.
+  JITContext(bool enable);
+  ~JITContext();
+
+  JITContext(const JITContext &) = delete;
+  void operator=(const JITContext &) = delete;
+
+  /// Compile a function to native code and return the native pointer. If the
+  /// function was previously compiled, return the existing body. If it cannot
+  /// be compiled, return nullptr.
+  inline JITCompiledFunctionPtr compile(Runtime &runtime, CodeBlock *codeBlock);
+
+  /// Called by the interpreter when it takes a backward branch in \p
+  /// codeBlock. Once enough backward branches have been taken, compile the
+  /// function.
+  /// \return the entry point for transferring the current interpreter frame
+  ///   into the native code of the function, or nullptr if execution should
+  ///   continue in the interpreter.
+  inline JITCompiledFunctionPtr compileOSR(
+      Runtime &runtime,
+      CodeBlock *codeBlock);
+
+  /// \return true if JIT compilation is enabled.
+  bool isEnabled() const {
+    return enabled_;
+  }
+
+  /// Enable or disable JIT compilation.
+  void setEnabled(bool enabled) {
+    enabled_ = enabled;
+  }
+
+  /// Set the default threshold for function execution count before a function
+  /// is compiled. On a per-function basis, the count may be altered based on
+  /// internal heuristics.
+  /// Can be overridden by setForceJIT(true).
+  void setDefaultExecThreshold(uint32_t threshold) {
+    defaultExecThreshold_ = threshold;
+  }
+
+  /// Set the number of backward branches taken in a function by the
+  /// interpreter before the function is compiled and the running frame is
+  /// transferred to native code.
+  /// Can be overridden by setForceJIT(true).
+  void setOSRThreshold(uint32_t threshold) {
+    osrThreshold_ = threshold;
+  }
+
+  /// Count a transfer of a running interpreter frame into native code.
+  void recordOSREntry() {
+    ++numOSREntries_;
+  }
+
+  /// \return the number of interpreter frames transferred into native code.
+  uint32_t getNumOSREntries() const {
+    return numOSREntries_;
+  }
+
+  /// Enable or disable dumping JIT'ed Code.
+  void setDumpJITCode(unsigned dump) {
+    dumpJITCode_ = dump;
+  }
+
+  /// \return true if dumping JIT'ed Code is enabled.
+  unsigned getDumpJITCode() {
+    return dumpJITCode_;
+  }
+
+  /// Set the flag to fatally crash on JIT compilation errors.
+  void setCrashOnError(bool crash) {
+    crashOnError_ = crash;
+  }
+
+  /// \return true if we should fatally crash on JIT compilation errors.
+  bool getCrashOnError() {
+    return crashOnError_;
+  }
+
+  /// Set the flag to force jitting of all functions.
+  void setForceJIT(bool force) {
+    forceJIT_ = force;
+  }
+
+  /// Set the memory limit for JIT'ed code in bytes.
+  void setMemoryLimit(uint32_t memoryLimit) {
+    memoryLimit_ = memoryLimit;
+  }
+
+  /// Set the flag to emit asserts in the JIT'ed code.
+  void setEmitAsserts(bool emitAsserts) {
+    emitAsserts_ = emitAsserts;
+  }
+
+  /// \return true if we should emit asserts in the JIT'ed code.
+  bool getEmitAsserts() {
+    return emitAsserts_;
+  }
+
+  /// Set how JIT'ed code is described to external profilers.
+  void setPerfMapMode(JITPerfMapMode mode) {
+    perfMapMode_ = mode;
+  }
+
+  /// Enable or disable speculation: arithmetic that has only seen numbers in
+  /// the interpreter is compiled without a generic fallback, and the native
+  /// code deoptimizes to the interpreter if the operands aren't numbers.
+  void setSpeculate(bool speculate) {
+    speculate_ = speculate;
+  }
+
+  /// \return true if compiled code speculates, so the interpreter should
+  ///   collect type feedback.
+  bool getSpeculate() const {
+    return enabled_ && speculate_;
+  }
+
+  /// Called when the native code of \p codeBlock deoptimizes. Discard the code
+  /// so that the function is recompiled with the updated type feedback, and
+  /// stop speculating in it once it has deoptimized too often.
+  void deoptimize(CodeBlock *codeBlock);
+
+  /// Store compiled code in \p dir and reuse the code stored there by previous
+  /// runs instead of compiling it again. An empty \p dir disables the code
+  /// cache. Must be set before any code is compiled.
+  void setCodeCacheDir(const std::string &dir);
+
+  /// Enable or disable compilation on a background thread. When enabled,
+  /// functions that reach the threshold keep running in the interpreter until
+  /// their native code is ready. Must be set before any code is compiled.
+  void setAsyncCompile(bool async);
+
+  /// \return statistics about background compilation.
+  JITCompileQueueStats getCompileQueueStats();
+
+  /// Discard any background compilation of CodeBlocks in \p runtimeModule,
+  /// which is about to be destroyed.
+  void cancelCompilation(RuntimeModule *runtimeModule);
+
+ private:
+  /// Slow path that actually performs the compilation of the specified
+  /// CodeBlock, or queues it if compiling in the background.
+  JITCompiledFunctionPtr compileImpl(Runtime &runtime, CodeBlock *codeBlock);
+
+  /// Install the outcome of a compilation in its CodeBlock.
+  void installCompiled(const JITCompileResult &res);
+
+  /// Install the code of \p codeBlock stored in the code cache, if any.
+  /// The cache is only searched once per CodeBlock.
+  /// \return the native code, or nullptr if it wasn't found.
+  JITCompiledFunctionPtr loadFromCodeCache(CodeBlock *codeBlock);
+
+  /// \return the options that affect the generated code, which must match
+  ///   for stored code to be reused.
+  uint32_t codeCacheConfig() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_{};
+
+  /// The on-disk code cache, if enabled.
+  std::unique_ptr<JITCodeCache> codeCache_{};
+
+  /// The background compilation queue, if enabled. Declared after impl_ and
+  /// codeCache_ so that the background thread is stopped before they are
+  /// freed.
+  std::unique_ptr<JITCompileQueue> compileQueue_{};
+
+  /// Whether JIT compilation is enabled.
+  bool enabled_{false};
+  /// The memory limit for JIT'ed code in bytes.
+  /// Once the limit is reached, no more code will be JIT'ed.
+  uint32_t memoryLimit_{32u << 20};
+  /// whether to dump JIT'ed code
+  unsigned dumpJITCode_{0};
+  /// whether to fatally crash on JIT compilation errors
+  bool crashOnError_{false};
+  /// Whether to emit asserts in the JIT'ed code.
+  bool emitAsserts_{false};
+  /// How to describe JIT'ed code to external profilers.
+  JITPerfMapMode perfMapMode_{JITPerfMapMode::None};
+  /// Whether to force jitting of all functions.
+  /// If true, ignores the default exec threshold completely.
+  bool forceJIT_{false};
+  /// Whether to speculate on the types of operands.
+  bool speculate_{false};
+
+  /// Number of deoptimizations after which a function is compiled without
+  /// speculation.
+  static constexpr uint32_t kMaxDeopts = 4;
+
+  /// The JIT threshold for function execution count.
+  /// Lowered based on the loop depth before deciding whether to JIT.
+  uint32_t defaultExecThreshold_ = 1 << 5;
+
+  /// The JIT threshold for backward branches taken in a single function.
+  uint32_t osrThreshold_ = 1 << 10;
+
+  /// Number of interpreter frames transferred into native code.
+  uint32_t numOSREntries_ = 0;
+};
+
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+inline JITCompiledFunctionPtr JITContext::compile(
+    Runtime &runtime,
+    CodeBlock *codeBlock) {
+  auto ptr = codeBlock->getJITCompiled();
+  if (LLVM_LIKELY(ptr))
+    return ptr;
+  if (LLVM_LIKELY(!enabled_))
+    return nullptr;
+  if (LLVM_LIKELY(codeBlock->getDontJIT()))
+    return nullptr;
+
+  uint32_t loopDepth = codeBlock->getFunctionHeader().getLoopDepth();
+  // It's possible that if the loop depth is too high, we will set the
+  // execThreshold to 0 for this function, but that's OK because we want to JIT
+  // it immediately.
+  assert(loopDepth <= 3 && "loopDepth is larger than expected");
+  uint32_t execThreshold =
+      forceJIT_ ? 0 : (defaultExecThreshold_ >> (loopDepth * 2));
+
+  if (LLVM_LIKELY(codeBlock->getExecutionCount() < execThreshold)) {
+    // Code stored by a previous run doesn't need to warm up again.
+    if (LLVM_UNLIKELY(codeCache_ != nullptr) &&
+        !codeBlock->getJITCacheChecked())
+      return loadFromCodeCache(codeBlock);
+    return nullptr;
+  }
+
+  return compileImpl(runtime, codeBlock);
+}
+
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+inline JITCompiledFunctionPtr JITContext::compileOSR(
+    Runtime &runtime,
+    CodeBlock *codeBlock) {
+  auto ptr = codeBlock->getJITOSREntry();
+  if (LLVM_LIKELY(ptr))
+    return ptr;
+  if (LLVM_LIKELY(!enabled_))
+    return nullptr;
+  // If the function has been compiled without an OSR entry, or cannot be
+  // compiled, there is nothing to enter.
+  if (LLVM_LIKELY(codeBlock->getJITCompiled() || codeBlock->getDontJIT()))
+    return nullptr;
+
+  uint32_t osrThreshold = forceJIT_ ? 0 : osrThreshold_;
+  if (LLVM_LIKELY(codeBlock->incrementBackEdgeCount() < osrThreshold))
+    return nullptr;
+
+  compileImpl(runtime, codeBlock);
+  return codeBlock->getJITOSREntry();
+}
+
+} // namespace x86_64
+} // namespace vm
+} // namespace hermes
+#endif // HERMES_VM_JIT_X86_64_JIT_H
@@ -19,6 +19,7 @@ namespace vm {
 class ArrayImpl : public JSObject {
   using Super = JSObject;
   friend void ArrayImplBuildMeta(const GCCell *cell, Metadata::Builder &mb);
+  friend struct RuntimeOffsets;
 
  public:
   static bool classof(const GCCell *cell) {
@@ -75,7 +76,7 @@ class ArrayImpl : public JSObject {
     assert(
         index >= self->beginIndex_ && index < self->endIndex_ &&
         "array index out of range");
-    self->getIndexedStorage(runtime)->set(
+    self->getIndexedStorage(runtime)->setWithBarrierIfNeeded(
         runtime, index - self->beginIndex_, value);
   }
 
@@ -299,12 +300,15 @@ class JSArray final : public ArrayImpl {
   /// Create an instance of Array, with [[Prototype]] initialized with
   /// \p prototypeHandle, with capacity for \p capacity elements and actual size
   /// \p length. Does not allocate the return object's property storage array.
+  /// \param longLived whether to allocate the array and its elements directly
+  ///   in the old generation.
   static CallResult<PseudoHandle<JSArray>> createNoAllocPropStorage(
       Runtime &runtime,
       Handle<JSObject> prototypeHandle,
       Handle<HiddenClass> classHandle,
       size_type capacity = 0,
-      size_type length = 0);
+      size_type length = 0,
+      LongLived longLived = LongLived::No);
 
   /// Create an instance of Array, with [[Prototype]] initialized with
   /// \p prototypeHandle, with capacity for \p capacity elements and actual size
@@ -339,8 +343,11 @@ class JSArray final : public ArrayImpl {
 
   /// Create an instance of Array, using the standard array prototype, with
   /// capacity for \p capacity elements and actual size \p length.
-  static CallResult<PseudoHandle<JSArray>>
-  create(Runtime &runtime, size_type capacity, size_type length);
+  static CallResult<PseudoHandle<JSArray>> create(
+      Runtime &runtime,
+      size_type capacity,
+      size_type length,
+      LongLived longLived = LongLived::No);
 
   /// A convenience method for setting the \c .length property of the array.
   /// It performs the necessary checks and updates the property. It could fail
@@ -20,6 +20,8 @@ namespace vm {
 /// This should be used in combination with a typed array view over the buffer
 /// in order to extract its information in different ways.
 class JSArrayBuffer final : public JSObject {
+  friend struct RuntimeOffsets;
+
  public:
   // A RangeError for a failed allocation should be thrown if the requested
   // amount is larger than 2 ^ 32 - 1.
@@ -357,13 +357,18 @@ class JSObject : public GCCell {
 
   /// Attempts to allocate a JSObject with the given prototype.
   /// If allocation fails, the GC declares an OOM.
+  /// \param longLived whether to allocate the object directly in the old
+  ///   generation.
   static PseudoHandle<JSObject> create(
       Runtime &runtime,
-      Handle<JSObject> parentHandle);
+      Handle<JSObject> parentHandle,
+      LongLived longLived = LongLived::No);
 
   /// Attempts to allocate a JSObject with the standard Object prototype.
   /// If allocation fails, the GC declares an OOM.
-  static PseudoHandle<JSObject> create(Runtime &runtime);
+  static PseudoHandle<JSObject> create(
+      Runtime &runtime,
+      LongLived longLived = LongLived::No);
 
   /// Attempts to allocate a JSObject with the standard Object prototype and
   /// property storage preallocated. If allocation fails, the GC declares an
@@ -371,7 +376,8 @@ class JSObject : public GCCell {
   /// \param propertyCount number of property storage slots preallocated.
   static PseudoHandle<JSObject> create(
       Runtime &runtime,
-      unsigned propertyCount);
+      unsigned propertyCount,
+      LongLived longLived = LongLived::No);
 
   /// Allocates a JSObject with the given hidden class and property storage
   /// preallocated. If allocation fails, the GC declares an
@@ -379,7 +385,8 @@ class JSObject : public GCCell {
   /// \param clazz the hidden class for the new object.
   static PseudoHandle<JSObject> create(
       Runtime &runtime,
-      Handle<HiddenClass> clazz);
+      Handle<HiddenClass> clazz,
+      LongLived longLived = LongLived::No);
 
   /// Allocates a JSObject with the given hidden class and prototype.
   /// If allocation fails, the GC declares an OOM.
@@ -682,6 +689,14 @@ class JSObject : public GCCell {
       Runtime &runtime,
       SlotIndex index,
       SmallHermesValue value);
+  /// Store a non-pointer value to the "named value" storage space by \p
+  /// index, when the value it replaces is not a pointer either. Such a store
+  /// needs no write barrier.
+  static void setNamedSlotValueNonPtrUnsafe(
+      JSObject *self,
+      Runtime &runtime,
+      SlotIndex index,
+      SmallHermesValue value);
 
   /// Store a value to the "named value" storage space by the slot described by
   /// \p desc.
@@ -1876,6 +1891,29 @@ inline void JSObject::setNamedSlotValueIndirectUnsafe(
   self->propStorage_.getNonNull(runtime)->set(index, value, runtime.getHeap());
 }
 
+inline void JSObject::setNamedSlotValueNonPtrUnsafe(
+    JSObject *self,
+    Runtime &runtime,
+    SlotIndex index,
+    SmallHermesValue value) {
+#ifdef HERMESVM_BOXED_DOUBLES
+  // Numbers may have been boxed, which makes them pointers. This applies to
+  // the value being replaced as well as to the new one.
+  if (LLVM_UNLIKELY(
+          value.isPointer() ||
+          getNamedSlotValueUnsafe(self, runtime, index).isPointer()))
+    return setNamedSlotValueUnsafe(self, runtime, index, value);
+#endif
+  assert(!value.isPointer() && "Value must not be a pointer");
+  if (LLVM_LIKELY(index < DIRECT_PROPERTY_SLOTS))
+    return setNamedSlotValueDirectUnsafe<std::false_type>(
+        self, runtime, index, value);
+
+  self->propStorage_.getNonNull(runtime)
+      ->set<PropStorage::Inline::No, std::false_type>(
+          index - DIRECT_PROPERTY_SLOTS, value, runtime.getHeap());
+}
+
 inline CallResult<PseudoHandle<>> JSObject::getComputedSlotValue(
     PseudoHandle<JSObject> self,
     Runtime &runtime,
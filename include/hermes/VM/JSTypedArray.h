@@ -17,6 +17,8 @@ namespace vm {
 /// JSTypedArrayBase is the object that all JSTypedArrays inherit from, and
 /// exposes common interface elements to JSTypedArrays.
 class JSTypedArrayBase : public JSObject {
+  friend struct RuntimeOffsets;
+
  public:
   // The spec is silent about the maximum size of an ArrayBuffer.  If
   // this is to be enlarged effectively, other changes (such as the
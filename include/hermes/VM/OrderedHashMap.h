@@ -49,6 +49,10 @@ class HashMapEntryBase final : public GCCell, public Data {
   /// Next entry in insertion order.
   GCPointer<HashMapEntryBase> nextIterationEntry{nullptr};
 
+  /// The hash of the key, computed once on insertion. Lookups compare it
+  /// before comparing keys, and rehashing reuses it.
+  uint32_t hash{0};
+
   static constexpr CellKind getCellKind() {
     if constexpr (std::is_same_v<Data, HashMapEntryKeyValue>) {
       return CellKind::HashMapEntryKind;
@@ -240,10 +244,13 @@ class OrderedHashMapBase {
   /// rehash and clear.
   uint32_t deletedCount_{0};
 
-  /// Hash a HermesValue to an index to our hash table.
-  static uint32_t
-  hashToBucket(uint32_t capacity, Runtime &runtime, Handle<> key) {
-    auto hash = runtime.gcStableHashHermesValue(key);
+  /// Hash a HermesValue. The result is stored in the entry for the key.
+  static uint32_t hashKey(Runtime &runtime, Handle<> key) {
+    return runtime.gcStableHashHermesValue(key);
+  }
+
+  /// Map a hash computed by hashKey() to an index to our hash table.
+  static uint32_t hashToBucket(uint32_t capacity, uint32_t hash) {
     assert((capacity & (capacity - 1)) == 0 && "capacity_ must be power of 2");
     return hash & (capacity - 1);
   }
@@ -251,12 +258,13 @@ class OrderedHashMapBase {
   /// Remove a node from the linked list.
   void removeLinkedListNode(Runtime &runtime, BucketType *entry, GC &gc);
 
-  /// Lookup an entry with key as \p key in a given \p bucket (hash).
+  /// Lookup an entry with key as \p key and hash \p hash, starting at the
+  /// bucket the hash maps to.
   /// \return The pair of the entry found and the index for it. The entry can be
   /// nullptr if the key doesn't exist. In that case, the index is the index of
   /// the available bucket for the give key.
   std::pair<BucketType *, uint32_t>
-  lookupInBucket(Runtime &runtime, uint32_t bucket, HermesValue key);
+  lookupInBucket(Runtime &runtime, uint32_t hash, HermesValue key);
 
   /// Adjust the capacity of the hashtable and rehash.
   /// The new capacity will be calculated by nextCapacity().
@@ -316,6 +324,7 @@ class OrderedHashMapBase {
   static ExecutionStatus doInsert(
       Handle<Derived> self,
       Runtime &runtime,
+      uint32_t hash,
       uint32_t bucket,
       Handle<> key,
       Handle<> value);
@@ -52,9 +52,10 @@ inline uint64_t rdtsc() {
   uint64_t startTime = hermes::rdtsc(); \
   unsigned curOpcode = (unsigned)OpCode::Call;
 
-#define RECORD_OPCODE_START_TIME               \
-  curOpcode = (unsigned)ip->opCode;            \
-  runtime.opcodeExecuteFrequency[curOpcode]++; \
+#define RECORD_OPCODE_START_TIME                                  \
+  runtime.opcodePairFrequency[curOpcode][(unsigned)ip->opCode]++; \
+  curOpcode = (unsigned)ip->opCode;                               \
+  runtime.opcodeExecuteFrequency[curOpcode]++;                    \
   startTime = hermes::rdtsc();
 
 #define UPDATE_OPCODE_TIME_SPENT \
@@ -18,6 +18,49 @@ namespace vm {
 using SlotIndex = uint32_t;
 
 class HiddenClass;
+struct WeakRootAcceptor;
+
+/// Number of classes a property cache entry can hold in addition to its
+/// primary class, before the site is considered megamorphic.
+static constexpr unsigned kPolyPropertyCacheSize = SH_POLY_PROPERTY_CACHE_SIZE;
+
+/// The secondary classes of a property cache entry, used by call sites that
+/// see a few different classes. Only own properties are cached here; a read
+/// from the prototype always uses the primary class of the entry. Inline fast
+/// paths (interpreter and JIT) only check the primary class, and fall back to
+/// the runtime, which checks these next.
+struct PolyPropertyCache {
+  struct Entry {
+    /// Cached class, or null if the entry is unused.
+    WeakRoot<HiddenClass> clazz{nullptr};
+
+    /// Cached property index.
+    SlotIndex slot{0};
+  };
+
+  Entry entries[kPolyPropertyCacheSize];
+
+  /// Set once the site has seen a new class after all entries were taken.
+  /// From then on, misses only replace the primary class.
+  bool megamorphic{false};
+
+  /// \return the entry caching \p clazzPtr, or nullptr if there is none.
+  const Entry *find(CompressedPointer clazzPtr) const {
+    for (const Entry &entry : entries)
+      if (entry.clazz == clazzPtr)
+        return &entry;
+    return nullptr;
+  }
+
+  /// Cache \p slot for \p clazzPtr in an unused entry.
+  /// \return false if all entries are taken.
+  bool add(CompressedPointer clazzPtr, SlotIndex slot);
+
+  /// Record the transition of the site to megamorphic.
+  void setMegamorphic();
+
+  void markWeakRoots(WeakRootAcceptor &acceptor);
+};
 
 /// A cache entry for property writes.
 struct WritePropertyCacheEntry {
@@ -26,6 +69,24 @@ struct WritePropertyCacheEntry {
 
   /// Cached property index.
   SlotIndex slot{0};
+
+  /// Additional classes for polymorphic sites.
+  PolyPropertyCache poly{};
+
+  /// \return the cached slot for an object of class \p clazzPtr, or nullptr
+  /// if there is none.
+  const SlotIndex *find(CompressedPointer clazzPtr) const {
+    if (clazz == clazzPtr)
+      return &slot;
+    const PolyPropertyCache::Entry *entry = poly.find(clazzPtr);
+    return entry ? &entry->slot : nullptr;
+  }
+
+  /// Cache \p newSlot for objects of class \p clazzPtr, filling the primary
+  /// class first and then the polymorphic entries.
+  void set(CompressedPointer clazzPtr, SlotIndex newSlot);
+
+  void markWeakRoots(WeakRootAcceptor &acceptor);
 };
 
 /// A cache entry for property reads.
@@ -45,6 +106,33 @@ struct ReadPropertyCacheEntry {
   /// HiddenClass, or in the object's prototype if \p clazz is the
   /// prototype's HiddenClass.
   SlotIndex slot{0};
+
+  /// Additional classes for polymorphic sites, for own properties only.
+  PolyPropertyCache poly{};
+
+  /// \return the cached slot for an own property of an object of class
+  /// \p clazzPtr, or nullptr if there is none.
+  const SlotIndex *findOwn(CompressedPointer clazzPtr) const {
+    if (clazz == clazzPtr)
+      return &slot;
+    const PolyPropertyCache::Entry *entry = poly.find(clazzPtr);
+    return entry ? &entry->slot : nullptr;
+  }
+
+  /// Cache \p newSlot for an own property of objects of class \p clazzPtr,
+  /// filling the primary class first and then the polymorphic entries.
+  void setOwn(CompressedPointer clazzPtr, SlotIndex newSlot);
+
+  /// Cache \p newSlot for a property found in the prototype of class
+  /// \p protoClazzPtr, for objects of class \p objClazzPtr. This always
+  /// takes the primary class; an own property cached there is moved to the
+  /// polymorphic entries if there is room.
+  void setProto(
+      CompressedPointer protoClazzPtr,
+      CompressedPointer objClazzPtr,
+      SlotIndex newSlot);
+
+  void markWeakRoots(WeakRootAcceptor &acceptor);
 };
 
 static_assert(
@@ -55,6 +143,9 @@ static_assert(
 static_assert(
     offsetof(SHWritePropertyCacheEntry, slot) ==
     offsetof(WritePropertyCacheEntry, slot));
+static_assert(
+    offsetof(SHWritePropertyCacheEntry, poly) ==
+    offsetof(WritePropertyCacheEntry, poly));
 static_assert(
     sizeof(SHReadPropertyCacheEntry) == sizeof(ReadPropertyCacheEntry));
 static_assert(
@@ -63,6 +154,14 @@ static_assert(
 static_assert(
     offsetof(SHReadPropertyCacheEntry, slot) ==
     offsetof(ReadPropertyCacheEntry, slot));
+static_assert(
+    offsetof(SHReadPropertyCacheEntry, poly) ==
+    offsetof(ReadPropertyCacheEntry, poly));
+static_assert(
+    sizeof(SHPolyPropertyCache) == sizeof(PolyPropertyCache));
+static_assert(
+    offsetof(SHPolyPropertyCache, megamorphic) ==
+    offsetof(PolyPropertyCache, megamorphic));
 
 } // namespace vm
 } // namespace hermes
@@ -753,6 +753,16 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// CallResult<HermesValue> or the thrown object in 'thrownObject'.
   CallResult<HermesValue> interpretFunction(CodeBlock *newCodeBlock);
 
+#if HERMESVM_JIT
+  /// Continue executing the current frame, which belongs to JIT'ed code of
+  /// \p codeBlock that could not continue, in the interpreter starting at
+  /// \p ip. The frame is popped when it returns or throws, and its result is
+  /// returned to the JIT'ed code instead of the caller.
+  CallResult<HermesValue> interpretDeoptimizedFrame(
+      CodeBlock *codeBlock,
+      const inst::Inst *ip);
+#endif
+
 #ifdef HERMES_ENABLE_DEBUGGER
   /// Single-step the provided function, update the interpreter state.
   ExecutionStatus stepFunction(InterpreterState &state);
@@ -820,6 +830,10 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// Track time spent of each opcode in the interpreter, in CPU cycles.
   uint64_t timeSpent[256] = {0};
 
+  /// Track how often each opcode is immediately followed by another one, to
+  /// find candidates for superinstructions. Indexed by [first][second].
+  uint32_t opcodePairFrequency[256][256] = {{0}};
+
   /// Dump opcode stats to a stream.
   void dumpOpcodeStats(llvh::raw_ostream &os) const;
 #endif
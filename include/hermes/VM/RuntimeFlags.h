@@ -197,6 +197,36 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::cat(GCCategory),
       llvh::cl::init(false)};
 
+  llvh::cl::opt<unsigned> GCMarkThreads{
+      "gc-mark-threads",
+      llvh::cl::desc(
+          "Number of threads marking the old generation in a concurrent "
+          "collection"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(vm::GCConfig::getDefaultNumMarkThreads())};
+
+  llvh::cl::opt<unsigned> GCEvacuationThreads{
+      "gc-evacuation-threads",
+      llvh::cl::desc(
+          "Number of threads evacuating the young generation in a collection"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(vm::GCConfig::getDefaultNumEvacuationThreads())};
+
+  llvh::cl::opt<bool> GCPretenure{
+      "gc-pretenure",
+      llvh::cl::desc(
+          "Allocate objects from allocation sites whose objects survive young "
+          "gen collections directly in the old generation"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(vm::GCConfig::getDefaultAllocationSitePretenuring())};
+
+  llvh::cl::opt<unsigned> GCTargetMaxPause{
+      "gc-target-max-pause",
+      llvh::cl::desc(
+          "Pause time in milliseconds that the GC tries to stay under"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(vm::GCConfig::getDefaultTargetMaxPauseMs())};
+
   llvh::cl::opt<bool> EnableJIT{
       "Xjit",
       llvh::cl::Hidden,
@@ -219,6 +249,15 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::desc("default minimum number of invocations to JIT compile"),
       llvh::cl::init(1 << 5)};
 
+  llvh::cl::opt<uint32_t> JITOSRThreshold{
+      "Xjit-osr-threshold",
+      llvh::cl::Hidden,
+      llvh::cl::cat(RuntimeCategory),
+      llvh::cl::desc(
+          "minimum number of loop iterations in the interpreter before "
+          "JIT compiling the function and entering it mid-loop"),
+      llvh::cl::init(1 << 10)};
+
   llvh::cl::opt<uint32_t> JITMemoryLimit{
       "Xjit-memory-limit",
       llvh::cl::Hidden,
@@ -226,6 +265,24 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::desc("maximum size for JIT code (in bytes)"),
       llvh::cl::init(32u << 20)};
 
+  llvh::cl::opt<bool> JITAsync{
+      "Xjit-async",
+      llvh::cl::Hidden,
+      llvh::cl::cat(RuntimeCategory),
+      llvh::cl::desc(
+          "JIT compile functions on a background thread while they keep "
+          "running in the interpreter"),
+      llvh::cl::init(false)};
+
+  llvh::cl::opt<bool> JITSpeculate{
+      "Xjit-speculate",
+      llvh::cl::Hidden,
+      llvh::cl::cat(RuntimeCategory),
+      llvh::cl::desc(
+          "JIT compile arithmetic assuming the operand types seen by the "
+          "interpreter, deoptimizing when they change"),
+      llvh::cl::init(false)};
+
   /// To get the value of this CLI option, use the method below.
   llvh::cl::opt<unsigned> DumpJITCode{
       "Xdump-jitcode",
@@ -256,6 +313,32 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::init(true)
 #endif
   };
+
+  llvh::cl::opt<vm::JITPerfMapMode> JITPerfMap{
+      "Xjit-perf-map",
+      llvh::cl::Hidden,
+      llvh::cl::cat(RuntimeCategory),
+      llvh::cl::desc("describe JIT'ed code to external profilers"),
+      llvh::cl::init(vm::JITPerfMapMode::None),
+      values(
+          clEnumValN(vm::JITPerfMapMode::None, "none", "Disabled"),
+          clEnumValN(
+              vm::JITPerfMapMode::PerfMap,
+              "map",
+              "Append entries to /tmp/perf-<pid>.map"),
+          clEnumValN(
+              vm::JITPerfMapMode::JitDump,
+              "jitdump",
+              "Write jit-<pid>.dump in the current directory"))};
+
+  llvh::cl::opt<std::string> JITCodeCacheDir{
+      "Xjit-code-cache",
+      llvh::cl::Hidden,
+      llvh::cl::cat(RuntimeCategory),
+      llvh::cl::desc(
+          "Directory where JIT'ed code is stored and reused by later runs"),
+      llvh::cl::value_desc("dir"),
+      llvh::cl::init("")};
 };
 
 /// All command line runtime options relevant to the VM, including options
@@ -209,6 +209,12 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
     return stringIDMap_[stringID];
   }
 
+  /// \return the \c SymbolID for a string by string index, or an invalid
+  /// SymbolID if the symbol has not been created yet.
+  SymbolID getSymbolIDIfExists(StringID stringID) const {
+    return stringIDMap_[stringID];
+  }
+
   /// \return the \c SymbolID for a string by string index. The symbol may not
   /// already exist for this given string ID. Hence we may need to create it
   /// on the fly.
@@ -99,6 +99,7 @@ class SegmentedArrayBase final : public VariableSizeRuntimeCell,
     friend void SegmentSmallBuildMeta(
         const GCCell *cell,
         Metadata::Builder &mb);
+    friend struct RuntimeOffsets;
 
    private:
     static const VTable vt;
@@ -294,6 +295,17 @@ class SegmentedArrayBase final : public VariableSizeRuntimeCell,
   void setNonPtr(Runtime &runtime, TotalIndex index, HVType val) {
     atRef<inl>(runtime, index).setNonPtr(val, runtime.getHeap());
   }
+  /// Sets the element located at \p index to \p val, skipping the write
+  /// barrier when neither the old nor the new value is a pointer and the old
+  /// value is not a symbol. Arrays of numbers and booleans take this path.
+  template <Inline inl = Inline::No>
+  void setWithBarrierIfNeeded(Runtime &runtime, TotalIndex index, HVType val) {
+    auto &ref = atRef<inl>(runtime, index);
+    if (!val.isPointer() && !ref.isPointer() && !ref.isSymbol())
+      ref.template set<std::false_type>(val, runtime.getHeap());
+    else
+      ref.set(val, runtime.getHeap());
+  }
 
   /// Gets the size of the SegmentedArray. The size is the number of elements
   /// currently active in the array.
@@ -411,6 +423,7 @@ class SegmentedArrayBase final : public VariableSizeRuntimeCell,
   friend void SegmentedArraySmallBuildMeta(
       const GCCell *cell,
       Metadata::Builder &mb);
+  friend struct RuntimeOffsets;
 
  private:
   /// Throws a RangeError with a descriptive message describing the attempted
@@ -96,6 +96,15 @@ class IdentifierHashTable {
     identifierTable_ = table;
   }
 
+  /// Replace the entries of this hash table with those of \p other. The
+  /// identifier table pointer is kept, so the owning IdentifierTable must hold
+  /// the same lookup vector as \p other's.
+  void copyFrom(const IdentifierHashTable &other) {
+    table_.copyFrom(other.table_);
+    size_ = other.size_;
+    nonEmptyEntryCount_ = other.nonEmptyEntryCount_;
+  }
+
   /// \return the size of the hash table (i.e. number of valid entries).
   uint32_t size() const {
     return size_;
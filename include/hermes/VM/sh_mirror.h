@@ -24,15 +24,29 @@ typedef struct SHUnit SHUnit;
 /// the offsets of certain fields without needing to make the actual C++ version
 /// available here.
 
+/// Number of additional classes held by a property cache entry for
+/// polymorphic sites.
+#define SH_POLY_PROPERTY_CACHE_SIZE 3
+
+typedef struct SHPolyPropertyCache {
+  struct {
+    SHCompressedPointerRawType clazz;
+    uint32_t slot;
+  } entries[SH_POLY_PROPERTY_CACHE_SIZE];
+  bool megamorphic;
+} SHPolyPropertyCache;
+
 typedef struct SHWritePropertyCacheEntry {
   SHCompressedPointerRawType clazz;
   uint32_t slot;
+  SHPolyPropertyCache poly;
 } SHWritePropertyCacheEntry;
 
 typedef struct SHReadPropertyCacheEntry {
   SHCompressedPointerRawType clazz;
   SHCompressedPointerRawType negMatchClazz;
   uint32_t slot;
+  SHPolyPropertyCache poly;
 } SHReadPropertyCacheEntry;
 
 /// Struct mirroring the layout of GCCell.
@@ -975,6 +975,15 @@ SHERMES_EXPORT void _sh_prstore_indirect(
     uint32_t propIndex,
     SHLegacyValue *value);
 
+/// Store a non-pointer property into indirect storage, over a value that is
+/// not a pointer either, without a write barrier. Note that propIndex is
+/// relative to the indirect storage.
+SHERMES_EXPORT void _sh_prstore_indirect_np(
+    SHRuntime *shr,
+    SHLegacyValue *target,
+    uint32_t propIndex,
+    SHLegacyValue *value);
+
 SHERMES_EXPORT void _sh_unreachable() __attribute__((noreturn));
 
 static inline SHLegacyValue
@@ -1006,6 +1015,28 @@ static inline void _sh_prstore(
   }
 }
 
+/// Store a property into direct or indirect storage depending on its index,
+/// when both \p value and the value it replaces are known not to be pointers.
+/// Such a store needs no write barrier.
+static inline void _sh_prstore_np(
+    SHRuntime *shr,
+    SHLegacyValue *target,
+    uint32_t propIndex,
+    SHLegacyValue *value) {
+  assert(!_sh_ljs_is_pointer(*value));
+  if (propIndex < HERMESVM_DIRECT_PROPERTY_SLOTS) {
+#ifndef HERMESVM_BOXED_DOUBLES
+    ((SHJSObjectAndDirectProps *)_sh_ljs_get_pointer(*target))
+        ->directProps[propIndex] = *value;
+#else
+    _sh_prstore_direct(shr, target, propIndex, value);
+#endif
+  } else {
+    _sh_prstore_indirect_np(
+        shr, target, propIndex - HERMESVM_DIRECT_PROPERTY_SLOTS, value);
+  }
+}
+
 /// Store a bool property into direct or indirect storage depending on its
 /// index.
 static inline void _sh_prstore_bool(
@@ -53,6 +53,9 @@ STATISTIC(
 STATISTIC(
     NumPutCacheSlots,
     "Number of cache slots allocated for all put property instructions");
+STATISTIC(
+    NumBarrierFreeStores,
+    "Number of property stores emitted without a write barrier");
 
 /// Given a list of basic blocks \p blocks linearized into the order they will
 /// be generated, \return the set of those basic blocks containing backwards
@@ -1047,9 +1050,21 @@ void HBCISel::generateLoadPropertyInst(
     LoadPropertyInst *Inst,
     BasicBlock *next) {
   auto resultReg = encodeValue(Inst);
-  auto objReg = encodeValue(Inst->getObject());
   auto prop = Inst->getProperty();
 
+  // The SuperInstructions pass leaves the global object as a literal only
+  // when the load can read it directly.
+  if (llvh::isa<GlobalObject>(Inst->getObject())) {
+    auto *Lit = cast<LiteralString>(prop);
+    BCFGen_->emitGetByIdGlobal(
+        resultReg,
+        acquirePropertyReadCacheIndex(Lit->getValue()),
+        BCFGen_->getIdentifierID(Lit));
+    return;
+  }
+
+  auto objReg = encodeValue(Inst->getObject());
+
   if (auto *Lit = llvh::dyn_cast<LiteralString>(prop)) {
     auto id = BCFGen_->getIdentifierID(Lit);
     if (id > UINT16_MAX) {
@@ -1113,12 +1128,18 @@ void HBCISel::generateTryLoadGlobalPropertyInst(
     TryLoadGlobalPropertyInst *Inst,
     BasicBlock *next) {
   auto resultReg = encodeValue(Inst);
-  auto objReg = encodeValue(Inst->getObject());
   auto prop = Inst->getProperty();
 
   auto *Lit = cast<LiteralString>(prop);
 
   auto id = BCFGen_->getIdentifierID(Lit);
+  if (llvh::isa<GlobalObject>(Inst->getObject())) {
+    BCFGen_->emitTryGetByIdGlobal(
+        resultReg, acquirePropertyReadCacheIndex(Lit->getValue()), id);
+    return;
+  }
+
+  auto objReg = encodeValue(Inst->getObject());
   if (id > UINT16_MAX) {
     BCFGen_->emitTryGetByIdLong(
         resultReg, objReg, acquirePropertyReadCacheIndex(Lit->getValue()), id);
@@ -1797,6 +1818,22 @@ void HBCISel::generateLoadParamInst(
   }
 }
 
+void HBCISel::generateHBCLoadParamPropertyInst(
+    hermes::HBCLoadParamPropertyInst *Inst,
+    hermes::BasicBlock *next) {
+  auto resultReg = encodeValue(Inst);
+  uint32_t paramIndex = Inst->getParam()->getIndexInParamList();
+  assert(
+      paramIndex <= UINT8_MAX &&
+      "HBCLoadParamPropertyInst parameter index must fit in a byte");
+  auto *Lit = Inst->getProperty();
+  BCFGen_->emitGetByIdParam(
+      resultReg,
+      paramIndex,
+      acquirePropertyReadCacheIndex(Lit->getValue()),
+      BCFGen_->getIdentifierID(Lit));
+}
+
 void HBCISel::generateCreateScopeInst(
     hermes::CreateScopeInst *Inst,
     hermes::BasicBlock *next) {
@@ -2045,6 +2082,16 @@ void HBCISel::generatePrLoadInst(PrLoadInst *inst, BasicBlock *) {
 void HBCISel::generatePrStoreInst(PrStoreInst *Inst, BasicBlock *) {
   auto valueReg = encodeValue(Inst->getOperand(PrStoreInst::StoredValueIdx));
   auto objReg = encodeValue(Inst->getObject());
+  if (Inst->getNonPointer()) {
+    ++NumBarrierFreeStores;
+    if (Inst->getPropIndex() <= UINT8_MAX) {
+      BCFGen_->emitPutOwnNPBySlotIdx(objReg, valueReg, Inst->getPropIndex());
+    } else {
+      BCFGen_->emitPutOwnNPBySlotIdxLong(
+          objReg, valueReg, Inst->getPropIndex());
+    }
+    return;
+  }
   if (Inst->getPropIndex() <= UINT8_MAX) {
     BCFGen_->emitPutOwnBySlotIdx(objReg, valueReg, Inst->getPropIndex());
   } else {
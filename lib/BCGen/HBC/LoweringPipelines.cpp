@@ -15,6 +15,7 @@
 #include "hermes/BCGen/HBC/Passes/OptParentEnvironment.h"
 #include "hermes/BCGen/HBC/Passes/PeepholeLowering.h"
 #include "hermes/BCGen/HBC/Passes/ReorderRegisters.h"
+#include "hermes/BCGen/HBC/Passes/SuperInstructions.h"
 #include "hermes/BCGen/LowerScopes.h"
 #include "hermes/BCGen/LowerStoreInstrs.h"
 #include "hermes/BCGen/Lowering.h"
@@ -115,6 +116,9 @@ void lowerAllocatedFunctionIR(
     PM.addPass(new LoadConstantValueNumbering(RA));
   }
   PM.addPass(new SpillRegisters(RA));
+  if (options.optimizationEnabled && options.superInstructions) {
+    PM.addPass(new SuperInstructions(RA));
+  }
   if (options.basicBlockProfiling) {
     // Insert after all other passes so that it sees final basic block
     // list.
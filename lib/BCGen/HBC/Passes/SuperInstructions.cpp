@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#define DEBUG_TYPE "SuperInstructions"
+
+#include "hermes/BCGen/HBC/Passes/SuperInstructions.h"
+#include "hermes/IR/IRBuilder.h"
+#include "hermes/IR/Instrs.h"
+#include "hermes/Support/Statistic.h"
+
+STATISTIC(NumLoadParamProperty, "Number of fused LoadParam/LoadProperty");
+STATISTIC(
+    NumLoadGlobalProperty,
+    "Number of fused GetGlobalObject/LoadProperty");
+
+namespace hermes::hbc {
+
+namespace {
+
+/// \return the LoadPropertyInst that can be fused with \p LPI into a single
+/// GetByIdParam, or nullptr if there isn't one.
+LoadPropertyInst *getFusableLoadProperty(LoadParamInst *LPI) {
+  // The parameter index is encoded in a single byte.
+  if (LPI->getParam()->getIndexInParamList() > UINT8_MAX)
+    return nullptr;
+  // The parameter value must not be needed anywhere else, since it will no
+  // longer be materialized in a register.
+  if (!LPI->hasOneUser())
+    return nullptr;
+  auto *LPR = llvh::dyn_cast<LoadPropertyInst>(LPI->getUsers()[0]);
+  if (!LPR || LPR->getObject() != LPI ||
+      !llvh::isa<LiteralString>(LPR->getProperty()))
+    return nullptr;
+  // Parameters are never written after function entry, so reading the
+  // parameter at the point of the property load is equivalent.
+  return LPR;
+}
+
+/// \return the load of a named property of \p GGO that can be fused with it
+/// into a single GetByIdGlobal or TryGetByIdGlobal, or nullptr if there isn't
+/// one.
+BaseLoadPropertyInst *getFusableLoadGlobalProperty(
+    HBCGetGlobalObjectInst *GGO) {
+  if (!GGO->hasOneUser())
+    return nullptr;
+  Instruction *user = GGO->getUsers()[0];
+  if (!llvh::isa<LoadPropertyInst>(user) &&
+      !llvh::isa<TryLoadGlobalPropertyInst>(user))
+    return nullptr;
+  auto *LPR = cast<BaseLoadPropertyInst>(user);
+  if (LPR->getObject() != GGO || !llvh::isa<LiteralString>(LPR->getProperty()))
+    return nullptr;
+  return LPR;
+}
+
+} // namespace
+
+bool SuperInstructions::runOnFunction(Function *F) {
+  IRBuilder builder(F);
+  IRBuilder::InstructionDestroyer destroyer;
+  bool changed = false;
+
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      if (auto *GGO = llvh::dyn_cast<HBCGetGlobalObjectInst>(&I)) {
+        // ISel emits the fused instruction for a property load whose object
+        // is the global object literal, so there is no new instruction here.
+        if (BaseLoadPropertyInst *LPR = getFusableLoadGlobalProperty(GGO)) {
+          LPR->setOperand(
+              builder.getGlobalObject(), BaseLoadPropertyInst::ObjectIdx);
+          destroyer.add(GGO);
+          ++NumLoadGlobalProperty;
+          changed = true;
+        }
+        continue;
+      }
+
+      auto *LPI = llvh::dyn_cast<LoadParamInst>(&I);
+      if (!LPI)
+        continue;
+      LoadPropertyInst *LPR = getFusableLoadProperty(LPI);
+      if (!LPR)
+        continue;
+
+      builder.setInsertionPoint(LPR);
+      builder.setLocation(LPR->getLocation());
+      auto *fused = builder.createHBCLoadParamPropertyInst(
+          LPI->getParam(), cast<LiteralString>(LPR->getProperty()));
+      fused->setStatementIndex(LPR->getStatementIndex());
+      fused->setType(LPR->getType());
+      RA_.updateRegister(fused, RA_.getRegister(LPR));
+      LPR->replaceAllUsesWith(fused);
+
+      destroyer.add(LPR);
+      destroyer.add(LPI);
+      ++NumLoadParamProperty;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace hermes::hbc
+
+#undef DEBUG_TYPE
@@ -34,9 +34,16 @@
 
 #include "llvh/ADT/BitVector.h"
 #include "llvh/ADT/SetVector.h"
+#include "llvh/ADT/Statistic.h"
+
+#define DEBUG_TYPE "sh"
 
 using namespace hermes;
 
+STATISTIC(
+    NumBarrierFreeStores,
+    "Number of property stores emitted without a write barrier");
+
 namespace {
 /// Generates the correct label for BasicBlock \p B based on \p bbMap and
 /// outputs it through \p OS.
@@ -2035,6 +2042,9 @@ class InstrGen {
     generateRegister(*inst.getSingleOperand());
     os_ << ");\n";
   }
+  void generateHBCLoadParamPropertyInst(HBCLoadParamPropertyInst &inst) {
+    hermes_fatal("HBCLoadParamPropertyInst is not used by SH.");
+  }
   void generateLIRGetThisNSInst(LIRGetThisNSInst &inst) {
     os_.indent(2);
     generateRegister(inst);
@@ -2115,7 +2125,12 @@ class InstrGen {
     os_.indent(2);
     const char *suffix = "";
     Type propType = inst.getStoredValue()->getType();
-    if (propType.isNumberType()) {
+    if (inst.getNonPointer()) {
+      // Neither the old nor the new value is a pointer, so no barrier is
+      // needed.
+      ++NumBarrierFreeStores;
+      suffix = "_np";
+    } else if (propType.isNumberType()) {
       suffix = "_number";
     } else if (propType.isBooleanType()) {
       suffix = "_bool";
@@ -3005,3 +3020,5 @@ void sh::generateSH(
   LineDirectiveEmitter emitter{OS};
   generateModule(M, emitter, options);
 }
+
+#undef DEBUG_TYPE
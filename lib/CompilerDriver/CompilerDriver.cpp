@@ -592,6 +592,13 @@ static CLFlag ReorderRegisters(
     "reorder registers for better JIT performance",
     CompilerCategory);
 
+static CLFlag SuperInstructions(
+    'f',
+    "super-instructions",
+    false,
+    "fusion of common instruction sequences into superinstructions",
+    CompilerCategory);
+
 static opt<unsigned> InlineMaxSize(
     "Xinline-max-size",
     cl::init(1),
@@ -1763,9 +1770,11 @@ CompileResult processBytecodeFile(std::unique_ptr<llvh::MemoryBuffer> fileBuf) {
 
 /// Compile the given module \p M with the options \p genOptions in a form
 /// suitable for immediate execution (i.e. no expectation of persistence).
+/// \p sourceHash is the hash of the source the module was compiled from.
 /// \return the compile result.
 CompileResult generateBytecodeForExecution(
-    hbc::BCProviderFromSrc::CompilationData &&compilationData) {
+    hbc::BCProviderFromSrc::CompilationData &&compilationData,
+    const SHA1 &sourceHash) {
   std::shared_ptr<Context> context = compilationData.M->shareContext();
   CompileResult result{Success};
   if (cl::BytecodeFormat == cl::BytecodeFormatKind::HBC) {
@@ -1779,8 +1788,11 @@ CompileResult generateBytecodeForExecution(
     }
 
     assert(BM && "BytecodeModule should not be null if no errors");
-    result.bytecodeProvider = hbc::BCProviderFromSrc::createFromBytecodeModule(
+    auto provider = hbc::BCProviderFromSrc::createFromBytecodeModule(
         std::move(BM), std::move(compilationData));
+    // Identifies the bytecode, for example for the JIT code cache.
+    provider->setSourceHash(sourceHash);
+    result.bytecodeProvider = std::move(provider);
   } else {
     llvm_unreachable("Invalid bytecode kind for execution");
     result = InvalidFlags;
@@ -2063,6 +2075,7 @@ CompileResult processSourceFiles(
 
   genOptions.stripFunctionNames = cl::StripFunctionNames;
   genOptions.reorderRegisters = cl::ReorderRegisters;
+  genOptions.superInstructions = cl::SuperInstructions;
 
   // If the dump target is None, return bytecode in an executable form.
   if (cl::DumpTarget == Execute) {
@@ -2070,7 +2083,8 @@ CompileResult processSourceFiles(
         !sourceMapGen &&
         "validateFlags() should enforce no source map output for execution");
     return generateBytecodeForExecution(
-        hbc::BCProviderFromSrc::CompilationData{genOptions, M, semCtx});
+        hbc::BCProviderFromSrc::CompilationData{genOptions, M, semCtx},
+        sourceHash);
   }
 
   BaseBytecodeMap baseBytecodeMap;
@@ -438,9 +438,12 @@ bool executeHBCBytecodeImpl(
   runtime->getJITContext().setForceJIT(options.forceJIT);
   runtime->getJITContext().setMemoryLimit(options.jitMemoryLimit);
   runtime->getJITContext().setDefaultExecThreshold(options.jitThreshold);
+  runtime->getJITContext().setOSRThreshold(options.jitOSRThreshold);
   runtime->getJITContext().setDumpJITCode(options.dumpJITCode);
   runtime->getJITContext().setCrashOnError(options.jitCrashOnError);
   runtime->getJITContext().setEmitAsserts(options.jitEmitAsserts);
+  runtime->getJITContext().setAsyncCompile(options.jitAsync);
+  runtime->getJITContext().setSpeculate(options.jitSpeculate);
 
   if (options.timeLimit > 0) {
     runtime->timeLimitMonitor = vm::TimeLimitMonitor::getOrCreate();
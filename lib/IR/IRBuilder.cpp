@@ -1012,6 +1012,14 @@ LoadParamInst *IRBuilder::createLoadParamInst(JSDynamicParam *param) {
   return inst;
 }
 
+HBCLoadParamPropertyInst *IRBuilder::createHBCLoadParamPropertyInst(
+    JSDynamicParam *param,
+    LiteralString *property) {
+  auto inst = new HBCLoadParamPropertyInst(param, property);
+  insert(inst);
+  return inst;
+}
+
 HBCCreateFunctionEnvironmentInst *
 IRBuilder::createHBCCreateFunctionEnvironmentInst(
     VariableScope *scope,
@@ -1458,6 +1458,11 @@ bool Verifier::visitHBCLoadConstInst(hermes::HBCLoadConstInst const &Inst) {
 bool Verifier::visitLoadParamInst(hermes::LoadParamInst const &Inst) {
   return true;
 }
+bool Verifier::visitHBCLoadParamPropertyInst(
+    const HBCLoadParamPropertyInst &Inst) {
+  // Nothing to verify at this point.
+  return true;
+}
 bool Verifier::visitHBCCompareBranchInst(const HBCCompareBranchInst &Inst) {
   return visitCondBranchLikeInst(Inst) && visitBinaryOperatorLikeInst(Inst);
 }
@@ -822,6 +822,9 @@ class TypeInferenceImpl {
   Type inferLIRGetThisNSInst(LIRGetThisNSInst *inst) {
     return *inst->getInherentType();
   }
+  Type inferHBCLoadParamPropertyInst(HBCLoadParamPropertyInst *inst) {
+    return Type::createAnyType();
+  }
   Type inferCreateThisInst(CreateThisInst *inst) {
     return Type::unionTy(Type::createObject(), Type::createUndefined());
   }
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/AllocationSiteTracker.h"
+
+#include "hermes/VM/CodeBlock.h"
+
+#include <algorithm>
+
+namespace hermes {
+namespace vm {
+
+void AllocationSiteTracker::sampleAllocation(
+    CodeBlock *codeBlock,
+    const inst::Inst *ip) {
+  sampleCountdown_ = kSampleInterval;
+  uint32_t offset = codeBlock->getOffsetOf(ip);
+  auto [it, inserted] =
+      siteIndices_.try_emplace({codeBlock, offset}, (SiteIndex)sites_.size());
+  if (inserted)
+    sites_.push_back({codeBlock, offset, codeBlock->getRuntimeModule()});
+  pendingSite_ = it->second;
+}
+
+void AllocationSiteTracker::removeSites(const RuntimeModule *runtimeModule) {
+  // Compact the remaining sites, recording where each one moved so that the
+  // samples can follow.
+  std::vector<SiteIndex> newIndices(sites_.size(), kNoSite);
+  SiteIndex numKept = 0;
+  for (SiteIndex i = 0, e = sites_.size(); i != e; ++i) {
+    const Site &site = sites_[i];
+    if (site.runtimeModule == runtimeModule) {
+      if (site.pretenured)
+        --numPretenuredSites_;
+      continue;
+    }
+    newIndices[i] = numKept;
+    sites_[numKept++] = site;
+  }
+  if (numKept == sites_.size())
+    return;
+  sites_.resize(numKept);
+
+  siteIndices_.clear();
+  for (SiteIndex i = 0; i != numKept; ++i)
+    siteIndices_[{sites_[i].codeBlock, sites_[i].offset}] = i;
+
+  samples_.erase(
+      std::remove_if(
+          samples_.begin(),
+          samples_.end(),
+          [&newIndices](const Sample &sample) {
+            return newIndices[sample.site] == kNoSite;
+          }),
+      samples_.end());
+  for (Sample &sample : samples_)
+    sample.site = newIndices[sample.site];
+  if (pendingSite_ != kNoSite)
+    pendingSite_ = newIndices[pendingSite_];
+}
+
+void AllocationSiteTracker::decide(Site &site) {
+  // Pretenure when at least 90% of the samples survived, and only revert
+  // when fewer than half did, so that sites close to a threshold don't
+  // flip-flop.
+  if (!site.pretenured && site.numSurvived * 10 >= site.numSampled * 9) {
+    site.pretenured = true;
+    site.codeBlock->setPretenuredSite(site.offset, true);
+    ++numPretenuredSites_;
+  } else if (site.pretenured && site.numSurvived * 2 < site.numSampled) {
+    site.pretenured = false;
+    site.codeBlock->setPretenuredSite(site.offset, false);
+    --numPretenuredSites_;
+  }
+  site.numSampled = 0;
+  site.numSurvived = 0;
+}
+
+} // namespace vm
+} // namespace hermes
@@ -37,23 +37,15 @@ namespace vm {
 
 namespace {
 
-/// A helper to convert a SH-style function into a CallResult-style function.
+/// Invoke the SH-style function \p functionPtr, which will run in \p newFrame,
+/// and convert the result to a CallResult. The caller's IP must already be
+/// saved in \p newFrame. If an exception is thrown, \p newFrame is popped.
 template <typename Res, typename FnPtr, typename ProfileFn>
-inline CallResult<Res>
-_callWrapper(FnPtr functionPtr, Runtime &runtime, const ProfileFn &profileFn) {
-  // ScopedNativeDepthTracker depthTracker{runtime};
-  // if (LLVM_UNLIKELY(depthTracker.overflowed())) {
-  //   return runtime.raiseStackOverflow(
-  //       Runtime::StackOverflowKind::NativeStack);
-  // }
-
-  StackFramePtr newFrame{runtime.getStackPointer()};
-
-  auto *callerIP = runtime.getCurrentIP();
-  // If the caller is a JSFunction, we have to ensure that its IP is saved so we
-  // can use it for stack traces.
-  newFrame.getSavedIPRef() = HermesValue::encodeNativePointer(callerIP);
-
+inline CallResult<Res> _callWrapperInFrame(
+    FnPtr functionPtr,
+    Runtime &runtime,
+    StackFramePtr newFrame,
+    const ProfileFn &profileFn) {
   // If we call into the JIT (either directly or transitively), it may modify
   // the saved IP. Make sure the IP is restored before we return to the caller.
   auto restoreIP = llvh::make_scope_exit(
@@ -84,6 +76,26 @@ _callWrapper(FnPtr functionPtr, Runtime &runtime, const ProfileFn &profileFn) {
   }
 }
 
+/// A helper to convert a SH-style function into a CallResult-style function.
+template <typename Res, typename FnPtr, typename ProfileFn>
+inline CallResult<Res>
+_callWrapper(FnPtr functionPtr, Runtime &runtime, const ProfileFn &profileFn) {
+  // ScopedNativeDepthTracker depthTracker{runtime};
+  // if (LLVM_UNLIKELY(depthTracker.overflowed())) {
+  //   return runtime.raiseStackOverflow(
+  //       Runtime::StackOverflowKind::NativeStack);
+  // }
+
+  StackFramePtr newFrame{runtime.getStackPointer()};
+
+  auto *callerIP = runtime.getCurrentIP();
+  // If the caller is a JSFunction, we have to ensure that its IP is saved so we
+  // can use it for stack traces.
+  newFrame.getSavedIPRef() = HermesValue::encodeNativePointer(callerIP);
+
+  return _callWrapperInFrame<Res>(functionPtr, runtime, newFrame, profileFn);
+}
+
 } // unnamed namespace
 
 //===----------------------------------------------------------------------===//
@@ -1416,6 +1428,15 @@ CallResult<HermesValue> JSFunction::_jittedCall(
   return _callWrapper<HermesValue>(functionPtr, runtime, [](uint64_t) {});
 }
 
+CallResult<HermesValue> JSFunction::_jittedOSREntry(
+    JITCompiledFunctionPtr osrEntryPtr,
+    Runtime &runtime) {
+  // The frame was set up by the interpreter, which already saved the caller's
+  // IP in it.
+  return _callWrapperInFrame<HermesValue>(
+      osrEntryPtr, runtime, runtime.getCurrentFrame(), [](uint64_t) {});
+}
+
 CallResult<PseudoHandle<>> JSFunction::_callImpl(
     Handle<Callable> selfHandle,
     Runtime &runtime) {
@@ -292,18 +292,11 @@ void CodeBlock::markCachedHiddenClasses(
     WeakRootAcceptor &acceptor) {
   for (auto &prop :
        llvh::makeMutableArrayRef(readPropertyCache(), readPropertyCacheSize_)) {
-    if (prop.clazz) {
-      acceptor.acceptWeak(prop.clazz);
-    }
-    if (prop.negMatchClazz) {
-      acceptor.acceptWeak(prop.negMatchClazz);
-    }
+    prop.markWeakRoots(acceptor);
   }
   for (auto &prop : llvh::makeMutableArrayRef(
            writePropertyCache(), writePropertyCacheSize_)) {
-    if (prop.clazz) {
-      acceptor.acceptWeak(prop.clazz);
-    }
+    prop.markWeakRoots(acceptor);
   }
 }
 
@@ -55,6 +55,9 @@ GCBase::GCBase(
       name_(gcConfig.getName()),
       weakSlots_(gcConfig.getOccupancyTarget(), 0.5 /* sizingWeight */),
       weakMapEntrySlots_(gcConfig.getOccupancyTarget(), 0.5 /* sizingWeight */),
+      // Only Hades reports which sampled cells survived.
+      allocationSites_(
+          gcConfig.getAllocationSitePretenuring() && kind == HeapKind::HadesGC),
 #ifdef HERMES_MEMORY_INSTRUMENTATION
       allocationLocationTracker_(this),
       samplingAllocationTracker_(this),
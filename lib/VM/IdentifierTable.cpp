@@ -16,6 +16,8 @@
 
 #include "llvh/Support/Debug.h"
 
+#include <algorithm>
+
 namespace hermes {
 namespace vm {
 
@@ -453,6 +455,20 @@ void IdentifierTable::freeSymbol(uint32_t index) {
   freeID(index);
 }
 
+void IdentifierTable::copyLazyIdentifiersFrom(const IdentifierTable &other) {
+  assert(lookupVector_.size() == 0 && "Identifier table must be empty");
+  assert(
+      std::none_of(
+          other.lookupVector_.begin(),
+          other.lookupVector_.end(),
+          [](const LookupEntry &entry) { return entry.isStringPrim(); }) &&
+      "Only lazy identifiers can be shared");
+  lookupVector_ = other.lookupVector_;
+  markedSymbols_ = other.markedSymbols_;
+  hashTable_.copyFrom(other.hashTable_);
+  firstFreeID_ = other.firstFreeID_;
+}
+
 uint32_t IdentifierTable::allocNextID() {
   // If the free list is empty, grow the array.
   if (firstFreeID_ == LookupEntry::FREE_LIST_END) {
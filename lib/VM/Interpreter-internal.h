@@ -9,6 +9,9 @@
 #define HERMES_VM_INTERPRETER_INTERNAL_H
 
 #include "hermes/VM/Interpreter.h"
+#include "hermes/VM/JSArray.h"
+#include "hermes/VM/JSTypedArray.h"
+#include "hermes/VM/Operations.h"
 
 // Convenient aliases for operand registers.
 #if !defined(__arm__) || !defined(__clang__) || \
@@ -124,6 +127,113 @@ inline double doDec(double d) {
   return d - 1;
 }
 
+/// Load the element at \p index of the typed array \p obj.
+/// \return the element, or empty if it is out of range, the buffer is
+///   detached, or the element is a BigInt, which must be allocated.
+template <typename T, CellKind C>
+inline HermesValue
+getTypedArrayElementFast(Runtime &runtime, JSObject *obj, uint32_t index) {
+  if constexpr (std::is_integral<T>::value && sizeof(T) == 8) {
+    return HermesValue::encodeEmptyValue();
+  } else {
+    auto *arr = vmcast<JSTypedArray<T, C>>(obj);
+    if (LLVM_UNLIKELY(!arr->attached(runtime)) || index >= arr->getLength())
+      return HermesValue::encodeEmptyValue();
+    return HermesValue::encodeUntrustedNumberValue(arr->at(runtime, index));
+  }
+}
+
+/// Store the number \p value at \p index of the typed array \p obj.
+/// \return false if nothing was stored because the index is out of range, the
+///   buffer is detached, or the array stores BigInts.
+template <typename T, CellKind C>
+inline bool setTypedArrayElementFast(
+    Runtime &runtime,
+    JSObject *obj,
+    uint32_t index,
+    HermesValue value) {
+  if constexpr (std::is_integral<T>::value && sizeof(T) == 8) {
+    return false;
+  } else {
+    auto *arr = vmcast<JSTypedArray<T, C>>(obj);
+    if (LLVM_UNLIKELY(!arr->attached(runtime)) || index >= arr->getLength())
+      return false;
+    arr->at(runtime, index) = JSTypedArray<T, C>::toDestType(value);
+    return true;
+  }
+}
+
+/// Fast path of GetByVal for an existing element of a JSArray or an in range
+/// element of a numeric typed array, indexed by a number.
+/// \return the element, or empty if the generic path must be taken.
+inline HermesValue
+getByValElementFast(Runtime &runtime, JSObject *obj, HermesValue key) {
+  if (LLVM_UNLIKELY(!obj->hasFastIndexProperties()))
+    return HermesValue::encodeEmptyValue();
+  OptValue<uint32_t> index = toArrayIndexFastPath(key);
+  if (!index)
+    return HermesValue::encodeEmptyValue();
+
+  switch (obj->getKind()) {
+    case CellKind::JSArrayKind:
+      // Holes are empty and need a lookup in the prototype chain.
+      return vmcast<JSArray>(obj)->at(runtime, *index).unboxToHV(runtime);
+#define TYPED_ARRAY(name, type)    \
+  case CellKind::name##ArrayKind: \
+    return getTypedArrayElementFast<type, CellKind::name##ArrayKind>( \
+        runtime, obj, *index);
+#include "hermes/VM/TypedArrays.def"
+    default:
+      return HermesValue::encodeEmptyValue();
+  }
+}
+
+/// Fast path of PutByVal for an existing element of a non-frozen JSArray or an
+/// in range element of a numeric typed array, indexed by a number. Typed arrays
+/// additionally require \p value to be a number, since converting it may have
+/// side effects.
+/// \param base the register containing the target object.
+/// \return true if the value was stored, false if the generic path must be
+///   taken.
+inline bool putByValElementFast(
+    Runtime &runtime,
+    const PinnedHermesValue &base,
+    HermesValue key,
+    HermesValue value) {
+  auto *obj = vmcast<JSObject>(base);
+  if (LLVM_UNLIKELY(!obj->hasFastIndexProperties()))
+    return false;
+  OptValue<uint32_t> index = toArrayIndexFastPath(key);
+  if (!index)
+    return false;
+
+  switch (obj->getKind()) {
+    case CellKind::JSArrayKind: {
+      auto *arr = vmcast<JSArray>(obj);
+      // Storing into a hole may have to call a setter in the prototype chain.
+      if (LLVM_UNLIKELY(arr->getFlags().frozen) ||
+          arr->at(runtime, *index).isEmpty()) {
+        return false;
+      }
+      // Encoding may allocate, so reload the array afterwards.
+      auto shv = SmallHermesValue::encodeHermesValue(value, runtime);
+      arr = vmcast<JSArray>(base);
+      // Overwriting a number with a number needs no write barrier.
+      arr->getIndexedStorage(runtime)->setWithBarrierIfNeeded(
+          runtime, *index - arr->getBeginIndex(), shv);
+      return true;
+    }
+#define TYPED_ARRAY(name, type)                                        \
+  case CellKind::name##ArrayKind:                                      \
+    return value.isNumber() &&                                         \
+        setTypedArrayElementFast<type, CellKind::name##ArrayKind>(     \
+               runtime, obj, *index, value);
+#include "hermes/VM/TypedArrays.def"
+    default:
+      return false;
+  }
+}
+
 template <auto Oper, typename InstType>
 ExecutionStatus doOperSlowPath_RJS(
     Runtime &runtime,
@@ -168,6 +278,8 @@ ExecutionStatus doGetByIdSlowPath_RJS(
     Runtime &runtime,
     PinnedHermesValue *frameRegs,
     const Inst *ip,
+    PinnedHermesValue *objReg,
+    uint8_t cacheIdx,
     CodeBlock *curCodeBlock,
     uint32_t idVal,
     bool tryProp);
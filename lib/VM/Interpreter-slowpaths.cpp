@@ -44,6 +44,9 @@ HERMES_SLOW_STATISTIC(
 HERMES_SLOW_STATISTIC(
     NumGetByIdSlow,
     "NumGetByIdSlow: Number of property 'read by id' slow path");
+HERMES_SLOW_STATISTIC(
+    NumGetByIdPolyHits,
+    "NumGetByIdPolyHits: Number of property 'read by id' polymorphic hits");
 
 HERMES_SLOW_STATISTIC(
     NumPutByIdCacheEvicts,
@@ -54,6 +57,9 @@ HERMES_SLOW_STATISTIC(
 HERMES_SLOW_STATISTIC(
     NumPutByIdTransient,
     "NumPutByIdTransient: Number of property 'write by id' to non-objects");
+HERMES_SLOW_STATISTIC(
+    NumPutByIdPolyHits,
+    "NumPutByIdPolyHits: Number of property 'write by id' polymorphic hits");
 
 namespace hermes {
 namespace vm {
@@ -180,6 +186,14 @@ ExecutionStatus Interpreter::defineOwnByIdSlowPath(
   auto cacheIdx = ip->iDefineOwnById.op3;
   auto *cacheEntry = curCodeBlock->getWriteCacheEntry(cacheIdx);
   CompressedPointer clazzPtr{obj->getClassGCPtr()};
+  // The primary class was already checked, try the polymorphic entries.
+  if (const PolyPropertyCache::Entry *polyEntry =
+          cacheEntry->poly.find(clazzPtr)) {
+    ++NumPutByIdPolyHits;
+    JSObject::setNamedSlotValueUnsafe(
+        obj, runtime, polyEntry->slot, valueToStore);
+    return ExecutionStatus::RETURNED;
+  }
   auto id = ID(idVal);
   NamedPropertyDescriptor desc;
   OptValue<bool> hasOwnProp =
@@ -192,8 +206,7 @@ ExecutionStatus Interpreter::defineOwnByIdSlowPath(
     HiddenClass *clazz = vmcast<HiddenClass>(clazzPtr.getNonNull(runtime));
     if (LLVM_LIKELY(!clazz->isDictionaryNoCache()) &&
         LLVM_LIKELY(cacheIdx != hbc::PROPERTY_CACHING_DISABLED)) {
-      cacheEntry->clazz = clazzPtr;
-      cacheEntry->slot = desc.slot;
+      cacheEntry->set(clazzPtr, desc.slot);
     }
     // This must be valid because an own property was already found.
     JSObject::setNamedSlotValueUnsafe(obj, runtime, desc.slot, valueToStore);
@@ -878,9 +891,9 @@ CallResult<HermesValue> Interpreter::createThisImpl(
   CompressedPointer clazzPtr{lv.newTarget->getClassGCPtr()};
   // If we have a cache hit, reuse the cached offset and immediately
   // return the property.
-  if (LLVM_LIKELY(cacheEntry->clazz == clazzPtr)) {
-    auto shvPrototype = JSObject::getNamedSlotValueUnsafe(
-        *lv.newTarget, runtime, cacheEntry->slot);
+  if (const SlotIndex *slot = cacheEntry->findOwn(clazzPtr)) {
+    auto shvPrototype =
+        JSObject::getNamedSlotValueUnsafe(*lv.newTarget, runtime, *slot);
     if (LLVM_LIKELY(shvPrototype.isObject())) {
       lv.newTargetPrototype = vmcast<JSObject>(shvPrototype.getObject(runtime));
     } else {
@@ -1352,19 +1365,22 @@ ExecutionStatus doGetByIdSlowPath_RJS(
     Runtime &runtime,
     PinnedHermesValue *frameRegs,
     const Inst *ip,
+    PinnedHermesValue *objReg,
+    uint8_t cacheIdx,
     CodeBlock *curCodeBlock,
     uint32_t idVal,
     bool tryProp) {
   auto id = ID(idVal);
-  // NOTE: it is safe to use OnREG(GetById) here because all instructions
-  // have the same layout: opcode, registers, non-register operands, i.e.
-  // they only differ in the width of the last "identifier" field.
-  if (LLVM_UNLIKELY(!O2REG(GetById).isObject())) {
+  // NOTE: it is safe to use O1REG(GetById) here because all instructions
+  // write their result to the first operand. The object and the cache index
+  // are passed separately since the superinstructions don't read the object
+  // from a register, and so have fewer operands before the cache index.
+  if (LLVM_UNLIKELY(!objReg->isObject())) {
     ++NumGetByIdTransient;
     assert(!tryProp && "TryGetById can only be used on the global object");
     /* Slow path. */
-    auto resPH = Interpreter::getByIdTransient_RJS(
-        runtime, Handle<>(&O2REG(GetById)), id);
+    auto resPH =
+        Interpreter::getByIdTransient_RJS(runtime, Handle<>(objReg), id);
     if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -1372,11 +1388,20 @@ ExecutionStatus doGetByIdSlowPath_RJS(
     return ExecutionStatus::RETURNED;
   }
 
-  auto *obj = vmcast<JSObject>(O2REG(GetById));
-  auto cacheIdx = ip->iGetById.op3;
+  auto *obj = vmcast<JSObject>(*objReg);
   auto *cacheEntry = curCodeBlock->getReadCacheEntry(cacheIdx);
   CompressedPointer clazzPtr{obj->getClassGCPtr()};
 
+  // The primary class was already checked, try the polymorphic entries.
+  if (const PolyPropertyCache::Entry *polyEntry =
+          cacheEntry->poly.find(clazzPtr)) {
+    ++NumGetByIdPolyHits;
+    O1REG(GetById) =
+        JSObject::getNamedSlotValueUnsafe(obj, runtime, polyEntry->slot)
+            .unboxToHV(runtime);
+    return ExecutionStatus::RETURNED;
+  }
+
   NamedPropertyDescriptor desc;
   OptValue<bool> fastPathResult =
       JSObject::tryGetOwnNamedDescriptorFast(obj, runtime, id, desc);
@@ -1396,8 +1421,7 @@ ExecutionStatus doGetByIdSlowPath_RJS(
       (void)NumGetByIdCacheEvicts;
 #endif
       // Cache the class, id and property slot.
-      cacheEntry->clazz = clazzPtr;
-      cacheEntry->slot = desc.slot;
+      cacheEntry->setOwn(clazzPtr, desc.slot);
     }
 
     assert(
@@ -1412,11 +1436,11 @@ ExecutionStatus doGetByIdSlowPath_RJS(
   // Call to getNamedDescriptorUnsafe is safe because `id` is kept alive
   // by the IdentifierTable.
   JSObject *propObj = JSObject::getNamedDescriptorUnsafe(
-      Handle<JSObject>::vmcast(&O2REG(GetById)), runtime, id, desc);
+      Handle<JSObject>::vmcast(objReg), runtime, id, desc);
   if (propObj) {
     if (desc.flags.accessor)
       ++NumGetByIdAccessor;
-    else if (propObj != vmcast<JSObject>(O2REG(GetById)))
+    else if (propObj != vmcast<JSObject>(*objReg))
       ++NumGetByIdProto;
   } else {
     ++NumGetByIdNotFound;
@@ -1447,7 +1471,7 @@ ExecutionStatus doGetByIdSlowPath_RJS(
   // Getting properties is not affected by strictness, so just use false.
   const auto defaultPropOpFlags = DEFAULT_PROP_OP_FLAGS(false);
   auto resPH = JSObject::getNamed_RJS(
-      Handle<JSObject>::vmcast(&O2REG(GetById)),
+      Handle<JSObject>::vmcast(objReg),
       runtime,
       id,
       !tryProp ? defaultPropOpFlags : defaultPropOpFlags.plusMustExist(),
@@ -1527,6 +1551,16 @@ ExecutionStatus doGetByIdWithReceiverSlowPath_RJS(
   }
   auto cacheIdx = ip->iGetByIdWithReceiverLong.op3;
   auto *cacheEntry = curCodeBlock->getReadCacheEntry(cacheIdx);
+  auto *obj = vmcast<JSObject>(O2REG(GetByIdWithReceiverLong));
+  // The primary class was already checked, try the polymorphic entries.
+  if (const PolyPropertyCache::Entry *polyEntry =
+          cacheEntry->poly.find(obj->getClassGCPtr())) {
+    ++NumGetByIdPolyHits;
+    O1REG(GetByIdWithReceiverLong) =
+        JSObject::getNamedSlotValueUnsafe(obj, runtime, polyEntry->slot)
+            .unboxToHV(runtime);
+    return ExecutionStatus::RETURNED;
+  }
   auto resPH = JSObject::getNamedWithReceiver_RJS(
       Handle<JSObject>::vmcast(&O2REG(GetByIdWithReceiverLong)),
       runtime,
@@ -1686,6 +1720,14 @@ ExecutionStatus doPutByIdSlowPath_RJS(
   auto *cacheEntry = curCodeBlock->getWriteCacheEntry(cacheIdx);
   CompressedPointer clazzPtr{obj->getClassGCPtr()};
 
+  // The primary class was already checked, try the polymorphic entries.
+  if (const PolyPropertyCache::Entry *polyEntry =
+          cacheEntry->poly.find(clazzPtr)) {
+    ++NumPutByIdPolyHits;
+    JSObject::setNamedSlotValueUnsafe(obj, runtime, polyEntry->slot, shv);
+    return ExecutionStatus::RETURNED;
+  }
+
   NamedPropertyDescriptor desc;
   OptValue<bool> hasOwnProp =
       JSObject::tryGetOwnNamedDescriptorFast(obj, runtime, id, desc);
@@ -1706,8 +1748,7 @@ ExecutionStatus doPutByIdSlowPath_RJS(
       (void)NumPutByIdCacheEvicts;
 #endif
       // Cache the class and property slot.
-      cacheEntry->clazz = clazzPtr;
-      cacheEntry->slot = desc.slot;
+      cacheEntry->set(clazzPtr, desc.slot);
     }
 
     // This must be valid because an own property was already found.
@@ -1731,7 +1772,8 @@ CallResult<PseudoHandle<>> Interpreter::createObjectFromBuffer(
     Runtime &runtime,
     CodeBlock *curCodeBlock,
     unsigned shapeTableIndex,
-    unsigned valBufferOffset) {
+    unsigned valBufferOffset,
+    LongLived longLived) {
   RuntimeModule *runtimeModule = curCodeBlock->getRuntimeModule();
 
   HiddenClass *clazz;
@@ -1786,7 +1828,7 @@ CallResult<PseudoHandle<>> Interpreter::createObjectFromBuffer(
   // Create a new object using the built-in constructor or cached hidden class.
   // Note that the built-in constructor is empty, so we don't actually need to
   // call it.
-  lv.obj = JSObject::create(runtime, lv.clazz).get();
+  lv.obj = JSObject::create(runtime, lv.clazz, longLived).get();
   auto numLiterals = lv.clazz->getNumProperties();
 
   // Set up the visitor to populate property values in the object.
@@ -1836,10 +1878,11 @@ CallResult<PseudoHandle<>> Interpreter::createArrayFromBuffer(
     CodeBlock *curCodeBlock,
     unsigned numElements,
     unsigned numLiterals,
-    unsigned bufferIndex) {
+    unsigned bufferIndex,
+    LongLived longLived) {
   // Create a new array using the built-in constructor, and initialize
   // the elements from a literal array buffer.
-  auto arrRes = JSArray::create(runtime, numElements, numElements);
+  auto arrRes = JSArray::create(runtime, numElements, numElements, longLived);
   if (arrRes == ExecutionStatus::EXCEPTION) {
     return ExecutionStatus::EXCEPTION;
   }
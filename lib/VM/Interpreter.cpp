@@ -13,6 +13,7 @@
 #include "hermes/Support/Conversions.h"
 #include "hermes/Support/SlowAssert.h"
 #include "hermes/Support/Statistic.h"
+#include "hermes/VM/AllocationSiteTracker-inline.h"
 #include "hermes/VM/BigIntPrimitive.h"
 #include "hermes/VM/Callable.h"
 #include "hermes/VM/CodeBlock.h"
@@ -425,6 +426,31 @@ CallResult<HermesValue> Runtime::interpretFunction(CodeBlock *newCodeBlock) {
   return interpretFunctionImpl(newCodeBlock);
 }
 
+#if HERMESVM_JIT
+CallResult<HermesValue> Runtime::interpretDeoptimizedFrame(
+    CodeBlock *codeBlock,
+    const inst::Inst *ip) {
+  // Return to the JIT'ed code when the frame returns, instead of continuing in
+  // the caller.
+  getCurrentFrame().getSavedCodeBlockRef() =
+      HermesValue::encodeNativePointer(nullptr);
+
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+  // Match the pop performed when the frame returns.
+  pushCallStack(codeBlock, ip);
+#endif
+
+  InterpreterState state{codeBlock, codeBlock->getOffsetOf(ip)};
+  state.resumeFrame = true;
+  if (HERMESVM_CRASH_TRACE &&
+      (getVMExperimentFlags() & experiments::CrashTrace)) {
+    return Interpreter::interpretFunction<false, true>(*this, state);
+  } else {
+    return Interpreter::interpretFunction<false, false>(*this, state);
+  }
+}
+#endif
+
 #ifdef HERMES_ENABLE_DEBUGGER
 ExecutionStatus Runtime::stepFunction(InterpreterState &state) {
   if (HERMESVM_CRASH_TRACE &&
@@ -533,7 +559,11 @@ CallResult<HermesValue> Interpreter::interpretFunction(
     return runtime.raiseStackOverflow(Runtime::StackOverflowKind::NativeStack);
   }
 
-  if (!SingleStep) {
+  if (!SingleStep && LLVM_UNLIKELY(state.resumeFrame)) {
+    // The frame has been set up by JIT'ed code.
+    frameRegs = &runtime.getCurrentFrame().getFirstLocalRef();
+    ip = (Inst const *)(curCodeBlock->begin() + state.offset);
+  } else if (!SingleStep) {
     if (auto jitPtr = runtime.jitContext_.compile(runtime, curCodeBlock)) {
       return JSFunction::_jittedCall(jitPtr, runtime);
     }
@@ -592,6 +622,9 @@ CallResult<HermesValue> Interpreter::interpretFunction(
   CallResult<PseudoHandle<>> resPH{ExecutionStatus::EXCEPTION};
   CallResult<Handle<Arguments>> resArgs{ExecutionStatus::EXCEPTION};
   CallResult<bool> boolRes{ExecutionStatus::EXCEPTION};
+  // Decides which object and array allocations go directly in the old
+  // generation.
+  AllocationSiteTracker &allocSites = runtime.getHeap().getAllocationSites();
   // Start of the bytecode file, used to calculate IP offset in crash traces.
   const uint8_t *bytecodeFileStart;
 
@@ -682,29 +715,54 @@ tailCall:
 // For indirect threading, there is no way to specify a default, leave it as
 // an empty label.
 #define DEFAULT_CASE
-#define DISPATCH                                \
-  BEFORE_OP_CODE;                               \
-  if (SingleStep) {                             \
-    state.codeBlock = curCodeBlock;             \
-    state.offset = CUROFFSET;                   \
-    return HermesValue::encodeUndefinedValue(); \
-  }                                             \
-  goto *opcodeDispatch[(unsigned)ip->opCode]
+#define DISPATCH                                  \
+  {                                               \
+    BEFORE_OP_CODE;                               \
+    if (SingleStep) {                             \
+      state.codeBlock = curCodeBlock;             \
+      state.offset = CUROFFSET;                   \
+      return HermesValue::encodeUndefinedValue(); \
+    }                                             \
+    goto *opcodeDispatch[(unsigned)ip->opCode];   \
+  }
 
 #else // HERMESVM_INDIRECT_THREADING
 
 #define CASE(name) case OpCode::name:
 #define DEFAULT_CASE default:
-#define DISPATCH                                \
-  if (SingleStep) {                             \
-    state.codeBlock = curCodeBlock;             \
-    state.offset = CUROFFSET;                   \
-    return HermesValue::encodeUndefinedValue(); \
-  }                                             \
-  continue
+#define DISPATCH                                  \
+  {                                               \
+    if (SingleStep) {                             \
+      state.codeBlock = curCodeBlock;             \
+      state.offset = CUROFFSET;                   \
+      return HermesValue::encodeUndefinedValue(); \
+    }                                             \
+    continue;                                     \
+  }
 
 #endif // HERMESVM_INDIRECT_THREADING
 
+#if HERMESVM_JIT
+/// Transfer control to the instruction \p dest. Backward branches go through
+/// backEdge, which may continue the execution of a hot loop in native code.
+#define BRANCH(dest)                             \
+  {                                              \
+    const Inst *branchDest = (dest);             \
+    bool isBackEdge = branchDest <= ip;          \
+    ip = branchDest;                             \
+    if (!SingleStep && LLVM_UNLIKELY(isBackEdge)) \
+      goto backEdge;                             \
+    DISPATCH;                                    \
+  }
+#else
+/// Transfer control to the instruction \p dest.
+#define BRANCH(dest) \
+  {                  \
+    ip = (dest);     \
+    DISPATCH;        \
+  }
+#endif
+
 // This macro is used when we detect that either the Implicit or Explicit
 // AsyncBreak flags have been set. It checks to see which one was requested and
 // propagate the corresponding RunReason. If both Implicit and Explicit have
@@ -778,6 +836,20 @@ tailCall:
     DISPATCH;                                                        \
   }
 
+#if HERMESVM_JIT
+/// Record in the type feedback of the current CodeBlock that the arithmetic
+/// instruction at ip was executed with operands that are not both numbers, so
+/// the JIT doesn't speculate that they are. Nothing is recorded unless the JIT
+/// speculates.
+#define RECORD_NON_NUMBER_OPERANDS()                           \
+  do {                                                         \
+    if (LLVM_UNLIKELY(runtime.getJITContext().getSpeculate())) \
+      curCodeBlock->recordNonNumberOperands(CUROFFSET);        \
+  } while (0)
+#else
+#define RECORD_NON_NUMBER_OPERANDS()
+#endif
+
 /// Implement a binary arithmetic instruction with a fast path where both
 /// operands are numbers.
 /// \param name the name of the instruction. The fast path case will have a
@@ -792,6 +864,7 @@ tailCall:
       ip = NEXTINST(name);                                                 \
       DISPATCH;                                                            \
     }                                                                      \
+    RECORD_NON_NUMBER_OPERANDS();                                          \
     CAPTURE_IP_ASSIGN(                                                     \
         ExecutionStatus status,                                            \
         doOperSlowPath_RJS<do##name>(runtime, frameRegs, &ip->i##name));   \
@@ -816,6 +889,7 @@ tailCall:
       ip = NEXTINST(name);                                                     \
       DISPATCH;                                                                \
     }                                                                          \
+    RECORD_NON_NUMBER_OPERANDS();                                              \
     CAPTURE_IP_ASSIGN(                                                         \
         ExecutionStatus status,                                                \
         doIncDecOperSlowPath_RJS<do##name>(runtime, frameRegs, &ip->i##name)); \
@@ -923,12 +997,11 @@ tailCall:
       if (O2REG(name##suffix)                                             \
               .getNumber() oper O3REG(name##suffix)                       \
               .getNumber()) {                                             \
-        ip = trueDest;                                                    \
-        DISPATCH;                                                         \
+        BRANCH(trueDest);                                                 \
       }                                                                   \
-      ip = falseDest;                                                     \
-      DISPATCH;                                                           \
+      BRANCH(falseDest);                                                  \
     }                                                                     \
+    RECORD_NON_NUMBER_OPERANDS();                                         \
     CAPTURE_IP(                                                           \
         boolRes = operFuncName(                                           \
             runtime,                                                      \
@@ -938,11 +1011,9 @@ tailCall:
       goto exception;                                                     \
     gcScope.flushToSmallCount(KEEP_HANDLES);                              \
     if (boolRes.getValue()) {                                             \
-      ip = trueDest;                                                      \
-      DISPATCH;                                                           \
+      BRANCH(trueDest);                                                   \
     }                                                                     \
-    ip = falseDest;                                                       \
-    DISPATCH;                                                             \
+    BRANCH(falseDest);                                                    \
   }
 
 /// Like JCOND_IMPL, but for cases where the operands are known to be numbers.
@@ -951,11 +1022,9 @@ tailCall:
     if (O2REG(name##suffix)                                                 \
             .getNumber() oper O3REG(name##suffix)                           \
             .getNumber()) {                                                 \
-      ip = trueDest;                                                        \
-      DISPATCH;                                                             \
+      BRANCH(trueDest);                                                     \
     }                                                                       \
-    ip = falseDest;                                                         \
-    DISPATCH;                                                               \
+    BRANCH(falseDest);                                                      \
   }
 
 /// Implement a strict equality conditional jump
@@ -966,11 +1035,9 @@ tailCall:
 #define JCOND_STRICT_EQ_IMPL(name, suffix, trueDest, falseDest)         \
   CASE(name##suffix) {                                                  \
     if (strictEqualityTest(O2REG(name##suffix), O3REG(name##suffix))) { \
-      ip = trueDest;                                                    \
-      DISPATCH;                                                         \
+      BRANCH(trueDest);                                                 \
     }                                                                   \
-    ip = falseDest;                                                     \
-    DISPATCH;                                                           \
+    BRANCH(falseDest);                                                  \
   }
 
 /// Implement an equality conditional jump
@@ -991,11 +1058,9 @@ tailCall:
     }                                                    \
     gcScope.flushToSmallCount(KEEP_HANDLES);             \
     if (*eqRes) {                                        \
-      ip = trueDest;                                     \
-      DISPATCH;                                          \
+      BRANCH(trueDest);                                  \
     }                                                    \
-    ip = falseDest;                                      \
-    DISPATCH;                                            \
+    BRANCH(falseDest);                                   \
   }
 
 /// Implement the long and short forms of a conditional jump, and its negation.
@@ -1835,11 +1900,11 @@ tailCall:
 #define INC_NUMGETBYIDDICT (void)NumGetByIdDict;
 #endif
 
-#define GET_BY_ID_IMPL(name)                                                  \
+#define GET_BY_ID_IMPL(name, objReg, cacheIndex)                              \
   ++NumGetById;                                                               \
-  if (LLVM_LIKELY(O2REG(name).isObject())) {                                  \
-    auto *obj = vmcast<JSObject>(O2REG(name));                                \
-    auto cacheIdx = ip->i##name.op3;                                          \
+  if (LLVM_LIKELY((objReg).isObject())) {                                     \
+    auto *obj = vmcast<JSObject>(objReg);                                     \
+    auto cacheIdx = (cacheIndex);                                             \
     auto *cacheEntry = curCodeBlock->getReadCacheEntry(cacheIdx);             \
     CompressedPointer clazzPtr{obj->getClassGCPtr()};                         \
     INC_NUMGETBYIDDICT;                                                       \
@@ -1877,7 +1942,14 @@ tailCall:
   CAPTURE_IP_ASSIGN(                                                          \
       ExecutionStatus res,                                                    \
       doGetByIdSlowPath_RJS(                                                  \
-          runtime, frameRegs, ip, curCodeBlock, idVal, tryProp));             \
+          runtime,                                                            \
+          frameRegs,                                                          \
+          ip,                                                                 \
+          &(objReg),                                                          \
+          (cacheIndex),                                                       \
+          curCodeBlock,                                                       \
+          idVal,                                                              \
+          tryProp));                                                          \
   if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION))                       \
     goto exception;                                                           \
   gcScope.flushToSmallCount(KEEP_HANDLES);                                    \
@@ -1887,27 +1959,61 @@ tailCall:
       CASE(TryGetByIdLong) {
         tryProp = true;
         idVal = ip->iTryGetByIdLong.op4;
-        GET_BY_ID_IMPL(TryGetByIdLong);
+        GET_BY_ID_IMPL(
+            TryGetByIdLong, O2REG(TryGetByIdLong), ip->iTryGetByIdLong.op3);
       }
       CASE(GetByIdLong) {
         tryProp = false;
         idVal = ip->iGetByIdLong.op4;
-        GET_BY_ID_IMPL(GetByIdLong);
+        GET_BY_ID_IMPL(GetByIdLong, O2REG(GetByIdLong), ip->iGetByIdLong.op3);
       }
       CASE(GetByIdShort) {
         tryProp = false;
         idVal = ip->iGetByIdShort.op4;
-        GET_BY_ID_IMPL(GetByIdShort);
+        GET_BY_ID_IMPL(
+            GetByIdShort, O2REG(GetByIdShort), ip->iGetByIdShort.op3);
       }
       CASE(TryGetById) {
         tryProp = true;
         idVal = ip->iTryGetById.op4;
-        GET_BY_ID_IMPL(TryGetById);
+        GET_BY_ID_IMPL(TryGetById, O2REG(TryGetById), ip->iTryGetById.op3);
       }
       CASE(GetById) {
         tryProp = false;
         idVal = ip->iGetById.op4;
-        GET_BY_ID_IMPL(GetById);
+        GET_BY_ID_IMPL(GetById, O2REG(GetById), ip->iGetById.op3);
+      }
+      CASE(GetByIdParam) {
+        // Load the parameter into the result register, then read the property
+        // from there.
+        if (LLVM_LIKELY(ip->iGetByIdParam.op2 <= FRAME.getArgCount())) {
+          O1REG(GetByIdParam) =
+              FRAME.getArgRef((int32_t)ip->iGetByIdParam.op2 - 1);
+        } else {
+          O1REG(GetByIdParam) = HermesValue::encodeUndefinedValue();
+        }
+        tryProp = false;
+        idVal = ip->iGetByIdParam.op4;
+        GET_BY_ID_IMPL(
+            GetByIdParam, O1REG(GetByIdParam), ip->iGetByIdParam.op3);
+      }
+      CASE(GetByIdGlobal) {
+        // Load the global object into the result register, then read the
+        // property from there.
+        O1REG(GetByIdGlobal) = runtime.global_.getHermesValue();
+        tryProp = false;
+        idVal = ip->iGetByIdGlobal.op3;
+        GET_BY_ID_IMPL(
+            GetByIdGlobal, O1REG(GetByIdGlobal), ip->iGetByIdGlobal.op2);
+      }
+      CASE(TryGetByIdGlobal) {
+        O1REG(TryGetByIdGlobal) = runtime.global_.getHermesValue();
+        tryProp = true;
+        idVal = ip->iTryGetByIdGlobal.op3;
+        GET_BY_ID_IMPL(
+            TryGetByIdGlobal,
+            O1REG(TryGetByIdGlobal),
+            ip->iTryGetByIdGlobal.op2);
       }
 
 #undef INC_NUMGETBYIDDICT
@@ -2032,7 +2138,23 @@ tailCall:
       DISPATCH;
     }
 
-      CASE_OUTOFLINE(GetByVal);
+      CASE(GetByVal) {
+        if (LLVM_LIKELY(O2REG(GetByVal).isObject())) {
+          HermesValue value = getByValElementFast(
+              runtime, vmcast<JSObject>(O2REG(GetByVal)), O3REG(GetByVal));
+          if (LLVM_LIKELY(!value.isEmpty())) {
+            O1REG(GetByVal) = value;
+            ip = NEXTINST(GetByVal);
+            DISPATCH;
+          }
+        }
+        CAPTURE_IP_ASSIGN(auto res, caseGetByVal(runtime, frameRegs, ip));
+        if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION))
+          goto exception;
+        gcScope.flushToSmallCount(KEEP_HANDLES);
+        ip = NEXTINST(GetByVal);
+        DISPATCH;
+      }
       CASE_OUTOFLINE(GetByValWithReceiver);
 
       CASE(DefineOwnById) {
@@ -2129,6 +2251,15 @@ tailCall:
 
       CASE(PutByValLoose)
       CASE(PutByValStrict) {
+        if (LLVM_LIKELY(O1REG(PutByValLoose).isObject()) &&
+            putByValElementFast(
+                runtime,
+                O1REG(PutByValLoose),
+                O2REG(PutByValLoose),
+                O3REG(PutByValLoose))) {
+          ip = NEXTINST(PutByValLoose);
+          DISPATCH;
+        }
         CAPTURE_IP_ASSIGN(
             ExecutionStatus status, casePutByVal(runtime, frameRegs, ip));
         if (LLVM_UNLIKELY(status == ExecutionStatus::EXCEPTION))
@@ -2254,53 +2385,45 @@ tailCall:
       }
 
       CASE(Jmp) {
-        ip = IPADD(ip->iJmp.op1);
-        DISPATCH;
+        BRANCH(IPADD(ip->iJmp.op1));
       }
       CASE(JmpLong) {
-        ip = IPADD(ip->iJmpLong.op1);
-        DISPATCH;
+        BRANCH(IPADD(ip->iJmpLong.op1));
       }
       CASE(JmpTrue) {
         if (toBoolean(O2REG(JmpTrue)))
-          ip = IPADD(ip->iJmpTrue.op1);
-        else
-          ip = NEXTINST(JmpTrue);
+          BRANCH(IPADD(ip->iJmpTrue.op1));
+        ip = NEXTINST(JmpTrue);
         DISPATCH;
       }
       CASE(JmpTrueLong) {
         if (toBoolean(O2REG(JmpTrueLong)))
-          ip = IPADD(ip->iJmpTrueLong.op1);
-        else
-          ip = NEXTINST(JmpTrueLong);
+          BRANCH(IPADD(ip->iJmpTrueLong.op1));
+        ip = NEXTINST(JmpTrueLong);
         DISPATCH;
       }
       CASE(JmpFalse) {
         if (!toBoolean(O2REG(JmpFalse)))
-          ip = IPADD(ip->iJmpFalse.op1);
-        else
-          ip = NEXTINST(JmpFalse);
+          BRANCH(IPADD(ip->iJmpFalse.op1));
+        ip = NEXTINST(JmpFalse);
         DISPATCH;
       }
       CASE(JmpFalseLong) {
         if (!toBoolean(O2REG(JmpFalseLong)))
-          ip = IPADD(ip->iJmpFalseLong.op1);
-        else
-          ip = NEXTINST(JmpFalseLong);
+          BRANCH(IPADD(ip->iJmpFalseLong.op1));
+        ip = NEXTINST(JmpFalseLong);
         DISPATCH;
       }
       CASE(JmpUndefined) {
         if (O2REG(JmpUndefined).isUndefined())
-          ip = IPADD(ip->iJmpUndefined.op1);
-        else
-          ip = NEXTINST(JmpUndefined);
+          BRANCH(IPADD(ip->iJmpUndefined.op1));
+        ip = NEXTINST(JmpUndefined);
         DISPATCH;
       }
       CASE(JmpUndefinedLong) {
         if (O2REG(JmpUndefinedLong).isUndefined())
-          ip = IPADD(ip->iJmpUndefinedLong.op1);
-        else
-          ip = NEXTINST(JmpUndefinedLong);
+          BRANCH(IPADD(ip->iJmpUndefinedLong.op1));
+        ip = NEXTINST(JmpUndefinedLong);
         DISPATCH;
       }
       CASE(JmpBuiltinIs) {
@@ -2308,10 +2431,9 @@ tailCall:
             HermesValue::encodeObjectValue(
                 runtime.getBuiltinCallable(ip->iJmpBuiltinIs.op2))
                 .getRaw()) {
-          ip = IPADD(ip->iJmpBuiltinIs.op1);
-        } else {
-          ip = NEXTINST(JmpBuiltinIs);
+          BRANCH(IPADD(ip->iJmpBuiltinIs.op1));
         }
+        ip = NEXTINST(JmpBuiltinIs);
         DISPATCH;
       }
       CASE(JmpBuiltinIsLong) {
@@ -2319,10 +2441,9 @@ tailCall:
             HermesValue::encodeObjectValue(
                 runtime.getBuiltinCallable(ip->iJmpBuiltinIsLong.op2))
                 .getRaw()) {
-          ip = IPADD(ip->iJmpBuiltinIsLong.op1);
-        } else {
-          ip = NEXTINST(JmpBuiltinIsLong);
+          BRANCH(IPADD(ip->iJmpBuiltinIsLong.op1));
         }
+        ip = NEXTINST(JmpBuiltinIsLong);
         DISPATCH;
       }
       CASE(JmpBuiltinIsNot) {
@@ -2330,10 +2451,9 @@ tailCall:
             HermesValue::encodeObjectValue(
                 runtime.getBuiltinCallable(ip->iJmpBuiltinIsNot.op2))
                 .getRaw()) {
-          ip = IPADD(ip->iJmpBuiltinIsNot.op1);
-        } else {
-          ip = NEXTINST(JmpBuiltinIsNot);
+          BRANCH(IPADD(ip->iJmpBuiltinIsNot.op1));
         }
+        ip = NEXTINST(JmpBuiltinIsNot);
         DISPATCH;
       }
       CASE(JmpBuiltinIsNotLong) {
@@ -2341,10 +2461,9 @@ tailCall:
             HermesValue::encodeObjectValue(
                 runtime.getBuiltinCallable(ip->iJmpBuiltinIsNotLong.op2))
                 .getRaw()) {
-          ip = IPADD(ip->iJmpBuiltinIsNotLong.op1);
-        } else {
-          ip = NEXTINST(JmpBuiltinIsNotLong);
+          BRANCH(IPADD(ip->iJmpBuiltinIsNotLong.op1));
         }
+        ip = NEXTINST(JmpBuiltinIsNotLong);
         DISPATCH;
       }
       INCDECOP(Inc)
@@ -2363,6 +2482,7 @@ tailCall:
           ip = NEXTINST(Add);
           DISPATCH;
         }
+        RECORD_NON_NUMBER_OPERANDS();
         CAPTURE_IP(
             res = addOp_RJS(
                 runtime, Handle<>(&O2REG(Add)), Handle<>(&O3REG(Add))));
@@ -2498,7 +2618,12 @@ tailCall:
         // built-in constructor is empty, so we don't actually need to call
         // it.
         CAPTURE_IP(
-            O1REG(NewObject) = JSObject::create(runtime).getHermesValue());
+            O1REG(NewObject) =
+                JSObject::create(
+                    runtime, allocSites.beginAllocation(curCodeBlock, ip))
+                    .getHermesValue());
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewObject).getObject()));
         assert(
             gcScope.getHandleCountDbg() == KEEP_HANDLES &&
             "Should not create handles.");
@@ -2514,8 +2639,11 @@ tailCall:
                         ? Handle<JSObject>::vmcast(&O2REG(NewObjectWithParent))
                         : O2REG(NewObjectWithParent).isNull()
                         ? Runtime::makeNullHandle<JSObject>()
-                        : Handle<JSObject>::vmcast(&runtime.objectPrototype))
+                        : Handle<JSObject>::vmcast(&runtime.objectPrototype),
+                    allocSites.beginAllocation(curCodeBlock, ip))
                     .getHermesValue());
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewObjectWithParent).getObject()));
         assert(
             gcScope.getHandleCountDbg() == KEEP_HANDLES &&
             "Should not create handles.");
@@ -2529,11 +2657,15 @@ tailCall:
                 runtime,
                 curCodeBlock,
                 ip->iNewObjectWithBuffer.op2,
-                ip->iNewObjectWithBuffer.op3));
+                ip->iNewObjectWithBuffer.op3,
+                allocSites.beginAllocation(curCodeBlock, ip)));
         if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
+          allocSites.abandonAllocation();
           goto exception;
         }
         O1REG(NewObjectWithBuffer) = resPH->get();
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewObjectWithBuffer).getObject()));
         ip = NEXTINST(NewObjectWithBuffer);
         DISPATCH;
       }
@@ -2544,11 +2676,15 @@ tailCall:
                 runtime,
                 curCodeBlock,
                 ip->iNewObjectWithBufferLong.op2,
-                ip->iNewObjectWithBufferLong.op3));
+                ip->iNewObjectWithBufferLong.op3,
+                allocSites.beginAllocation(curCodeBlock, ip)));
         if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
+          allocSites.abandonAllocation();
           goto exception;
         }
         O1REG(NewObjectWithBufferLong) = resPH->get();
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewObjectWithBufferLong).getObject()));
         ip = NEXTINST(NewObjectWithBufferLong);
         DISPATCH;
       }
@@ -2560,11 +2696,18 @@ tailCall:
         {
           CAPTURE_IP_ASSIGN(
               auto createRes,
-              JSArray::create(runtime, ip->iNewArray.op2, ip->iNewArray.op2));
+              JSArray::create(
+                  runtime,
+                  ip->iNewArray.op2,
+                  ip->iNewArray.op2,
+                  allocSites.beginAllocation(curCodeBlock, ip)));
           if (createRes == ExecutionStatus::EXCEPTION) {
+            allocSites.abandonAllocation();
             goto exception;
           }
           O1REG(NewArray) = createRes->getHermesValue();
+          allocSites.recordAllocation(
+              static_cast<GCCell *>(O1REG(NewArray).getObject()));
         }
         ip = NEXTINST(NewArray);
         DISPATCH;
@@ -2613,7 +2756,7 @@ tailCall:
           goto exception;
         }
 
-        storage->set(intIndex, shv, runtime.getHeap());
+        storage->setWithBarrierIfNeeded(intIndex, shv, runtime.getHeap());
         ip = NEXTINST(FastArrayStore);
         DISPATCH;
       }
@@ -2649,11 +2792,15 @@ tailCall:
                 curCodeBlock,
                 ip->iNewArrayWithBuffer.op2,
                 ip->iNewArrayWithBuffer.op3,
-                ip->iNewArrayWithBuffer.op4));
+                ip->iNewArrayWithBuffer.op4,
+                allocSites.beginAllocation(curCodeBlock, ip)));
         if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
+          allocSites.abandonAllocation();
           goto exception;
         }
         O1REG(NewArrayWithBuffer) = resPH->get();
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewArrayWithBuffer).getObject()));
         gcScope.flushToSmallCount(KEEP_HANDLES);
         tmpHandle.clear();
         ip = NEXTINST(NewArrayWithBuffer);
@@ -2667,11 +2814,15 @@ tailCall:
                 curCodeBlock,
                 ip->iNewArrayWithBufferLong.op2,
                 ip->iNewArrayWithBufferLong.op3,
-                ip->iNewArrayWithBufferLong.op4));
+                ip->iNewArrayWithBufferLong.op4,
+                allocSites.beginAllocation(curCodeBlock, ip)));
         if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
+          allocSites.abandonAllocation();
           goto exception;
         }
         O1REG(NewArrayWithBufferLong) = resPH->get();
+        allocSites.recordAllocation(
+            static_cast<GCCell *>(O1REG(NewArrayWithBufferLong).getObject()));
         gcScope.flushToSmallCount(KEEP_HANDLES);
         tmpHandle.clear();
         ip = NEXTINST(NewArrayWithBufferLong);
@@ -2874,6 +3025,32 @@ tailCall:
         ip = NEXTINST(PutOwnBySlotIdx);
         DISPATCH;
       }
+      CASE(PutOwnNPBySlotIdxLong) {
+        assert(
+            O1REG(PutOwnNPBySlotIdxLong).isObject() &&
+            "Object argument of PutOwnNPBySlotIdx must be an object");
+        ENCODE_HV_AS_SHV(shv, O2REG(PutOwnNPBySlotIdxLong));
+        JSObject::setNamedSlotValueNonPtrUnsafe(
+            vmcast<JSObject>(O1REG(PutOwnNPBySlotIdxLong)),
+            runtime,
+            ip->iPutOwnNPBySlotIdxLong.op3,
+            shv);
+        ip = NEXTINST(PutOwnNPBySlotIdxLong);
+        DISPATCH;
+      }
+      CASE(PutOwnNPBySlotIdx) {
+        assert(
+            O1REG(PutOwnNPBySlotIdx).isObject() &&
+            "Object argument of PutOwnNPBySlotIdx must be an object");
+        ENCODE_HV_AS_SHV(shv, O2REG(PutOwnNPBySlotIdx));
+        JSObject::setNamedSlotValueNonPtrUnsafe(
+            vmcast<JSObject>(O1REG(PutOwnNPBySlotIdx)),
+            runtime,
+            ip->iPutOwnNPBySlotIdx.op3,
+            shv);
+        ip = NEXTINST(PutOwnNPBySlotIdx);
+        DISPATCH;
+      }
 
       CASE(GetOwnBySlotIdxLong) {
         O1REG(GetOwnBySlotIdxLong) =
@@ -2922,13 +3099,11 @@ tailCall:
             const int32_t *loc =
                 (const int32_t *)tablestart + uintVal - ip->iSwitchImm.op4;
 
-            ip = IPADD(*loc);
-            DISPATCH;
+            BRANCH(IPADD(*loc));
           }
         }
         // Wrong type or out of range, jump to default.
-        ip = IPADD(ip->iSwitchImm.op3);
-        DISPATCH;
+        BRANCH(IPADD(ip->iSwitchImm.op3));
       }
       LOAD_CONST(
           LoadConstUInt8,
@@ -3039,10 +3214,9 @@ tailCall:
       CASE(JmpTypeOfIs) {
         TypeOfIsTypes types(ip->iJmpTypeOfIs.op3);
         if (matchTypeOfIs(O2REG(JmpTypeOfIs), types)) {
-          ip = IPADD(ip->iJmpTypeOfIs.op1);
-        } else {
-          ip = NEXTINST(JmpTypeOfIs);
+          BRANCH(IPADD(ip->iJmpTypeOfIs.op1));
         }
+        ip = NEXTINST(JmpTypeOfIs);
         DISPATCH;
       }
 
@@ -3102,6 +3276,59 @@ tailCall:
         "All opcodes should dispatch to the next and not fallthrough "
         "to here");
 
+#if HERMESVM_JIT
+  backEdge: {
+    // A backward branch to the loop header at ip has been taken. Once the
+    // loop is hot enough, the rest of the current frame runs in native code.
+    auto osrPtr = runtime.jitContext_.compileOSR(runtime, curCodeBlock);
+    if (LLVM_LIKELY(!osrPtr)) {
+      DISPATCH;
+    }
+
+    // The native code pops the frame when it returns, so remember where to
+    // continue in the caller.
+    const Inst *callerIP = FRAME.getSavedIP();
+    CodeBlock *callerCodeBlock = FRAME.getSavedCodeBlock();
+
+    // The OSR entry selects the loop header based on the current IP.
+    runtime.jitContext_.recordOSREntry();
+    runtime.setCurrentIP(ip);
+    res = JSFunction::_jittedOSREntry(osrPtr, runtime);
+
+    PROFILER_EXIT_FUNCTION(curCodeBlock);
+
+#ifdef HERMES_MEMORY_INSTRUMENTATION
+    runtime.popCallStack();
+#endif
+
+    ip = callerIP;
+    curCodeBlock = callerCodeBlock;
+    frameRegs = &runtime.getCurrentFrame().getFirstLocalRef();
+
+    // Are we returning to native code?
+    if (!curCodeBlock)
+      return res;
+
+    INIT_STATE_FOR_CODEBLOCK(curCodeBlock);
+    if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION))
+      goto exception;
+    O1REG(Call) = res.getValue();
+
+#ifdef HERMES_ENABLE_DEBUGGER
+    if (LLVM_UNLIKELY(curCodeBlock->getNumInstalledBreakpoints() > 0)) {
+      ip = IPADD(inst::getInstSize(
+          runtime.debugger_.getRealOpCode(curCodeBlock, CUROFFSET)));
+    } else {
+      ip = nextInstCall(ip);
+    }
+#else
+    ip = nextInstCall(ip);
+#endif
+
+    DISPATCH;
+  }
+#endif
+
   exception:
     UPDATE_OPCODE_TIME_SPENT;
     assert(
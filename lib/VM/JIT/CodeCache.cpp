@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JIT/Config.h"
+#if HERMESVM_JIT
+#include "hermes/VM/JIT/CodeCache.h"
+
+#include "RuntimeOffsets.h"
+
+#include "hermes/VM/RuntimeModule.h"
+
+#include "llvh/ADT/StringExtras.h"
+#include "llvh/Support/Debug.h"
+#include "llvh/Support/FileSystem.h"
+#include "llvh/Support/MemoryBuffer.h"
+#include "llvh/Support/raw_ostream.h"
+
+#include <cstring>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#include <sys/stat.h>
+#define HERMES_JIT_CODE_CACHE_DLADDR 1
+#endif
+
+#define DEBUG_TYPE "jit"
+
+namespace hermes {
+namespace vm {
+
+namespace {
+
+/// Incremented whenever the generated code or the file format changes in a
+/// way that isn't reflected by the other components of the version.
+constexpr uint64_t kFormatVersion = 1;
+
+/// "HJCC" in little endian.
+constexpr uint32_t kMagic = 0x43434a48;
+
+/// Header of a cache file. It is followed by the code and the relocations.
+struct FileHeader {
+  uint32_t magic;
+  uint32_t codeSize;
+  uint64_t version;
+  uint64_t bytecodeHash;
+  uint32_t numRelocs;
+  uint32_t osrEntryOffset;
+};
+
+/// A relocation as stored in a cache file.
+struct FileReloc {
+  uint32_t offset;
+  uint8_t size;
+  uint8_t kind;
+  uint16_t reserved;
+  uint64_t payload;
+};
+
+constexpr uint64_t kHashSeed = 0xcbf29ce484222325;
+
+/// FNV-1a, which is stable across processes, unlike llvh::hash_value.
+uint64_t hashBytes(uint64_t hash, const void *data, size_t size) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < size; ++i)
+    hash = (hash ^ bytes[i]) * 0x100000001b3;
+  return hash;
+}
+
+uint64_t hashValue(uint64_t hash, uint64_t value) {
+  return hashBytes(hash, &value, sizeof(value));
+}
+
+/// \return a hash of everything in the bytecode that the native code of
+/// \p codeBlock was compiled from.
+uint64_t bytecodeHash(CodeBlock *codeBlock) {
+  uint64_t hash = hashBytes(
+      kHashSeed, codeBlock->begin(), codeBlock->end() - codeBlock->begin());
+
+  auto header = codeBlock->getFunctionHeader();
+  for (uint64_t value :
+       {header.getParamCount(),
+        header.getFrameSize(),
+        header.getNumberRegCount(),
+        header.getNonPtrRegCount(),
+        (uint32_t)header.getHighestReadCacheIndex(),
+        (uint32_t)header.getHighestWriteCacheIndex()}) {
+    hash = hashValue(hash, value);
+  }
+  auto flags = codeBlock->getHeaderFlags();
+  hash = hashValue(hash, flags.getProhibitInvoke());
+  hash = hashValue(hash, flags.getStrictMode());
+  hash = hashValue(hash, (uint64_t)flags.getKind());
+
+  for (const auto &entry :
+       codeBlock->getRuntimeModule()->getBytecode()->getExceptionTable(
+           codeBlock->getFunctionID())) {
+    hash = hashValue(hash, entry.start);
+    hash = hashValue(hash, entry.end);
+    hash = hashValue(hash, entry.target);
+  }
+  return hash;
+}
+
+/// \return a hash of everything outside the bytecode that the stored code
+/// depends on.
+uint64_t computeVersion() {
+  uint64_t hash = hashValue(kHashSeed, kFormatVersion);
+  hash = hashValue(hash, RuntimeOffsets::layoutHash());
+  hash = hashValue(hash, HERMESVALUE_VERSION);
+  hash = hashValue(hash, sizeof(ReadPropertyCacheEntry));
+  hash = hashValue(hash, sizeof(WritePropertyCacheEntry));
+#ifdef HERMES_JIT_CODE_CACHE_DLADDR
+  // Identify the VM binary, since the stored code calls into it at fixed
+  // distances from the anchor.
+  uintptr_t anchor = JITCodeCache::functionAnchor();
+  Dl_info info;
+  if (dladdr((const void *)anchor, &info)) {
+    hash = hashValue(hash, anchor - (uintptr_t)info.dli_fbase);
+    struct stat st;
+    if (info.dli_fname && stat(info.dli_fname, &st) == 0) {
+      hash = hashValue(hash, st.st_size);
+      hash = hashValue(hash, st.st_mtime);
+    }
+  }
+#endif
+  return hash;
+}
+
+/// \return the value of relocation \p reloc in \p codeBlock, or llvh::None if
+/// the payload is invalid.
+llvh::Optional<uint64_t> relocValue(
+    CodeBlock *codeBlock,
+    const JITReloc &reloc) {
+  RuntimeModule *runtimeModule = codeBlock->getRuntimeModule();
+  switch (reloc.kind) {
+    case JITRelocKind::FunctionPtr:
+      return (uint64_t)JITCodeCache::functionAnchor() + reloc.payload;
+    case JITRelocKind::CodeBlock:
+      return (uint64_t)codeBlock;
+    case JITRelocKind::RuntimeModule:
+      if (reloc.payload >= sizeof(RuntimeModule))
+        return llvh::None;
+      return (uint64_t)runtimeModule + reloc.payload;
+    case JITRelocKind::ReadPropertyCache:
+      return (uint64_t)codeBlock->readPropertyCache();
+    case JITRelocKind::WritePropertyCache:
+      return (uint64_t)codeBlock->writePropertyCache();
+    case JITRelocKind::BytecodeIP:
+      if (reloc.payload >= (uint64_t)(codeBlock->end() - codeBlock->begin()))
+        return llvh::None;
+      return (uint64_t)(codeBlock->begin() + reloc.payload);
+    case JITRelocKind::SymbolID:
+      if (reloc.payload >= runtimeModule->getBytecode()->getStringCount())
+        return llvh::None;
+      return runtimeModule
+          ->getSymbolIDFromStringIDMayAllocate((uint32_t)reloc.payload)
+          .unsafeGetRaw();
+  }
+  return llvh::None;
+}
+
+} // namespace
+
+JITCodeCache::JITCodeCache(std::string dir)
+    : dir_(std::move(dir)), version_(computeVersion()) {
+  llvh::sys::fs::create_directories(dir_);
+}
+
+uintptr_t JITCodeCache::functionAnchor() {
+  return reinterpret_cast<uintptr_t>(&JITCodeCache::functionAnchor);
+}
+
+bool JITCodeCache::functionPayload(const void *fn, uint64_t &payload) {
+#ifdef HERMES_JIT_CODE_CACHE_DLADDR
+  static const void *anchorBase = [] {
+    Dl_info info;
+    return dladdr((const void *)functionAnchor(), &info) ? info.dli_fbase
+                                                          : nullptr;
+  }();
+  Dl_info info;
+  if (!anchorBase || !dladdr(fn, &info) || info.dli_fbase != anchorBase)
+    return false;
+  payload = (uint64_t)fn - (uint64_t)functionAnchor();
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string JITCodeCache::pathFor(CodeBlock *codeBlock, uint32_t config)
+    const {
+  SHA1 sourceHash =
+      codeBlock->getRuntimeModule()->getBytecode()->getSourceHash();
+  // Bytecode that doesn't record its source can't be identified.
+  if (sourceHash == SHA1{})
+    return std::string();
+
+  std::string path;
+  llvh::raw_string_ostream OS(path);
+  OS << dir_ << '/' << llvh::toHex(sourceHash, /* LowerCase */ true) << '-'
+     << codeBlock->getFunctionID() << '-'
+     << llvh::utohexstr(hashValue(version_, config), /* LowerCase */ true)
+     << ".jit";
+  return OS.str();
+}
+
+void JITCodeCache::store(
+    CodeBlock *codeBlock,
+    uint32_t config,
+    const JITCodeImage &image) {
+  std::string path = pathFor(codeBlock, config);
+  if (path.empty())
+    return;
+
+  // Write to a temporary file and rename it, so that concurrent processes
+  // never see a partially written file.
+  int fd;
+  llvh::SmallString<128> tmpPath;
+  if (llvh::sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd, tmpPath))
+    return;
+  {
+    llvh::raw_fd_ostream OS(fd, /* shouldClose */ true);
+    FileHeader header{
+        kMagic,
+        (uint32_t)image.code.size(),
+        version_,
+        bytecodeHash(codeBlock),
+        (uint32_t)image.relocs.size(),
+        image.osrEntryOffset};
+    OS.write((const char *)&header, sizeof(header));
+    OS.write((const char *)image.code.data(), image.code.size());
+    for (const JITReloc &reloc : image.relocs) {
+      FileReloc fileReloc{
+          reloc.offset, reloc.size, (uint8_t)reloc.kind, 0, reloc.payload};
+      OS.write((const char *)&fileReloc, sizeof(fileReloc));
+    }
+    OS.close();
+    if (OS.has_error()) {
+      OS.clear_error();
+      llvh::sys::fs::remove(tmpPath);
+      return;
+    }
+  }
+  if (llvh::sys::fs::rename(tmpPath, path))
+    llvh::sys::fs::remove(tmpPath);
+}
+
+bool JITCodeCache::load(
+    CodeBlock *codeBlock,
+    uint32_t config,
+    JITCodeImage &image) {
+  std::string path = pathFor(codeBlock, config);
+  if (path.empty())
+    return false;
+  auto bufOrErr = llvh::MemoryBuffer::getFile(path);
+  if (!bufOrErr)
+    return false;
+  const llvh::MemoryBuffer &buf = **bufOrErr;
+  const uint8_t *data = (const uint8_t *)buf.getBufferStart();
+  size_t size = buf.getBufferSize();
+
+  FileHeader header;
+  if (size < sizeof(header))
+    return false;
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != kMagic || header.version != version_ ||
+      size !=
+          sizeof(header) + header.codeSize +
+              (size_t)header.numRelocs * sizeof(FileReloc) ||
+      (header.osrEntryOffset != JITCodeImage::kNoOSREntry &&
+       header.osrEntryOffset >= header.codeSize)) {
+    LLVM_DEBUG(llvh::dbgs() << "JIT code cache: invalid file " << path << "\n");
+    return false;
+  }
+  // The function may have changed without the source hash changing, for
+  // example if it was compiled with different options.
+  if (header.bytecodeHash != bytecodeHash(codeBlock))
+    return false;
+
+  data += sizeof(header);
+  image.code.assign(data, data + header.codeSize);
+  image.osrEntryOffset = header.osrEntryOffset;
+  data += header.codeSize;
+
+  image.relocs.clear();
+  image.relocs.reserve(header.numRelocs);
+  for (uint32_t i = 0; i < header.numRelocs; ++i) {
+    FileReloc fileReloc;
+    memcpy(&fileReloc, data + i * sizeof(FileReloc), sizeof(FileReloc));
+    if (fileReloc.kind > (uint8_t)JITRelocKind::_last ||
+        (fileReloc.size != 4 && fileReloc.size != 8) ||
+        (uint64_t)fileReloc.offset + fileReloc.size > header.codeSize) {
+      return false;
+    }
+    JITReloc reloc{
+        fileReloc.offset,
+        fileReloc.size,
+        (JITRelocKind)fileReloc.kind,
+        fileReloc.payload};
+    auto value = relocValue(codeBlock, reloc);
+    if (!value)
+      return false;
+    if (reloc.size == 4) {
+      uint32_t value32 = (uint32_t)*value;
+      memcpy(image.code.data() + reloc.offset, &value32, sizeof(value32));
+    } else {
+      memcpy(image.code.data() + reloc.offset, &*value, sizeof(uint64_t));
+    }
+    image.relocs.push_back(reloc);
+  }
+  return true;
+}
+
+} // namespace vm
+} // namespace hermes
+#endif // HERMESVM_JIT
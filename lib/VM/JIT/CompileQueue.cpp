@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JIT/Config.h"
+#if HERMESVM_JIT
+#include "hermes/VM/JIT/CompileQueue.h"
+
+#include "hermes/Inst/InstDecode.h"
+#include "hermes/VM/RuntimeModule.h"
+
+#include <algorithm>
+#include <array>
+
+namespace hermes {
+namespace vm {
+
+using hermes::inst::Inst;
+using hermes::inst::OpCode;
+
+/// \return a table with one entry per opcode, where bit N is set if operand N
+/// (counting from 1) of the opcode is a string ID.
+static const std::array<uint8_t, (size_t)OpCode::_last> &stringIDOperands() {
+  static const std::array<uint8_t, (size_t)OpCode::_last> table = [] {
+    std::array<uint8_t, (size_t)OpCode::_last> res{};
+#define OPERAND_STRING_ID(name, operandNumber) \
+  res[(size_t)OpCode::name] |= 1u << (operandNumber);
+#include "hermes/BCGen/HBC/BytecodeList.def"
+    return res;
+  }();
+  return table;
+}
+
+void resolveJITSymbols(CodeBlock *codeBlock, JITSymbolMap &symbols) {
+  RuntimeModule *runtimeModule = codeBlock->getRuntimeModule();
+  const auto &operandTable = stringIDOperands();
+
+  for (auto *ip = codeBlock->begin(), *end = codeBlock->end(); ip != end;) {
+    auto decoded = inst::decodeInstruction((const Inst *)ip);
+    if (uint8_t mask = operandTable[(size_t)decoded.meta.opCode]) {
+      for (unsigned i = 0; i < decoded.meta.numOperands; ++i) {
+        if (!(mask & (1u << (i + 1))))
+          continue;
+        uint32_t stringID = decoded.operandValue[i].integer;
+        SymbolID id = decoded.meta.opCode == OpCode::CreateRegExp
+            ? runtimeModule->getSymbolIDFromStringIDMayAllocate(stringID)
+            : runtimeModule->getSymbolIDIfExists(stringID);
+        if (id.isValid())
+          symbols.try_emplace(stringID, id);
+      }
+    }
+    ip += decoded.meta.size;
+  }
+}
+
+void takeJITCompileSnapshot(
+    CodeBlock *codeBlock,
+    JITCompileSnapshot &snapshot) {
+  resolveJITSymbols(codeBlock, snapshot.symbols);
+  snapshot.nonNumberSites = codeBlock->getNonNumberSites();
+  snapshot.deoptCount = codeBlock->getDeoptCount();
+}
+
+JITCompileQueue::JITCompileQueue(CompileFn compile)
+    : compile_(std::move(compile)) {
+  thread_ = std::thread([this]() { run(); });
+}
+
+JITCompileQueue::~JITCompileQueue() {
+  {
+    std::lock_guard<std::mutex> lk{mutex_};
+    stop_ = true;
+    queue_.clear();
+  }
+  workAvailable_.notify_one();
+  thread_.join();
+}
+
+void JITCompileQueue::enqueue(CodeBlock *codeBlock) {
+  Job job{codeBlock, JITCompileSnapshot(), Clock::now()};
+  takeJITCompileSnapshot(codeBlock, job.snapshot);
+  {
+    std::lock_guard<std::mutex> lk{mutex_};
+    queue_.push_back(std::move(job));
+    stats_.queueDepth = queue_.size();
+    stats_.maxQueueDepth = std::max(stats_.maxQueueDepth, stats_.queueDepth);
+  }
+  workAvailable_.notify_one();
+}
+
+void JITCompileQueue::takeResults(std::vector<JITCompileResult> &results) {
+  std::lock_guard<std::mutex> lk{mutex_};
+  results.insert(results.end(), results_.begin(), results_.end());
+  results_.clear();
+  hasResults_.store(false, std::memory_order_release);
+}
+
+void JITCompileQueue::cancel(RuntimeModule *runtimeModule) {
+  auto belongs = [runtimeModule](CodeBlock *codeBlock) {
+    return codeBlock->getRuntimeModule() == runtimeModule;
+  };
+
+  std::unique_lock<std::mutex> lk{mutex_};
+  queue_.erase(
+      std::remove_if(
+          queue_.begin(),
+          queue_.end(),
+          [&belongs](const Job &job) { return belongs(job.codeBlock); }),
+      queue_.end());
+  stats_.queueDepth = queue_.size();
+
+  jobDone_.wait(
+      lk, [this, &belongs]() { return !inProgress_ || !belongs(inProgress_); });
+
+  // The native code of discarded results is not released, like the code of
+  // any other CodeBlock that is freed.
+  results_.erase(
+      std::remove_if(
+          results_.begin(),
+          results_.end(),
+          [&belongs](const JITCompileResult &res) {
+            return belongs(res.codeBlock);
+          }),
+      results_.end());
+  hasResults_.store(!results_.empty(), std::memory_order_release);
+}
+
+JITCompileQueueStats JITCompileQueue::getStats() {
+  std::lock_guard<std::mutex> lk{mutex_};
+  return stats_;
+}
+
+void JITCompileQueue::run() {
+  std::unique_lock<std::mutex> lk{mutex_};
+  for (;;) {
+    workAvailable_.wait(lk, [this]() { return stop_ || !queue_.empty(); });
+    if (stop_)
+      return;
+
+    Job job = std::move(queue_.front());
+    queue_.pop_front();
+    stats_.queueDepth = queue_.size();
+    inProgress_ = job.codeBlock;
+    lk.unlock();
+
+    Clock::time_point start = Clock::now();
+    JITCompileResult res = compile_(job.codeBlock, job.snapshot);
+    Clock::time_point end = Clock::now();
+
+    lk.lock();
+    inProgress_ = nullptr;
+    double compileTime = std::chrono::duration<double>(end - start).count();
+    ++stats_.numCompiled;
+    stats_.compileTime += compileTime;
+    stats_.maxCompileTime = std::max(stats_.maxCompileTime, compileTime);
+    stats_.waitTime +=
+        std::chrono::duration<double>(start - job.enqueueTime).count();
+    results_.push_back(res);
+    hasResults_.store(true, std::memory_order_release);
+    jobDone_.notify_all();
+  }
+}
+
+} // namespace vm
+} // namespace hermes
+#endif // HERMESVM_JIT
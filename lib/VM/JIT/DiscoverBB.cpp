@@ -24,17 +24,27 @@ using hermes::inst::OperandType;
 void discoverBasicBlocks(
     CodeBlock *codeBlock,
     std::vector<uint32_t> &basicBlocks,
-    llvh::DenseMap<uint32_t, unsigned> &labels) {
+    llvh::DenseMap<uint32_t, unsigned> &labels,
+    std::vector<uint32_t> *loopHeaders) {
   auto const begin = codeBlock->begin();
   auto const end = codeBlock->end();
 
   llvh::DenseSet<uint32_t> labelSet{};
+  llvh::DenseSet<uint32_t> loopHeaderSet{};
+  auto ip = begin;
 
   auto addLabel = [begin, &labelSet](const uint8_t *label) {
     labelSet.insert((uint32_t)(label - begin));
   };
+  // Add the destination of a branch at \p ip as a label, and record it as a
+  // loop header if the branch goes backwards.
+  auto addBranchTarget = [begin, &ip, &addLabel, &loopHeaderSet](
+                             const uint8_t *target) {
+    addLabel(target);
+    if (target <= ip)
+      loopHeaderSet.insert((uint32_t)(target - begin));
+  };
 
-  auto ip = begin;
   // Add the start of the bytecode.
   addLabel(ip);
 
@@ -63,11 +73,11 @@ void discoverBasicBlocks(
       for (uint32_t i = 0; i < entries; ++i) {
         const int32_t *loc = (const int32_t *)tablestart + i;
         int32_t offset = *loc;
-        addLabel(ip + offset);
+        addBranchTarget(ip + offset);
       }
 
       int32_t defaultOffset = decoded.operandValue[2].integer;
-      addLabel(ip + defaultOffset);
+      addBranchTarget(ip + defaultOffset);
 
       ip += decoded.meta.size;
       // Switch is a branch. Add the next instruction as a label.
@@ -81,7 +91,7 @@ void discoverBasicBlocks(
           decoded.meta.operandType[i] == OperandType::Addr32) {
         offset = decoded.operandValue[i].integer;
         // Add the branch destination as a label.
-        addLabel(ip + offset);
+        addBranchTarget(ip + offset);
         branch = true;
       }
     }
@@ -117,6 +127,11 @@ void discoverBasicBlocks(
     labels.try_emplace(basicBlocks[i], i);
     LLVM_DEBUG(llvh::outs() << "  BB" << i << " at " << basicBlocks[i] << "\n");
   }
+
+  if (loopHeaders) {
+    loopHeaders->assign(loopHeaderSet.begin(), loopHeaderSet.end());
+    std::sort(loopHeaders->begin(), loopHeaders->end());
+  }
 }
 
 } // namespace vm
@@ -275,6 +275,18 @@ void *_jit_find_catch_target(
   _sh_throw_current(shr);
 }
 
+SHLegacyValue _jit_deoptimize(SHRuntime *shr, SHCodeBlock *shCodeBlock) {
+  Runtime &runtime = getRuntime(shr);
+  CodeBlock *codeBlock = (CodeBlock *)shCodeBlock;
+
+  runtime.getJITContext().deoptimize(codeBlock);
+  CallResult<HermesValue> result =
+      runtime.interpretDeoptimizedFrame(codeBlock, runtime.getCurrentIP());
+  if (LLVM_UNLIKELY(result == ExecutionStatus::EXCEPTION))
+    _sh_throw_current(shr);
+  return *result;
+}
+
 SHLegacyValue _jit_dispatch_call(
     SHRuntime *shr,
     SHLegacyValue *callTargetSHLV) {
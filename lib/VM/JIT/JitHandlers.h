@@ -120,4 +120,10 @@ void *_jit_find_catch_target(
 /// caller is responsible for setting up the outgoing registers.
 SHLegacyValue _jit_dispatch_call(SHRuntime *, SHLegacyValue *callTargetSHLV);
 
+/// Discard the native code of \p codeBlock, whose frame is the current one,
+/// and finish executing the frame in the interpreter, starting from the saved
+/// IP. Called by speculative JIT'ed code whose assumptions did not hold.
+/// \return the result of the function.
+SHLegacyValue _jit_deoptimize(SHRuntime *shr, SHCodeBlock *codeBlock);
+
 } // namespace hermes::vm
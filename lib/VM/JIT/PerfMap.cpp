@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JIT/Config.h"
+#if HERMESVM_JIT
+#include "hermes/VM/JIT/PerfMap.h"
+
+#include "hermes/BCGen/HBC/BCProvider.h"
+#include "hermes/Support/OSCompat.h"
+#include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/RuntimeModule.h"
+
+#include "llvh/Support/raw_ostream.h"
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace hermes {
+namespace vm {
+
+std::string perfMapSymbolName(const CodeBlock *codeBlock) {
+  std::string str;
+  llvh::raw_string_ostream OS(str);
+  std::string name = codeBlock->getNameString();
+  OS << "JS:" << (name.empty() ? "anonymous" : name);
+  if (auto loc = codeBlock->getSourceLocationForFunction()) {
+    OS << ' '
+       << codeBlock->getRuntimeModule()
+              ->getBytecode()
+              ->getDebugInfo()
+              ->getUTF8FilenameByID(loc->filenameId)
+       << ':' << loc->line << ':' << loc->column;
+  }
+  OS.flush();
+  return str;
+}
+
+#ifdef __linux__
+
+namespace {
+
+/// The jitdump format is described in
+/// tools/perf/Documentation/jitdump-specification.txt in the Linux tree.
+constexpr uint32_t kJitDumpMagic = 0x4A695444;
+constexpr uint32_t kJitDumpVersion = 1;
+constexpr uint32_t kJitCodeLoad = 0;
+
+#if defined(__x86_64__)
+constexpr uint32_t kElfMachine = 62; // EM_X86_64
+#elif defined(__aarch64__)
+constexpr uint32_t kElfMachine = 183; // EM_AARCH64
+#else
+constexpr uint32_t kElfMachine = 0; // EM_NONE
+#endif
+
+struct JitDumpHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t totalSize;
+  uint32_t elfMach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+};
+
+struct JitDumpCodeLoad {
+  uint32_t id;
+  uint32_t totalSize;
+  uint64_t timestamp;
+  uint32_t pid;
+  uint32_t tid;
+  uint64_t vma;
+  uint64_t codeAddr;
+  uint64_t codeSize;
+  uint64_t codeIndex;
+};
+
+/// The output files, shared by all runtimes in the process. They are never
+/// closed, since code may be compiled until the process exits.
+struct PerfMapFiles {
+  /// Serializes opening and writing the files.
+  std::mutex mutex{};
+
+  /// The /tmp/perf-<pid>.map file, or nullptr if it couldn't be opened.
+  FILE *perfMap = nullptr;
+  /// Whether opening the perf map has been attempted.
+  bool perfMapOpened = false;
+
+  /// The jit-<pid>.dump file descriptor, or -1 if it couldn't be opened.
+  int jitDump = -1;
+  /// Whether opening the jitdump has been attempted.
+  bool jitDumpOpened = false;
+  /// The index of the next code load record in the jitdump.
+  uint64_t codeIndex = 0;
+};
+
+PerfMapFiles &getFiles() {
+  static PerfMapFiles files{};
+  return files;
+}
+
+/// \return the timestamp in the clock perf expects when run with "-k mono".
+uint64_t getTimestamp() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/// Write \p size bytes at \p data to \p fd, retrying short writes.
+/// \return true on success.
+bool writeAll(int fd, const void *data, size_t size) {
+  const char *p = static_cast<const char *>(data);
+  while (size) {
+    ssize_t res = ::write(fd, p, size);
+    if (res < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    p += res;
+    size -= res;
+  }
+  return true;
+}
+
+void openPerfMap(PerfMapFiles &files) {
+  files.perfMapOpened = true;
+  std::string path =
+      "/tmp/perf-" + std::to_string(oscompat::process_id()) + ".map";
+  files.perfMap = fopen(path.c_str(), "a");
+}
+
+void openJitDump(PerfMapFiles &files) {
+  files.jitDumpOpened = true;
+  uint64_t pid = oscompat::process_id();
+  std::string path = "jit-" + std::to_string(pid) + ".dump";
+  int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC, 0666);
+  if (fd < 0)
+    return;
+
+  // perf finds the jitdump through the executable mapping of it recorded in
+  // perf.data, the mapping itself is never accessed.
+  void *marker = ::mmap(
+      nullptr,
+      oscompat::page_size(),
+      PROT_READ | PROT_EXEC,
+      MAP_PRIVATE,
+      fd,
+      0);
+  if (marker == MAP_FAILED) {
+    ::close(fd);
+    return;
+  }
+
+  JitDumpHeader header{};
+  header.magic = kJitDumpMagic;
+  header.version = kJitDumpVersion;
+  header.totalSize = sizeof(header);
+  header.elfMach = kElfMachine;
+  header.pid = pid;
+  header.timestamp = getTimestamp();
+  if (!writeAll(fd, &header, sizeof(header))) {
+    ::close(fd);
+    return;
+  }
+  files.jitDump = fd;
+}
+
+} // namespace
+
+void perfMapAddCode(
+    JITPerfMapMode mode,
+    const CodeBlock *codeBlock,
+    const void *code,
+    size_t size) {
+  if (mode == JITPerfMapMode::None)
+    return;
+
+  std::string name = perfMapSymbolName(codeBlock);
+  PerfMapFiles &files = getFiles();
+  std::lock_guard<std::mutex> lk{files.mutex};
+
+  if (mode == JITPerfMapMode::PerfMap) {
+    if (!files.perfMapOpened)
+      openPerfMap(files);
+    if (!files.perfMap)
+      return;
+    fprintf(
+        files.perfMap,
+        "%" PRIxPTR " %zx %s\n",
+        (uintptr_t)code,
+        size,
+        name.c_str());
+    fflush(files.perfMap);
+    return;
+  }
+
+  assert(mode == JITPerfMapMode::JitDump && "unknown perf map mode");
+  if (!files.jitDumpOpened)
+    openJitDump(files);
+  if (files.jitDump < 0)
+    return;
+
+  JitDumpCodeLoad record{};
+  record.id = kJitCodeLoad;
+  record.totalSize = sizeof(record) + name.size() + 1 + size;
+  record.timestamp = getTimestamp();
+  record.pid = oscompat::process_id();
+  record.tid = oscompat::global_thread_id();
+  record.vma = (uintptr_t)code;
+  record.codeAddr = (uintptr_t)code;
+  record.codeSize = size;
+  record.codeIndex = files.codeIndex++;
+  // The name includes its terminating NUL.
+  if (!writeAll(files.jitDump, &record, sizeof(record)) ||
+      !writeAll(files.jitDump, name.c_str(), name.size() + 1) ||
+      !writeAll(files.jitDump, code, size)) {
+    // Don't append anything after a partial record.
+    ::close(files.jitDump);
+    files.jitDump = -1;
+  }
+}
+
+#else
+
+void perfMapAddCode(
+    JITPerfMapMode mode,
+    const CodeBlock *codeBlock,
+    const void *code,
+    size_t size) {}
+
+#endif // __linux__
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMESVM_JIT
@@ -9,6 +9,8 @@
 #define HERMES_VM_JIT_X86_64_RUNTIMEOFFSETS_H
 
 #include "hermes/VM/Callable.h"
+#include "hermes/VM/JSArray.h"
+#include "hermes/VM/JSTypedArray.h"
 #include "hermes/VM/Runtime.h"
 #include "hermes/VM/RuntimeModule.h"
 
@@ -46,6 +48,62 @@ struct RuntimeOffsets {
   static constexpr uint32_t kindAndSizeKind = KindAndSize::kNumSizeBits / 8;
 
   static constexpr uint32_t boxedDoubleValue = offsetof(BoxedDouble, value_);
+
+  static constexpr uint32_t arrayBeginIndex = offsetof(ArrayImpl, beginIndex_);
+  static constexpr uint32_t arrayEndIndex = offsetof(ArrayImpl, endIndex_);
+  static constexpr uint32_t arrayIndexedStorage =
+      offsetof(ArrayImpl, indexedStorage_);
+  /// The inline storage is a trailing object, aligned like TrailingObjects
+  /// does it.
+  static constexpr uint32_t segmentedArrayInlineStorage =
+      llvh::alignTo<alignof(GCSmallHermesValue)>(sizeof(SegmentedArraySmall));
+  static constexpr uint32_t segmentData =
+      offsetof(SegmentedArraySmall::Segment, data_);
+
+  static constexpr uint32_t typedArrayBuffer =
+      offsetof(JSTypedArrayBase, buffer_);
+  static constexpr uint32_t typedArrayLength =
+      offsetof(JSTypedArrayBase, length_);
+  static constexpr uint32_t typedArrayOffset =
+      offsetof(JSTypedArrayBase, offset_);
+  static constexpr uint32_t arrayBufferData = offsetof(JSArrayBuffer, data_);
+  static constexpr uint32_t arrayBufferAttached =
+      offsetof(JSArrayBuffer, attached_);
+
+  /// \return a hash of all the offsets above. Native code embeds them, so it
+  /// can only be reused by a VM with the same hash.
+  static constexpr uint64_t layoutHash() {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (uint32_t ofs :
+         {stackPointer,
+          registerStackEnd,
+          currentFrame,
+          currentIP,
+          globalObject,
+          thrownValue,
+          shLocals,
+          builtins,
+          nativeStackHigh,
+          nativeStackSize,
+          codeBlockJitPtr,
+          jsFunctionCodeBlock,
+          runtimeModuleModuleCache,
+          kindAndSizeKind,
+          boxedDoubleValue,
+          arrayBeginIndex,
+          arrayEndIndex,
+          arrayIndexedStorage,
+          segmentedArrayInlineStorage,
+          segmentData,
+          typedArrayBuffer,
+          typedArrayLength,
+          typedArrayOffset,
+          arrayBufferData,
+          arrayBufferAttached}) {
+      hash = (hash ^ ofs) * 0x100000001b3;
+    }
+    return hash;
+  }
 };
 
 #pragma GCC diagnostic pop
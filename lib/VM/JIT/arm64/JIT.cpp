@@ -13,6 +13,7 @@
 
 #include "hermes/Inst/InstDecode.h"
 #include "hermes/VM/JIT/DiscoverBB.h"
+#include "hermes/VM/JIT/PerfMap.h"
 #include "hermes/VM/RuntimeModule.h"
 
 #define DEBUG_TYPE "jit"
@@ -265,8 +266,9 @@ JITCompiledFunctionPtr JITContext::Compiler::compileCodeBlockImpl() {
   em_.leave(handlers);
 
   size_t memoryLimit = jc_.memoryLimit_;
+  size_t codeSize = em_.code.codeSize();
   size_t usedSize =
-      jc_.impl_->jr.allocator()->statistics().usedSize() + em_.code.codeSize();
+      jc_.impl_->jr.allocator()->statistics().usedSize() + codeSize;
 
   if (LLVM_UNLIKELY(usedSize > memoryLimit)) {
     // Disable the JIT if we would go over the memory limit.
@@ -278,7 +280,10 @@ JITCompiledFunctionPtr JITContext::Compiler::compileCodeBlockImpl() {
     return nullptr;
   }
 
-  codeBlock_->setJITCompiled(em_.addToRuntime(jc_.impl_->jr));
+  JITCompiledFunctionPtr fn = em_.addToRuntime(jc_.impl_->jr);
+  codeBlock_->setJITCompiled(fn);
+  if (LLVM_UNLIKELY(jc_.perfMapMode_ != JITPerfMapMode::None))
+    perfMapAddCode(jc_.perfMapMode_, codeBlock_, (const void *)fn, codeSize);
 
   if (LLVM_UNLIKELY(usedSize == memoryLimit)) {
     // Disable compilation for the future because we've hit the limit,
@@ -637,6 +642,30 @@ inline void JITContext::Compiler::emitGetByIdShort(
   em_.getById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
 }
 
+inline void JITContext::Compiler::emitGetByIdParam(
+    const inst::GetByIdParamInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.loadParam(FR(inst->op1), inst->op2);
+  em_.getById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdGlobal(
+    const inst::GetByIdGlobalInst *inst) {
+  auto idVal = ID(inst->op3);
+  auto cacheIdx = inst->op2;
+  em_.getGlobalObject(FR(inst->op1));
+  em_.getById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryGetByIdGlobal(
+    const inst::TryGetByIdGlobalInst *inst) {
+  auto idVal = ID(inst->op3);
+  auto cacheIdx = inst->op2;
+  em_.getGlobalObject(FR(inst->op1));
+  em_.tryGetById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
 inline void JITContext::Compiler::emitGetByIdWithReceiverLong(
     const inst::GetByIdWithReceiverLongInst *inst) {
   auto idVal = ID(inst->op5);
@@ -783,6 +812,7 @@ inline void JITContext::Compiler::emitDefineOwnGetterSetterByVal(
   }
 
 EMIT_OWN_BY_SLOT_IDX(PutOwnBySlotIdx, putOwnBySlotIdx)
+EMIT_OWN_BY_SLOT_IDX(PutOwnNPBySlotIdx, putOwnBySlotIdx)
 EMIT_OWN_BY_SLOT_IDX(GetOwnBySlotIdx, getOwnBySlotIdx)
 
 #undef EMIT_OWN_BY_SLOT_IDX
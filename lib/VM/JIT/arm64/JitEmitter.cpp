@@ -9,7 +9,7 @@
 #if HERMESVM_JIT
 #include "JitEmitter.h"
 
-#include "JitHandlers.h"
+#include "../JitHandlers.h"
 
 #include "../RuntimeOffsets.h"
 #include "hermes/BCGen/HBC/StackFrameLayout.h"
@@ -1090,6 +1090,45 @@ void Emitter::callWithoutThunk(void *fn, const char *name) {
   a.blr(a64::x16);
 }
 
+void Emitter::loadPropertyCacheEntry(
+    a64::GpX dst,
+    int32_t roOfsCachePtr,
+    uint32_t ofs) {
+  a.ldr(dst, a64::Mem(roDataLabel_, roOfsCachePtr));
+  if (ofs == 0)
+    return;
+  if (a64::Utils::isAddSubImm(ofs)) {
+    a.add(dst, dst, ofs);
+    return;
+  }
+  // Large caches need the offset split into a shifted and an unshifted
+  // immediate.
+  a.add(dst, dst, ofs & ~0xfffu);
+  a.add(dst, dst, ofs & 0xfffu);
+}
+
+void Emitter::loadReadCacheEntry(a64::GpX dst, uint8_t cacheIdx) {
+  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
+    a.mov(dst, 0);
+    return;
+  }
+  loadPropertyCacheEntry(
+      dst,
+      roOfsReadPropertyCachePtr_,
+      sizeof(SHReadPropertyCacheEntry) * cacheIdx);
+}
+
+void Emitter::loadWriteCacheEntry(a64::GpX dst, uint8_t cacheIdx) {
+  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
+    a.mov(dst, 0);
+    return;
+  }
+  loadPropertyCacheEntry(
+      dst,
+      roOfsWritePropertyCachePtr_,
+      sizeof(SHWritePropertyCacheEntry) * cacheIdx);
+}
+
 void Emitter::loadFrameAddr(a64::GpX dst, FR frameReg) {
   auto ofs =
       (frameReg.index() + StackFrameLayout::FirstLocal) * sizeof(SHLegacyValue);
@@ -2738,13 +2777,7 @@ void Emitter::createThis(
   a.mov(a64::x0, xRuntime);
   loadFrameAddr(a64::x1, frCallee);
   loadFrameAddr(a64::x2, frNewTarget);
-  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
-    a.mov(a64::x3, 0);
-  } else {
-    a.ldr(a64::x3, a64::Mem(roDataLabel_, roOfsReadPropertyCachePtr_));
-    if (cacheIdx != 0)
-      a.add(a64::x3, a64::x3, sizeof(SHReadPropertyCacheEntry) * cacheIdx);
-  }
+  loadReadCacheEntry(a64::x3, cacheIdx);
   EMIT_RUNTIME_CALL(
       *this,
       SHLegacyValue(*)(
@@ -3334,16 +3367,13 @@ void Emitter::getByIdImpl(
     // xTemp2 is the hidden class.
     emit_load_cp(a, xTemp2, a64::Mem(xTemp1, offsetof(SHJSObject, clazz)));
 
-    // xTemp3 points to the start of read property cache.
-    a.ldr(xTemp3, a64::Mem(roDataLabel_, roOfsReadPropertyCachePtr_));
+    // xTemp3 points to the read property cache entry.
+    loadReadCacheEntry(xTemp3, cacheIdx);
     // xTemp4 = cacheEntry->clazz.
     emit_load_cp(
         a,
         xTemp4,
-        a64::Mem(
-            xTemp3,
-            sizeof(SHReadPropertyCacheEntry) * cacheIdx +
-                offsetof(SHReadPropertyCacheEntry, clazz)));
+        a64::Mem(xTemp3, offsetof(SHReadPropertyCacheEntry, clazz)));
 
     // Compare hidden classes.
     a.cmp(xTemp2, xTemp4);
@@ -3352,10 +3382,7 @@ void Emitter::getByIdImpl(
     // Hidden class matches. Fetch the slot in xTemp4
     a.ldr(
         xTemp4.w(),
-        a64::Mem(
-            xTemp3,
-            sizeof(SHReadPropertyCacheEntry) * cacheIdx +
-                offsetof(SHReadPropertyCacheEntry, slot)));
+        a64::Mem(xTemp3, offsetof(SHReadPropertyCacheEntry, slot)));
 
     // Is it an indirect slot?
     a.cmp(xTemp4.w(), HERMESVM_DIRECT_PROPERTY_SLOTS);
@@ -3419,13 +3446,7 @@ void Emitter::getByIdImpl(
   a.mov(a64::x0, xRuntime);
   loadFrameAddr(a64::x1, frSource);
   a.mov(a64::w2, symID);
-  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
-    a.mov(a64::x3, 0);
-  } else {
-    a.ldr(a64::x3, a64::Mem(roDataLabel_, roOfsReadPropertyCachePtr_));
-    if (cacheIdx != 0)
-      a.add(a64::x3, a64::x3, sizeof(SHReadPropertyCacheEntry) * cacheIdx);
-  }
+  loadReadCacheEntry(a64::x3, cacheIdx);
   callThunkWithSavedIP((void *)shImpl, shImplName);
 
   movHWFromHW<false>(hwRes, HWReg::gpX(0));
@@ -3460,13 +3481,7 @@ void Emitter::getByIdWithReceiver(
   loadFrameAddr(a64::x1, frSource);
   loadFrameAddr(a64::x2, frReceiver);
   a.mov(a64::w3, symID);
-  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
-    a.mov(a64::x4, 0);
-  } else {
-    a.ldr(a64::x4, a64::Mem(roDataLabel_, roOfsReadPropertyCachePtr_));
-    if (cacheIdx != 0)
-      a.add(a64::x4, a64::x4, sizeof(SHReadPropertyCacheEntry) * cacheIdx);
-  }
+  loadReadCacheEntry(a64::x4, cacheIdx);
   EMIT_RUNTIME_CALL(
       *this,
       SHLegacyValue(*)(
@@ -4031,13 +4046,7 @@ void Emitter::putByIdImpl(
   loadFrameAddr(a64::x1, frTarget);
   a.mov(a64::w2, symID);
   loadFrameAddr(a64::x3, frValue);
-  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
-    a.mov(a64::x4, 0);
-  } else {
-    a.ldr(a64::x4, a64::Mem(roDataLabel_, roOfsWritePropertyCachePtr_));
-    if (cacheIdx != 0)
-      a.add(a64::x4, a64::x4, sizeof(SHWritePropertyCacheEntry) * cacheIdx);
-  }
+  loadWriteCacheEntry(a64::x4, cacheIdx);
   callThunkWithSavedIP((void *)shImpl, shImplName);
 }
 
@@ -4068,13 +4077,7 @@ void Emitter::defineOwnById(
   loadFrameAddr(a64::x1, frTarget);
   a.mov(a64::w2, symID);
   loadFrameAddr(a64::x3, frValue);
-  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
-    a.mov(a64::x4, 0);
-  } else {
-    a.ldr(a64::x4, a64::Mem(roDataLabel_, roOfsWritePropertyCachePtr_));
-    if (cacheIdx != 0)
-      a.add(a64::x4, a64::x4, sizeof(SHWritePropertyCacheEntry) * cacheIdx);
-  }
+  loadWriteCacheEntry(a64::x4, cacheIdx);
   EMIT_RUNTIME_CALL(
       *this,
       void (*)(
@@ -905,6 +905,18 @@ class Emitter {
   }
 
   void loadFrameAddr(a64::GpX dst, FR frameReg);
+  /// Load the address of the cache entry at byte offset \p ofs from the
+  /// property cache pointer stored in RO data at \p roOfsCachePtr.
+  void loadPropertyCacheEntry(
+      a64::GpX dst,
+      int32_t roOfsCachePtr,
+      uint32_t ofs);
+  /// Load the address of read property cache entry \p cacheIdx, or nullptr
+  /// if caching is disabled.
+  void loadReadCacheEntry(a64::GpX dst, uint8_t cacheIdx);
+  /// Load the address of write property cache entry \p cacheIdx, or nullptr
+  /// if caching is disabled.
+  void loadWriteCacheEntry(a64::GpX dst, uint8_t cacheIdx);
   template <bool use>
   void movHWFromHW(HWReg dst, HWReg src);
   void _storeHWToFrame(FR fr, HWReg src);
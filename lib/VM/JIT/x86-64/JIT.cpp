@@ -0,0 +1,1596 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JIT/Config.h"
+#if HERMESVM_JIT
+#include "hermes/VM/JIT/x86-64/JIT.h"
+
+#include "JitEmitter.h"
+
+#include "hermes/Inst/InstDecode.h"
+#include "hermes/VM/JIT/DiscoverBB.h"
+#include "hermes/VM/JIT/PerfMap.h"
+#include "hermes/VM/RuntimeModule.h"
+
+#define DEBUG_TYPE "jit"
+
+namespace hermes {
+namespace vm {
+namespace x86_64 {
+
+class JITContext::Impl {
+ public:
+  asmjit::JitRuntime jr{};
+};
+
+JITContext::JITContext(bool enable) : enabled_(enable) {
+  if (!enable)
+    return;
+  impl_ = std::make_unique<Impl>();
+}
+
+JITContext::~JITContext() = default;
+
+// Calculate the address of the next instruction given the name of the
+// current one.
+#define NEXTINST(name) ((const inst::Inst *)(&ip->i##name + 1))
+
+// Add an arbitrary byte offset to ip.
+#define IPADD(val) ((const inst::Inst *)((const uint8_t *)ip + (val)))
+
+/// Map from a string ID encoded in the operand to an SHSymbolID.
+/// This string ID must be used explicitly as identifier.
+#define ID(stringID) (symbolIDMustExist(stringID).unsafeGetIndex())
+
+/// JIT_INLINE forces some methods to be inlined, but only in release mode.
+#ifdef NDEBUG
+#define JIT_INLINE LLVM_ATTRIBUTE_ALWAYS_INLINE inline
+#else
+#define JIT_INLINE inline
+#endif
+
+class JITContext::Compiler {
+  JITContext &jc_;
+  /// The implementation of the assembly emitter.
+  Emitter em_;
+  /// The CodeBlock compiled by this instance.
+  CodeBlock *const codeBlock_;
+  /// Pointer to the first bytecode instruction.
+  const char *const funcStart_;
+  /// The byte offset of every bytecode basic block start. The last entry is
+  /// the exclusive end of the bytecode.
+  std::vector<uint32_t> basicBlocks_{};
+  /// Map bytecode offset to a basic block.
+  llvh::DenseMap<uint32_t, unsigned> ofsToBBIndex_{};
+  /// The byte offset of every target of a backward branch. These are the
+  /// places where an interpreter frame can be transferred to native code.
+  std::vector<uint32_t> loopHeaders_{};
+  /// The ASMJIT label associated with every basic block.
+  std::vector<asmjit::Label> bbLabels_{};
+  /// The function name for debugging.
+  std::string funcName_{};
+  /// When compiling on the background thread, the state of the CodeBlock
+  /// copied by the mutator. Null when compiling on the mutator.
+  const JITCompileSnapshot *const snapshot_;
+  /// Type feedback of the CodeBlock, see CodeBlock::getNonNumberSites().
+  const llvh::BitVector &nonNumberSites_;
+  /// Whether to speculate on the types of operands.
+  const bool speculate_;
+  /// When the code cache is enabled, the string ID of every SymbolID passed
+  /// to the emitter, keyed by the raw SymbolID.
+  llvh::DenseMap<uint32_t, uint32_t> symbolStringIDs_{};
+
+  /// Jump buffer used for errors.
+  jmp_buf errorJmpBuf_{};
+
+  enum class Error {
+    NoError,
+    UnsupportedInst,
+    Other,
+  };
+  /// In case of error, the error reason is stored here.
+  Error error_ = Error::NoError;
+  /// In case of "other" error, the error message is recorded here.
+  std::string otherErrorMessage_{};
+
+ public:
+  Compiler(
+      JITContext &jc,
+      CodeBlock *codeBlock,
+      const JITCompileSnapshot *snapshot = nullptr)
+      : jc_(jc),
+        em_(jc.impl_->jr,
+            jc.getDumpJITCode(),
+            jc.getEmitAsserts(),
+            codeBlock,
+            codeBlock->readPropertyCache(),
+            codeBlock->writePropertyCache(),
+            // TODO: is getFrameSize() the right thing to call?
+            codeBlock->getFrameSize(),
+            [this](std::string &&message) {
+              otherErrorMessage_ = std::move(message);
+              error_ = Error::Other;
+              _sh_longjmp(errorJmpBuf_, 1);
+            }),
+        codeBlock_(codeBlock),
+        funcStart_((const char *)codeBlock->begin()),
+        snapshot_(snapshot),
+        nonNumberSites_(
+            snapshot ? snapshot->nonNumberSites
+                     : codeBlock->getNonNumberSites()),
+        speculate_(
+            jc.speculate_ &&
+            (snapshot ? snapshot->deoptCount : codeBlock->getDeoptCount()) <
+                kMaxDeopts) {}
+
+  /// Compile the codeblock that this object was instantiated for. Neither the
+  /// codeblock nor the JITContext are modified, the result must be installed
+  /// with JITContext::installCompiled().
+  JITCompileResult compileCodeBlock();
+
+ private:
+  /// Compile the codeblock that this object was instantiated for. On failure,
+  /// longjmp(errorJmpBuf).
+  JITCompileResult compileCodeBlockImpl();
+
+  /// \return the symbol of an identifier encoded as string ID \p stringID.
+  SymbolID symbolIDMustExist(uint32_t stringID) {
+    if (!snapshot_)
+      return recordSymbol(
+          codeBlock_->getRuntimeModule()->getSymbolIDMustExist(stringID),
+          stringID);
+    return resolvedSymbolID(stringID);
+  }
+
+  /// \return the symbol for the string \p stringID, which is created if
+  /// necessary.
+  SymbolID symbolIDMayAllocate(uint32_t stringID) {
+    if (!snapshot_)
+      return recordSymbol(
+          codeBlock_->getRuntimeModule()->getSymbolIDFromStringIDMayAllocate(
+              stringID),
+          stringID);
+    return resolvedSymbolID(stringID);
+  }
+
+  /// Remember that \p id is the symbol of \p stringID if the code may be
+  /// stored in the code cache, and \return \p id.
+  SymbolID recordSymbol(SymbolID id, uint32_t stringID) {
+    if (jc_.codeCache_)
+      symbolStringIDs_.try_emplace(id.unsafeGetRaw(), stringID);
+    return id;
+  }
+
+  /// \return the symbol for \p stringID that was resolved in advance.
+  SymbolID resolvedSymbolID(uint32_t stringID) {
+    auto it = snapshot_->symbols.find(stringID);
+    if (LLVM_UNLIKELY(it == snapshot_->symbols.end())) {
+      otherErrorMessage_ = "unresolved symbol";
+      error_ = Error::Other;
+      _sh_longjmp(errorJmpBuf_, 1);
+    }
+    return recordSymbol(it->second, stringID);
+  }
+
+  /// Store the code \p fn of the CodeBlock in the code cache, unless it
+  /// can't be loaded by another process.
+  void storeInCodeCache(JITCompiledFunctionPtr fn) {
+    JITCodeImage image{};
+    if (!em_.getCodeImage(fn, image))
+      return;
+    for (JITReloc &reloc : image.relocs) {
+      if (reloc.kind != JITRelocKind::SymbolID)
+        continue;
+      auto it = symbolStringIDs_.find((uint32_t)reloc.payload);
+      if (it == symbolStringIDs_.end())
+        return;
+      reloc.payload = it->second;
+    }
+    jc_.codeCache_->store(codeBlock_, jc_.codeCacheConfig(), image);
+  }
+
+  /// Compile the basic block with index \p bbIndex.
+  JIT_INLINE void compileBB(uint32_t bbIndex) {
+    uint32_t startOfs = basicBlocks_[bbIndex];
+    uint32_t endOfs = basicBlocks_[bbIndex + 1];
+    em_.newBasicBlock(bbLabels_[bbIndex]);
+    auto *ip = reinterpret_cast<const inst::Inst *>(funcStart_ + startOfs);
+    auto *to = reinterpret_cast<const inst::Inst *>(funcStart_ + endOfs);
+
+    while (ip != to) {
+      em_.emittingIP = ip;
+      uint32_t offset = (const char *)ip - funcStart_;
+      em_.speculateNumbers = speculate_ &&
+          !(offset < nonNumberSites_.size() && nonNumberSites_.test(offset));
+      forgetWrittenTypes(ip);
+      ip = dispatch(ip);
+      em_.assertPostInstructionInvariants();
+    }
+    em_.emittingIP = nullptr;
+  }
+
+  /// Tell the emitter that the registers written by the instruction at \p ip
+  /// may no longer contain numbers. The instruction itself records its result
+  /// type when it is emitted.
+  JIT_INLINE void forgetWrittenTypes(const inst::Inst *ip) {
+    switch (ip->opCode) {
+#define DEFINE_JUMP_1(name) \
+  case inst::OpCode::name:  \
+  case inst::OpCode::name##Long:
+#define DEFINE_JUMP_2(name) DEFINE_JUMP_1(name)
+#define DEFINE_JUMP_3(name) DEFINE_JUMP_1(name)
+#include "hermes/BCGen/HBC/BytecodeList.def"
+      case inst::OpCode::JmpTypeOfIs:
+      case inst::OpCode::SwitchImm:
+      case inst::OpCode::PutByIdLoose:
+      case inst::OpCode::PutByIdStrict:
+      case inst::OpCode::PutByIdLooseLong:
+      case inst::OpCode::PutByIdStrictLong:
+      case inst::OpCode::TryPutByIdLoose:
+      case inst::OpCode::TryPutByIdStrict:
+      case inst::OpCode::TryPutByIdLooseLong:
+      case inst::OpCode::TryPutByIdStrictLong:
+      case inst::OpCode::PutByValLoose:
+      case inst::OpCode::PutByValStrict:
+      case inst::OpCode::PutOwnBySlotIdx:
+      case inst::OpCode::PutOwnBySlotIdxLong:
+      case inst::OpCode::PutOwnNPBySlotIdx:
+      case inst::OpCode::PutOwnNPBySlotIdxLong:
+      case inst::OpCode::DefineOwnById:
+      case inst::OpCode::DefineOwnByIdLong:
+      case inst::OpCode::DefineOwnByIndex:
+      case inst::OpCode::DefineOwnByIndexL:
+      case inst::OpCode::DefineOwnByVal:
+      case inst::OpCode::StoreToEnvironment:
+      case inst::OpCode::StoreToEnvironmentL:
+      case inst::OpCode::StoreNPToEnvironment:
+      case inst::OpCode::StoreNPToEnvironmentL:
+      case inst::OpCode::FastArrayStore:
+      case inst::OpCode::FastArrayPush:
+      case inst::OpCode::FastArrayAppend:
+      case inst::OpCode::AsyncBreakCheck:
+      case inst::OpCode::ProfilePoint:
+      case inst::OpCode::Ret:
+      case inst::OpCode::Throw:
+        break;
+
+#define WRITES_OP1(name)                   \
+  case inst::OpCode::name:                 \
+    em_.forgetNumber(FR(ip->i##name.op1)); \
+    break;
+      WRITES_OP1(Mov)
+      WRITES_OP1(MovLong)
+      WRITES_OP1(LoadParam)
+      WRITES_OP1(LoadParamLong)
+      WRITES_OP1(LoadConstUInt8)
+      WRITES_OP1(LoadConstInt)
+      WRITES_OP1(LoadConstDouble)
+      WRITES_OP1(LoadConstString)
+      WRITES_OP1(LoadConstStringLongIndex)
+      WRITES_OP1(LoadConstEmpty)
+      WRITES_OP1(LoadConstUndefined)
+      WRITES_OP1(LoadConstNull)
+      WRITES_OP1(LoadConstTrue)
+      WRITES_OP1(LoadConstFalse)
+      WRITES_OP1(LoadConstZero)
+      WRITES_OP1(LoadThisNS)
+      WRITES_OP1(CoerceThisNS)
+      WRITES_OP1(ToNumber)
+      WRITES_OP1(ToNumeric)
+      WRITES_OP1(ToInt32)
+      WRITES_OP1(AddEmptyString)
+      WRITES_OP1(Negate)
+      WRITES_OP1(Not)
+      WRITES_OP1(BitNot)
+      WRITES_OP1(TypeOf)
+      WRITES_OP1(Eq)
+      WRITES_OP1(StrictEq)
+      WRITES_OP1(Neq)
+      WRITES_OP1(StrictNeq)
+      WRITES_OP1(Less)
+      WRITES_OP1(LessEq)
+      WRITES_OP1(Greater)
+      WRITES_OP1(GreaterEq)
+      WRITES_OP1(Add)
+      WRITES_OP1(AddN)
+      WRITES_OP1(AddS)
+      WRITES_OP1(Sub)
+      WRITES_OP1(SubN)
+      WRITES_OP1(Mul)
+      WRITES_OP1(MulN)
+      WRITES_OP1(Div)
+      WRITES_OP1(DivN)
+      WRITES_OP1(Mod)
+      WRITES_OP1(LShift)
+      WRITES_OP1(RShift)
+      WRITES_OP1(URshift)
+      WRITES_OP1(BitAnd)
+      WRITES_OP1(BitXor)
+      WRITES_OP1(BitOr)
+      WRITES_OP1(Inc)
+      WRITES_OP1(Dec)
+      WRITES_OP1(InstanceOf)
+      WRITES_OP1(IsIn)
+      WRITES_OP1(TypeOfIs)
+      WRITES_OP1(GetEnvironment)
+      WRITES_OP1(GetParentEnvironment)
+      WRITES_OP1(GetClosureEnvironment)
+      WRITES_OP1(LoadFromEnvironment)
+      WRITES_OP1(LoadFromEnvironmentL)
+      WRITES_OP1(GetGlobalObject)
+      WRITES_OP1(GetByIdShort)
+      WRITES_OP1(GetById)
+      WRITES_OP1(GetByIdLong)
+      WRITES_OP1(TryGetById)
+      WRITES_OP1(TryGetByIdLong)
+      WRITES_OP1(GetOwnBySlotIdx)
+      WRITES_OP1(GetOwnBySlotIdxLong)
+      WRITES_OP1(GetByVal)
+      WRITES_OP1(GetByIndex)
+      WRITES_OP1(FastArrayLoad)
+      WRITES_OP1(FastArrayLength)
+      WRITES_OP1(NewObject)
+      WRITES_OP1(NewArray)
+      WRITES_OP1(NewFastArray)
+      WRITES_OP1(CreateClosure)
+      WRITES_OP1(CreateClosureLongIndex)
+      WRITES_OP1(Call)
+      WRITES_OP1(Call1)
+      WRITES_OP1(Call2)
+      WRITES_OP1(Call3)
+      WRITES_OP1(Call4)
+      WRITES_OP1(Construct)
+      WRITES_OP1(CallBuiltin)
+      WRITES_OP1(CallBuiltinLong)
+#undef WRITES_OP1
+
+      default:
+        em_.forgetAllNumbers();
+        break;
+    }
+  }
+
+  /// Compile a single instruction by dispatching to its emitter method.
+  /// \return the instruction pointer for the next instruction.
+  JIT_INLINE const inst::Inst *dispatch(const inst::Inst *ip) {
+    switch (ip->opCode) {
+#define DEFINE_OPCODE(name)   \
+  case inst::OpCode::name:    \
+    emit##name(&ip->i##name); \
+    ip = NEXTINST(name);      \
+    break;
+#include "hermes/BCGen/HBC/BytecodeList.def"
+
+#undef DEFINE_OPCODE
+
+      case inst::OpCode::_last:
+      default:
+        hermes_fatal("Invalid opcode");
+    }
+    return ip;
+  }
+
+  /// Calculate the target branch offset relative to the current instruction
+  /// and return the AsmJit label associated with the BB starting at that
+  /// address.
+  ///
+  /// \param inst pointer to the start of he current instruction.
+  /// \param targetOfs offset of the branch targer relative to \p inst.
+  ///
+  /// \return the corresponding AsmJit label.
+  const asmjit::Label &bbLabelFromInst(const void *inst, int32_t targetOfs)
+      const {
+    uint32_t addr = (const char *)inst - funcStart_ + targetOfs;
+    auto bbIndexIt = ofsToBBIndex_.find(addr);
+    if (LLVM_UNLIKELY(bbIndexIt == ofsToBBIndex_.end())) {
+      llvh::errs() << "bbLabelFromInst: invalid addr "
+                   << llvh::format_hex(addr, 4) << "\n";
+      hermes_fatal("jit: invalid BB addr");
+    }
+    return bbLabels_[bbIndexIt->second];
+  }
+
+#define DEFINE_OPCODE(name) \
+  JIT_INLINE void emit##name(const inst::name##Inst *inst);
+#include "hermes/BCGen/HBC/BytecodeList.def"
+
+#undef DEFINE_OPCODE
+}; // class
+
+JITCompiledFunctionPtr JITContext::compileImpl(
+    Runtime &runtime,
+    CodeBlock *codeBlock) {
+  if (codeCache_ && !codeBlock->getJITCacheChecked()) {
+    if (auto fn = loadFromCodeCache(codeBlock))
+      return fn;
+  }
+
+  if (!compileQueue_) {
+    Compiler compiler(*this, codeBlock);
+    installCompiled(compiler.compileCodeBlock());
+    return codeBlock->getJITCompiled();
+  }
+
+  if (compileQueue_->hasResults()) {
+    std::vector<JITCompileResult> results{};
+    compileQueue_->takeResults(results);
+    for (const JITCompileResult &res : results)
+      installCompiled(res);
+    if (auto fn = codeBlock->getJITCompiled())
+      return fn;
+  }
+  // Keep interpreting while the code is being compiled.
+  if (enabled_ && !codeBlock->getJITQueued() && !codeBlock->getDontJIT()) {
+    codeBlock->setJITQueued(true);
+    compileQueue_->enqueue(codeBlock);
+  }
+  return nullptr;
+}
+
+void JITContext::installCompiled(const JITCompileResult &res) {
+  CodeBlock *codeBlock = res.codeBlock;
+  codeBlock->setJITQueued(false);
+  if (res.fn) {
+    codeBlock->setJITOSREntry(res.osrEntry);
+    codeBlock->setJITCompiled(res.fn);
+  } else if (!res.memoryLimitReached) {
+    codeBlock->setDontJIT(true);
+  }
+  if (LLVM_UNLIKELY(res.memoryLimitReached)) {
+    // Disable the JIT if we would go over the memory limit.
+    // The enabled_ check in the inline path remains fast,
+    // and the chances that someone else will reenable it are low.
+    // This does mean that if we are unable to JIT a large function,
+    // we won't potentially be able to JIT smaller functions later.
+    enabled_ = false;
+  }
+}
+
+JITCompiledFunctionPtr JITContext::loadFromCodeCache(CodeBlock *codeBlock) {
+  codeBlock->setJITCacheChecked();
+  JITCodeImage image{};
+  if (!codeCache_->load(codeBlock, codeCacheConfig(), image))
+    return nullptr;
+
+  // If the code doesn't fit, let the compiler report the memory limit.
+  size_t codeSize = image.code.size();
+  if (impl_->jr.allocator()->statistics().usedSize() + codeSize >
+      memoryLimit_) {
+    return nullptr;
+  }
+
+  // The relocations have been patched, and everything else in the code is
+  // position independent.
+  asmjit::CodeHolder code{};
+  code.init(impl_->jr.environment(), impl_->jr.cpuFeatures());
+  asmjit::x86::Assembler a{&code};
+  JITCompiledFunctionPtr fn;
+  if (a.embed(image.code.data(), codeSize) || impl_->jr.add(&fn, &code))
+    return nullptr;
+
+  JITCompileResult res{codeBlock};
+  res.fn = fn;
+  if (image.osrEntryOffset != JITCodeImage::kNoOSREntry) {
+    res.osrEntry = reinterpret_cast<JITCompiledFunctionPtr>(
+        reinterpret_cast<uintptr_t>(fn) + image.osrEntryOffset);
+  }
+  if (LLVM_UNLIKELY(perfMapMode_ != JITPerfMapMode::None))
+    perfMapAddCode(perfMapMode_, codeBlock, (const void *)fn, codeSize);
+  if (dumpJITCode_ & (DumpJitCode::Code | DumpJitCode::CompileStatus)) {
+    llvh::outs() << "JIT loaded FunctionID " << codeBlock->getFunctionID()
+                 << ", '" << codeBlock->getNameString()
+                 << "' from the code cache\n";
+  }
+  installCompiled(res);
+  return fn;
+}
+
+uint32_t JITContext::codeCacheConfig() const {
+  return (dumpJITCode_ & (DumpJitCode::BRK | DumpJitCode::EntryExit)) |
+      (emitAsserts_ ? 0x100 : 0);
+}
+
+void JITContext::setCodeCacheDir(const std::string &dir) {
+  if (dir.empty())
+    codeCache_.reset();
+  else if (impl_)
+    codeCache_ = std::make_unique<JITCodeCache>(dir);
+}
+
+void JITContext::deoptimize(CodeBlock *codeBlock) {
+  if (dumpJITCode_ & (DumpJitCode::Code | DumpJitCode::CompileStatus)) {
+    llvh::outs() << "JIT deoptimized FunctionID " << codeBlock->getFunctionID()
+                 << ", '" << codeBlock->getNameString() << "'\n";
+  }
+  // The code is not freed: it may still be running in other frames of the
+  // function.
+  codeBlock->setJITCompiled(nullptr);
+  codeBlock->setJITOSREntry(nullptr);
+  codeBlock->incrementDeoptCount();
+}
+
+void JITContext::setAsyncCompile(bool async) {
+  if (!async) {
+    compileQueue_.reset();
+    return;
+  }
+  if (!compileQueue_ && impl_) {
+    compileQueue_ = std::make_unique<JITCompileQueue>(
+        [this](CodeBlock *codeBlock, const JITCompileSnapshot &snapshot) {
+          Compiler compiler(*this, codeBlock, &snapshot);
+          return compiler.compileCodeBlock();
+        });
+  }
+}
+
+JITCompileQueueStats JITContext::getCompileQueueStats() {
+  return compileQueue_ ? compileQueue_->getStats() : JITCompileQueueStats{};
+}
+
+void JITContext::cancelCompilation(RuntimeModule *runtimeModule) {
+  if (compileQueue_)
+    compileQueue_->cancel(runtimeModule);
+}
+
+JITCompileResult JITContext::Compiler::compileCodeBlock() {
+  if (_sh_setjmp(errorJmpBuf_) == 0) {
+    return compileCodeBlockImpl();
+  } else {
+    // We arrive here on error.
+
+    const char *errMsg = error_ == Error::UnsupportedInst
+        ? "unsupported instruction"
+        : otherErrorMessage_.c_str();
+    auto printError = [this, errMsg](llvh::raw_ostream &OS) {
+      OS << "jit error: " << errMsg << '\n';
+      if (em_.emittingIP) {
+        OS << "Emitting:\n";
+        OS << llvh::format_decimal(
+                  (const char *)em_.emittingIP - (const char *)funcStart_, 3)
+           << ": " << inst::decodeInstruction(em_.emittingIP) << "\n";
+      }
+    };
+
+    if (jc_.crashOnError_) {
+      printError(llvh::errs());
+      hermes_fatal(errMsg);
+    } else {
+      if (jc_.dumpJITCode_ &
+          (DumpJitCode::Code | DumpJitCode::CompileStatus |
+           DumpJitCode::InstErr)) {
+        printError(llvh::outs());
+      } else {
+        LLVM_DEBUG(printError(llvh::outs()));
+      }
+    }
+
+    return JITCompileResult{codeBlock_};
+  }
+}
+
+JITCompileResult JITContext::Compiler::compileCodeBlockImpl() {
+  if (jc_.dumpJITCode_ & (DumpJitCode::Code | DumpJitCode::CompileStatus)) {
+    funcName_ = codeBlock_->getNameString();
+    llvh::outs() << "\nJIT compilation of FunctionID "
+                 << codeBlock_->getFunctionID() << ", '" << funcName_ << "'\n";
+  }
+
+  discoverBasicBlocks(codeBlock_, basicBlocks_, ofsToBBIndex_, &loopHeaders_);
+
+  if ((jc_.dumpJITCode_ & DumpJitCode::Code) && !funcName_.empty())
+    llvh::outs() << "\n" << funcName_ << ":\n";
+
+  bbLabels_.reserve(basicBlocks_.size() - 1);
+  for (unsigned bbIndex = 0, e = basicBlocks_.size() - 1; bbIndex < e;
+       ++bbIndex) {
+    bbLabels_.push_back(em_.newPrefLabel("BB", bbIndex));
+  }
+
+  // Any code emitted at the start gets treated as the first instruction.
+  em_.emittingIP = (const inst::Inst *)codeBlock_->begin();
+  em_.enter(
+      codeBlock_->getFunctionHeader().getNumberRegCount(),
+      codeBlock_->getFunctionHeader().getNonPtrRegCount());
+
+  for (uint32_t bbIndex = 0, e = basicBlocks_.size() - 1; bbIndex < e;
+       ++bbIndex) {
+    compileBB(bbIndex);
+  }
+
+  auto excTable =
+      codeBlock_->getRuntimeModule()->getBytecode()->getExceptionTable(
+          codeBlock_->getFunctionID());
+  llvh::SmallVector<const asmjit::Label *, 4> handlers{};
+  handlers.reserve(excTable.size());
+  for (const auto &entry : excTable) {
+    handlers.push_back(&bbLabels_.at(ofsToBBIndex_.at(entry.target)));
+  }
+
+  llvh::SmallVector<Emitter::OSRTarget, 4> osrTargets{};
+  osrTargets.reserve(loopHeaders_.size());
+  for (uint32_t ofs : loopHeaders_) {
+    osrTargets.push_back(
+        {(const inst::Inst *)(funcStart_ + ofs),
+         &bbLabels_.at(ofsToBBIndex_.at(ofs))});
+  }
+
+  // Emit the leave before getting the codeSize so the measurement is accurate.
+  em_.leave(handlers, osrTargets);
+
+  size_t memoryLimit = jc_.memoryLimit_;
+  size_t codeSize = em_.code.codeSize();
+  size_t usedSize =
+      jc_.impl_->jr.allocator()->statistics().usedSize() + codeSize;
+
+  JITCompileResult res{codeBlock_};
+  if (LLVM_UNLIKELY(usedSize > memoryLimit)) {
+    // The JIT will be disabled when the result is installed.
+    res.memoryLimitReached = true;
+    return res;
+  }
+
+  res.fn = em_.addToRuntime(jc_.impl_->jr);
+  res.osrEntry = em_.getOSREntry(res.fn);
+  if (LLVM_UNLIKELY(jc_.perfMapMode_ != JITPerfMapMode::None))
+    perfMapAddCode(
+        jc_.perfMapMode_, codeBlock_, (const void *)res.fn, codeSize);
+  if (jc_.codeCache_)
+    storeInCodeCache(res.fn);
+
+  // Disable compilation for the future if we've hit the limit, but this
+  // function is fine.
+  res.memoryLimitReached = usedSize == memoryLimit;
+
+  LLVM_DEBUG(
+      llvh::outs() << "\n Bytecode:";
+      for (unsigned bbIndex = 0; bbIndex < basicBlocks_.size() - 1; ++bbIndex) {
+        uint32_t startOfs = basicBlocks_[bbIndex];
+        uint32_t endOfs = basicBlocks_[bbIndex + 1];
+        llvh::outs() << "BB" << bbIndex << ":\n";
+        auto *ip = funcStart_ + startOfs;
+        auto *to = funcStart_ + endOfs;
+        while (ip != to) {
+          auto di = inst::decodeInstruction((const inst::Inst *)ip);
+          llvh::outs() << "    " << llvh::format_decimal(ip - funcStart_, 3)
+                       << ": " << di << "\n";
+          ip += di.meta.size;
+        }
+      });
+
+  if (jc_.dumpJITCode_ & (DumpJitCode::Code | DumpJitCode::CompileStatus)) {
+    llvh::outs() << "\nJIT total memory usage (bytes): " << usedSize << "\n";
+    llvh::outs() << "JIT successfully compiled FunctionID "
+                 << codeBlock_->getFunctionID() << ", '" << funcName_ << "'\n";
+  }
+
+  return res;
+}
+
+#define EMIT_UNIMPLEMENTED(name)                                               \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    error_ = Error::UnsupportedInst;                                           \
+    _sh_longjmp(errorJmpBuf_, 1);                                              \
+  }
+
+EMIT_UNIMPLEMENTED(DirectEval)
+EMIT_UNIMPLEMENTED(AsyncBreakCheck)
+
+#undef EMIT_UNIMPLEMENTED
+
+inline void JITContext::Compiler::emitUnreachable(
+    const inst::UnreachableInst *inst) {
+  em_.unreachable();
+}
+
+inline void JITContext::Compiler::emitProfilePoint(
+    const inst::ProfilePointInst *inst) {
+  em_.profilePoint(inst->op1);
+}
+
+inline void JITContext::Compiler::emitLoadParam(
+    const inst::LoadParamInst *inst) {
+  em_.loadParam(FR(inst->op1), inst->op2);
+}
+inline void JITContext::Compiler::emitLoadParamLong(
+    const inst::LoadParamLongInst *inst) {
+  em_.loadParam(FR(inst->op1), inst->op2);
+}
+
+inline void JITContext::Compiler::emitLoadConstZero(
+    const inst::LoadConstZeroInst *inst) {
+  em_.loadConstDouble(FR(inst->op1), 0, "Zero");
+}
+
+inline void JITContext::Compiler::emitLoadConstUInt8(
+    const inst::LoadConstUInt8Inst *inst) {
+  em_.loadConstDouble(FR(inst->op1), inst->op2, "UInt8");
+}
+
+inline void JITContext::Compiler::emitLoadConstInt(
+    const inst::LoadConstIntInst *inst) {
+  em_.loadConstDouble(FR(inst->op1), inst->op2, "Int");
+}
+
+inline void JITContext::Compiler::emitLoadConstDouble(
+    const inst::LoadConstDoubleInst *inst) {
+  em_.loadConstDouble(FR(inst->op1), inst->op2, "Double");
+}
+
+#define EMIT_LOAD_CONST(NAME, val)                        \
+  inline void JITContext::Compiler::emitLoadConst##NAME(  \
+      const inst::LoadConst##NAME##Inst *inst) {          \
+    em_.loadConstBits64(FR(inst->op1), val, #NAME);       \
+  }
+
+EMIT_LOAD_CONST(Empty, _sh_ljs_empty().raw);
+EMIT_LOAD_CONST(Undefined, _sh_ljs_undefined().raw);
+EMIT_LOAD_CONST(Null, _sh_ljs_null().raw);
+EMIT_LOAD_CONST(True, _sh_ljs_bool(true).raw);
+EMIT_LOAD_CONST(False, _sh_ljs_bool(false).raw);
+
+#undef EMIT_LOAD_CONST
+
+inline void JITContext::Compiler::emitLoadConstString(
+    const inst::LoadConstStringInst *inst) {
+  em_.loadConstString(FR(inst->op1), codeBlock_->getRuntimeModule(), inst->op2);
+}
+
+#define EMIT_LOAD_CONST_BIGINT(name)                                           \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.loadConstBigInt(                                                       \
+        FR(inst->op1), codeBlock_->getRuntimeModule(), inst->op2);             \
+  }
+
+EMIT_LOAD_CONST_BIGINT(LoadConstBigInt);
+EMIT_LOAD_CONST_BIGINT(LoadConstBigIntLongIndex);
+
+#undef EMIT_LOAD_CONST_BIGINT
+
+inline void JITContext::Compiler::emitLoadConstStringLongIndex(
+    const inst::LoadConstStringLongIndexInst *inst) {
+  em_.loadConstString(FR(inst->op1), codeBlock_->getRuntimeModule(), inst->op2);
+}
+
+inline void JITContext::Compiler::emitMov(const inst::MovInst *inst) {
+  em_.mov(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitMovLong(const inst::MovLongInst *inst) {
+  em_.mov(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitCacheNewObject(
+    const inst::CacheNewObjectInst *inst) {
+  // TODO: Implement CacheNewObject.
+}
+
+inline void JITContext::Compiler::emitToNumber(const inst::ToNumberInst *inst) {
+  em_.toNumber(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitToNumeric(
+    const inst::ToNumericInst *inst) {
+  em_.toNumeric(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitToInt32(const inst::ToInt32Inst *inst) {
+  em_.toInt32(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitAddEmptyString(
+    const inst::AddEmptyStringInst *inst) {
+  em_.addEmptyString(FR(inst->op1), FR(inst->op2));
+}
+#define EMIT_BINARY_OP(NAME, op)                                               \
+  inline void JITContext::Compiler::emit##NAME(const inst::NAME##Inst *inst) { \
+    em_.op(FR(inst->op1), FR(inst->op2), FR(inst->op3));                       \
+  }
+
+EMIT_BINARY_OP(Greater, greater)
+EMIT_BINARY_OP(Less, less)
+EMIT_BINARY_OP(Eq, equal)
+EMIT_BINARY_OP(Neq, notEqual)
+EMIT_BINARY_OP(StrictEq, strictEqual)
+EMIT_BINARY_OP(StrictNeq, strictNotEqual)
+
+EMIT_BINARY_OP(GreaterEq, greaterEqual)
+EMIT_BINARY_OP(LessEq, lessEqual)
+
+EMIT_BINARY_OP(Add, add)
+EMIT_BINARY_OP(AddN, addN)
+EMIT_BINARY_OP(Sub, sub)
+EMIT_BINARY_OP(SubN, subN)
+EMIT_BINARY_OP(Mul, mul)
+EMIT_BINARY_OP(MulN, mulN)
+EMIT_BINARY_OP(Div, div)
+EMIT_BINARY_OP(DivN, divN)
+EMIT_BINARY_OP(BitAnd, bitAnd)
+EMIT_BINARY_OP(BitOr, bitOr)
+EMIT_BINARY_OP(BitXor, bitXor)
+EMIT_BINARY_OP(LShift, lShift)
+EMIT_BINARY_OP(RShift, rShift)
+EMIT_BINARY_OP(URshift, urShift)
+
+#undef EMIT_BINARY_OP
+inline void JITContext::Compiler::emitMod(const inst::ModInst *inst) {
+  em_.mod(false, FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+#define EMIT_UNARY_OP(NAME, op)                                                \
+  inline void JITContext::Compiler::emit##NAME(const inst::NAME##Inst *inst) { \
+    em_.op(FR(inst->op1), FR(inst->op2));                                      \
+  }
+
+EMIT_UNARY_OP(Inc, inc)
+EMIT_UNARY_OP(Dec, dec)
+EMIT_UNARY_OP(Not, booleanNot)
+EMIT_UNARY_OP(BitNot, bitNot)
+EMIT_UNARY_OP(Negate, negate)
+EMIT_UNARY_OP(TypeOf, typeOf)
+
+#undef EMIT_UNARY_OP
+
+#define EMIT_JCOND(name, impl, invert)                                         \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.impl(                                                                  \
+        invert,                                                                \
+        bbLabelFromInst(inst, inst->op1),                                      \
+        FR(inst->op2),                                                         \
+        FR(inst->op3));                                                        \
+  }                                                                            \
+  inline void JITContext::Compiler::emit##name##Long(                          \
+      const inst::name##LongInst *inst) {                                      \
+    em_.impl(                                                                  \
+        invert,                                                                \
+        bbLabelFromInst(inst, inst->op1),                                      \
+        FR(inst->op2),                                                         \
+        FR(inst->op3));                                                        \
+  }
+
+EMIT_JCOND(JLessEqual, jLessEqual, false)
+EMIT_JCOND(JLessEqualN, jLessEqualN, false)
+EMIT_JCOND(JNotLessEqual, jLessEqual, true)
+EMIT_JCOND(JNotLessEqualN, jLessEqualN, true)
+EMIT_JCOND(JLess, jLess, false)
+EMIT_JCOND(JLessN, jLessN, false)
+EMIT_JCOND(JNotLess, jLess, true)
+EMIT_JCOND(JNotLessN, jLessN, true)
+EMIT_JCOND(JGreaterEqual, jGreaterEqual, false)
+EMIT_JCOND(JNotGreaterEqual, jGreaterEqual, true)
+EMIT_JCOND(JGreater, jGreater, false)
+EMIT_JCOND(JNotGreater, jGreater, true)
+EMIT_JCOND(JEqual, jEqual, false)
+EMIT_JCOND(JNotEqual, jEqual, true)
+EMIT_JCOND(JStrictEqual, jStrictEqual, false)
+EMIT_JCOND(JStrictNotEqual, jStrictEqual, true)
+
+#undef EMIT_JCOND
+
+#define EMIT_JMP_TRUE_FALSE(name, onTrue)                                      \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.jmpTrueFalse(onTrue, bbLabelFromInst(inst, inst->op1), FR(inst->op2)); \
+  }                                                                            \
+  inline void JITContext::Compiler::emit##name##Long(                          \
+      const inst::name##LongInst *inst) {                                      \
+    em_.jmpTrueFalse(onTrue, bbLabelFromInst(inst, inst->op1), FR(inst->op2)); \
+  }
+
+EMIT_JMP_TRUE_FALSE(JmpTrue, true)
+EMIT_JMP_TRUE_FALSE(JmpFalse, false)
+#undef EMIT_JMP_TRUE_FALSE
+inline void JITContext::Compiler::emitJmpUndefined(
+    const inst::JmpUndefinedInst *inst) {
+  em_.jmpUndefined(bbLabelFromInst(inst, inst->op1), FR(inst->op2));
+}
+inline void JITContext::Compiler::emitJmpUndefinedLong(
+    const inst::JmpUndefinedLongInst *inst) {
+  em_.jmpUndefined(bbLabelFromInst(inst, inst->op1), FR(inst->op2));
+}
+
+#define EMIT_JMP_NO_COND(name)                                                 \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.jmp(bbLabelFromInst(inst, inst->op1));                                 \
+  }                                                                            \
+  inline void JITContext::Compiler::emit##name##Long(                          \
+      const inst::name##LongInst *inst) {                                      \
+    em_.jmp(bbLabelFromInst(inst, inst->op1));                                 \
+  }
+
+EMIT_JMP_NO_COND(Jmp)
+
+#undef EMIT_JMP_NO_COND
+
+inline void JITContext::Compiler::emitJmpTypeOfIs(
+    const inst::JmpTypeOfIsInst *inst) {
+  em_.jmpTypeOfIs(
+      bbLabelFromInst(inst, inst->op1),
+      FR(inst->op2),
+      TypeOfIsTypes(inst->op3));
+}
+
+inline void JITContext::Compiler::emitTypeOfIs(const inst::TypeOfIsInst *inst) {
+  em_.typeOfIs(FR(inst->op1), FR(inst->op2), TypeOfIsTypes(inst->op3));
+}
+
+#define EMIT_JMP_BUILTIN_IS(name, invert)                                      \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.jmpBuiltinIs(                                                          \
+        invert,                                                                \
+        bbLabelFromInst(inst, inst->op1),                                      \
+        /* builtinIdx */ inst->op2,                                            \
+        FR(inst->op3));                                                        \
+  }
+
+EMIT_JMP_BUILTIN_IS(JmpBuiltinIs, false)
+EMIT_JMP_BUILTIN_IS(JmpBuiltinIsLong, false)
+EMIT_JMP_BUILTIN_IS(JmpBuiltinIsNot, true)
+EMIT_JMP_BUILTIN_IS(JmpBuiltinIsNotLong, true)
+
+#undef EMIT_JMP_BUILTIN_IS
+
+inline void JITContext::Compiler::emitSwitchImm(
+    const inst::SwitchImmInst *inst) {
+  uint32_t min = inst->op4;
+  uint32_t max = inst->op5;
+  // Max is inclusive, so add 1 to get the number of entries.
+  uint32_t entries = max - min + 1;
+
+  // Calculate the offset into the bytecode where the jump table for
+  // this SwitchImm starts.
+  const uint8_t *tablestart = (const uint8_t *)llvh::alignAddr(
+      (const uint8_t *)inst + inst->op2, sizeof(uint32_t));
+
+  std::vector<const asmjit::Label *> jumpTableLabels{};
+  jumpTableLabels.reserve(entries);
+
+  // Add a label for each offset in the table.
+  for (uint32_t i = 0; i < entries; ++i) {
+    const int32_t *loc = (const int32_t *)tablestart + i;
+    int32_t offset = *loc;
+    jumpTableLabels.push_back(&bbLabelFromInst(inst, offset));
+  }
+
+  em_.switchImm(
+      FR(inst->op1),
+      bbLabelFromInst(inst, inst->op3),
+      jumpTableLabels,
+      min,
+      max);
+}
+
+inline void JITContext::Compiler::emitTryGetByIdLong(
+    const inst::TryGetByIdLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryGetById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryGetById(
+    const inst::TryGetByIdInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryGetById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdLong(
+    const inst::GetByIdLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.getById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetById(const inst::GetByIdInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.getById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdShort(
+    const inst::GetByIdShortInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.getById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdParam(
+    const inst::GetByIdParamInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.loadParam(FR(inst->op1), inst->op2);
+  em_.getById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdGlobal(
+    const inst::GetByIdGlobalInst *inst) {
+  auto idVal = ID(inst->op3);
+  auto cacheIdx = inst->op2;
+  em_.getGlobalObject(FR(inst->op1));
+  em_.getById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryGetByIdGlobal(
+    const inst::TryGetByIdGlobalInst *inst) {
+  auto idVal = ID(inst->op3);
+  auto cacheIdx = inst->op2;
+  em_.getGlobalObject(FR(inst->op1));
+  em_.tryGetById(FR(inst->op1), idVal, FR(inst->op1), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByIdWithReceiverLong(
+    const inst::GetByIdWithReceiverLongInst *inst) {
+  auto idVal = ID(inst->op5);
+  auto cacheIdx = inst->op3;
+  em_.getByIdWithReceiver(
+      FR(inst->op1), idVal, FR(inst->op2), FR(inst->op4), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitGetByValWithReceiver(
+    const inst::GetByValWithReceiverInst *inst) {
+  em_.getByValWithReceiver(
+      FR(inst->op1), FR(inst->op2), FR(inst->op3), FR(inst->op4));
+}
+
+inline void JITContext::Compiler::emitTryPutByIdLooseLong(
+    const inst::TryPutByIdLooseLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryPutByIdLoose(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryPutByIdLoose(
+    const inst::TryPutByIdLooseInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryPutByIdLoose(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryPutByIdStrictLong(
+    const inst::TryPutByIdStrictLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryPutByIdStrict(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitTryPutByIdStrict(
+    const inst::TryPutByIdStrictInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.tryPutByIdStrict(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitPutByIdLooseLong(
+    const inst::PutByIdLooseLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.putByIdLoose(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitPutByIdLoose(
+    const inst::PutByIdLooseInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.putByIdLoose(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitPutByIdStrictLong(
+    const inst::PutByIdStrictLongInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.putByIdStrict(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitPutByIdStrict(
+    const inst::PutByIdStrictInst *inst) {
+  auto idVal = ID(inst->op4);
+  auto cacheIdx = inst->op3;
+  em_.putByIdStrict(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);
+}
+
+#define EMIT_BY_VAL(name, op)                                                  \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.op(FR(inst->op1), FR(inst->op2), FR(inst->op3));                       \
+  }
+
+EMIT_BY_VAL(GetByVal, getByVal)
+EMIT_BY_VAL(PutByValLoose, putByValLoose)
+EMIT_BY_VAL(PutByValStrict, putByValStrict)
+
+#undef EMIT_BY_VAL
+
+inline void JITContext::Compiler::emitPutByValWithReceiver(
+    const inst::PutByValWithReceiverInst *inst) {
+  em_.putByValWithReceiver(
+      FR(inst->op1),
+      FR(inst->op2),
+      FR(inst->op3),
+      FR(inst->op4),
+      (bool)inst->op5);
+}
+
+inline void JITContext::Compiler::emitDelByVal(const inst::DelByValInst *inst) {
+  em_.delByVal(FR(inst->op1), FR(inst->op2), FR(inst->op3), inst->op4);
+}
+
+inline void JITContext::Compiler::emitGetByIndex(
+    const inst::GetByIndexInst *inst) {
+  em_.getByIndex(FR(inst->op1), FR(inst->op2), inst->op3);
+}
+
+#define EMIT_DEFINE_BY_ID(op)                                              \
+  inline void JITContext::Compiler::emit##op(const inst::op##Inst *inst) { \
+    auto idVal = ID(inst->op4);                                            \
+    auto cacheIdx = inst->op3;                                             \
+    em_.defineOwnById(FR(inst->op1), idVal, FR(inst->op2), cacheIdx);      \
+  }
+EMIT_DEFINE_BY_ID(DefineOwnById)
+EMIT_DEFINE_BY_ID(DefineOwnByIdLong)
+#undef EMIT_DEFINE_BY_ID
+
+inline void JITContext::Compiler::emitDefineOwnByIndex(
+    const inst::DefineOwnByIndexInst *inst) {
+  em_.defineOwnByIndex(FR(inst->op1), FR(inst->op2), inst->op3);
+}
+
+inline void JITContext::Compiler::emitDefineOwnByIndexL(
+    const inst::DefineOwnByIndexLInst *inst) {
+  em_.defineOwnByIndex(FR(inst->op1), FR(inst->op2), inst->op3);
+}
+
+inline void JITContext::Compiler::emitDefineOwnByVal(
+    const inst::DefineOwnByValInst *inst) {
+  em_.defineOwnByVal(
+      FR(inst->op1), FR(inst->op2), FR(inst->op3), (bool)inst->op4);
+}
+
+inline void JITContext::Compiler::emitDefineOwnGetterSetterByVal(
+    const inst::DefineOwnGetterSetterByValInst *inst) {
+  em_.defineOwnGetterSetterByVal(
+      FR(inst->op1),
+      FR(inst->op2),
+      FR(inst->op3),
+      FR(inst->op4),
+      (bool)inst->op5);
+}
+
+#define EMIT_OWN_BY_SLOT_IDX(name, op)                                         \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.op(FR(inst->op1), FR(inst->op2), inst->op3);                           \
+  }                                                                            \
+  inline void JITContext::Compiler::emit##name##Long(                          \
+      const inst::name##LongInst *inst) {                                      \
+    em_.op(FR(inst->op1), FR(inst->op2), inst->op3);                           \
+  }
+
+EMIT_OWN_BY_SLOT_IDX(PutOwnBySlotIdx, putOwnBySlotIdx)
+EMIT_OWN_BY_SLOT_IDX(PutOwnNPBySlotIdx, putOwnBySlotIdx)
+EMIT_OWN_BY_SLOT_IDX(GetOwnBySlotIdx, getOwnBySlotIdx)
+
+#undef EMIT_OWN_BY_SLOT_IDX
+
+inline void JITContext::Compiler::emitLoadParentNoTraps(
+    const inst::LoadParentNoTrapsInst *inst) {
+  em_.loadParentNoTraps(FR(inst->op1), FR(inst->op2));
+}
+inline void JITContext::Compiler::emitTypedLoadParent(
+    const inst::TypedLoadParentInst *inst) {
+  em_.typedLoadParent(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitTypedStoreParent(
+    const inst::TypedStoreParentInst *inst) {
+  em_.typedStoreParent(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitRet(const inst::RetInst *inst) {
+  em_.ret(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitCatch(const inst::CatchInst *inst) {
+  em_.catchInst(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitGetGlobalObject(
+    const inst::GetGlobalObjectInst *inst) {
+  em_.getGlobalObject(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitInstanceOf(
+    const inst::InstanceOfInst *inst) {
+  em_.instanceOf(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+inline void JITContext::Compiler::emitIsIn(const inst::IsInInst *inst) {
+  em_.isIn(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+inline void JITContext::Compiler::emitCall(const inst::CallInst *inst) {
+  em_.call(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* argc */ inst->op3);
+}
+
+inline void JITContext::Compiler::emitCall1(const inst::Call1Inst *inst) {
+  em_.callN(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* args */ {FR(inst->op3)});
+}
+
+inline void JITContext::Compiler::emitCall2(const inst::Call2Inst *inst) {
+  em_.callN(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* args */ {FR(inst->op3), FR(inst->op4)});
+}
+
+inline void JITContext::Compiler::emitCall3(const inst::Call3Inst *inst) {
+  em_.callN(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* args */
+      {FR(inst->op3), FR(inst->op4), FR(inst->op5)});
+}
+
+inline void JITContext::Compiler::emitCall4(const inst::Call4Inst *inst) {
+  em_.callN(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* args */
+      {FR(inst->op3), FR(inst->op4), FR(inst->op5), FR(inst->op6)});
+}
+
+inline void JITContext::Compiler::emitConstruct(
+    const inst::ConstructInst *inst) {
+  em_.callWithNewTarget(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* newTarget */ FR(inst->op2),
+      /* argc */ inst->op3);
+}
+
+inline void JITContext::Compiler::emitCallBuiltin(
+    const inst::CallBuiltinInst *inst) {
+  em_.callBuiltin(
+      FR(inst->op1),
+      /* builtinIndex */ inst->op2,
+      /* argc */ inst->op3);
+}
+inline void JITContext::Compiler::emitCallBuiltinLong(
+    const inst::CallBuiltinLongInst *inst) {
+  em_.callBuiltin(
+      FR(inst->op1),
+      /* builtinIndex */ inst->op2,
+      /* argc */ inst->op3);
+}
+
+inline void JITContext::Compiler::emitCallWithNewTarget(
+    const inst::CallWithNewTargetInst *inst) {
+  em_.callWithNewTarget(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* newTarget */ FR(inst->op3),
+      /* argc */ inst->op4);
+}
+
+inline void JITContext::Compiler::emitCallWithNewTargetLong(
+    const inst::CallWithNewTargetLongInst *inst) {
+  em_.callWithNewTargetLong(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* newTarget */ FR(inst->op3),
+      /* argc */ FR(inst->op4));
+}
+
+inline void JITContext::Compiler::emitCallRequire(
+    const inst::CallRequireInst *inst) {
+  em_.callRequire(
+      FR(inst->op1),
+      /* callee */ FR(inst->op2),
+      /* modIndex */ inst->op3);
+}
+
+inline void JITContext::Compiler::emitGetBuiltinClosure(
+    const inst::GetBuiltinClosureInst *inst) {
+  em_.getBuiltinClosure(
+      FR(inst->op1),
+      /* builtinIndex */ inst->op2);
+}
+
+inline void JITContext::Compiler::emitDeclareGlobalVar(
+    const inst::DeclareGlobalVarInst *inst) {
+  em_.declareGlobalVar(ID(inst->op1));
+}
+
+inline void JITContext::Compiler::emitCreateTopLevelEnvironment(
+    const inst::CreateTopLevelEnvironmentInst *inst) {
+  em_.createTopLevelEnvironment(FR(inst->op1), inst->op2);
+}
+
+inline void JITContext::Compiler::emitCreateFunctionEnvironment(
+    const inst::CreateFunctionEnvironmentInst *inst) {
+  em_.createFunctionEnvironment(FR(inst->op1), inst->op2);
+}
+
+inline void JITContext::Compiler::emitCreateEnvironment(
+    const inst::CreateEnvironmentInst *inst) {
+  em_.createEnvironment(FR(inst->op1), FR(inst->op2), inst->op3);
+}
+
+inline void JITContext::Compiler::emitGetParentEnvironment(
+    const inst::GetParentEnvironmentInst *inst) {
+  em_.getParentEnvironment(FR(inst->op1), inst->op2);
+}
+
+inline void JITContext::Compiler::emitGetEnvironment(
+    const inst::GetEnvironmentInst *inst) {
+  em_.getEnvironment(FR(inst->op1), FR(inst->op2), inst->op3);
+}
+
+inline void JITContext::Compiler::emitGetClosureEnvironment(
+    const inst::GetClosureEnvironmentInst *inst) {
+  em_.getClosureEnvironment(FR(inst->op1), FR(inst->op2));
+}
+
+#define EMIT_LOAD_FROM_ENV(name)                                               \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.loadFromEnvironment(FR(inst->op1), FR(inst->op2), inst->op3);          \
+  }
+
+EMIT_LOAD_FROM_ENV(LoadFromEnvironment)
+EMIT_LOAD_FROM_ENV(LoadFromEnvironmentL)
+
+#undef EMIT_LOAD_FROM_ENV
+
+#define EMIT_STORE_TO_ENV(name, np)                                            \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.storeToEnvironment(np, FR(inst->op1), inst->op2, FR(inst->op3));       \
+  }
+
+EMIT_STORE_TO_ENV(StoreToEnvironment, false)
+EMIT_STORE_TO_ENV(StoreToEnvironmentL, false)
+EMIT_STORE_TO_ENV(StoreNPToEnvironment, true)
+EMIT_STORE_TO_ENV(StoreNPToEnvironmentL, true)
+
+#undef EMIT_STORE_TO_ENV
+
+#define EMIT_CREATE_CLOSURE(name)                                              \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.createClosure(                                                         \
+        FR(inst->op1),                                                         \
+        FR(inst->op2),                                                         \
+        codeBlock_->getRuntimeModule(),                                        \
+        inst->op3);                                                            \
+  }
+
+EMIT_CREATE_CLOSURE(CreateClosure)
+EMIT_CREATE_CLOSURE(CreateClosureLongIndex)
+
+#undef EMIT_CREATE_CLOSURE
+
+#define EMIT_CREATE_BASE_CLASS(name)                                           \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.createBaseClass(FR(inst->op1), FR(inst->op2), FR(inst->op3));          \
+  }
+EMIT_CREATE_BASE_CLASS(CreateBaseClass)
+EMIT_CREATE_BASE_CLASS(CreateBaseClassLongIndex)
+#undef EMIT_CREATE_BASE_CLASS
+
+#define EMIT_CREATE_DERIVED_CLASS(name)                                        \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.createDerivedClass(                                                    \
+        FR(inst->op1), FR(inst->op2), FR(inst->op3), FR(inst->op4));           \
+  }
+EMIT_CREATE_DERIVED_CLASS(CreateDerivedClass)
+EMIT_CREATE_DERIVED_CLASS(CreateDerivedClassLongIndex)
+#undef EMIT_CREATE_DERIVED_CLASS
+
+#define EMIT_CREATE_GENERATOR(name)                                            \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.createGenerator(                                                       \
+        FR(inst->op1),                                                         \
+        FR(inst->op2),                                                         \
+        codeBlock_->getRuntimeModule(),                                        \
+        inst->op3);                                                            \
+  }
+
+EMIT_CREATE_GENERATOR(CreateGenerator)
+EMIT_CREATE_GENERATOR(CreateGeneratorLongIndex)
+
+#undef EMIT_CREATE_GENERATOR
+
+inline void JITContext::Compiler::emitNewObject(
+    const inst::NewObjectInst *inst) {
+  em_.newObject(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitNewObjectWithParent(
+    const inst::NewObjectWithParentInst *inst) {
+  em_.newObjectWithParent(FR(inst->op1), FR(inst->op2));
+}
+
+#define EMIT_NEW_OBJECT_WITH_BUFFER(name)                                      \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.newObjectWithBuffer(FR(inst->op1), inst->op2, inst->op3);              \
+  }
+
+EMIT_NEW_OBJECT_WITH_BUFFER(NewObjectWithBuffer)
+EMIT_NEW_OBJECT_WITH_BUFFER(NewObjectWithBufferLong)
+
+#undef EMIT_NEW_OBJECT_WITH_BUFFER
+
+inline void JITContext::Compiler::emitNewArray(const inst::NewArrayInst *inst) {
+  em_.newArray(FR(inst->op1), inst->op2);
+}
+
+#define EMIT_NEW_ARRAY_WITH_BUFFER(name)                                       \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.newArrayWithBuffer(FR(inst->op1), inst->op2, inst->op3, inst->op4);    \
+  }
+
+EMIT_NEW_ARRAY_WITH_BUFFER(NewArrayWithBuffer)
+EMIT_NEW_ARRAY_WITH_BUFFER(NewArrayWithBufferLong)
+
+#undef EMIT_NEW_ARRAY_WITH_BUFFER
+
+inline void JITContext::Compiler::emitNewFastArray(
+    const inst::NewFastArrayInst *inst) {
+  em_.newFastArray(FR(inst->op1), inst->op2);
+}
+inline void JITContext::Compiler::emitFastArrayLength(
+    const inst::FastArrayLengthInst *inst) {
+  em_.fastArrayLength(FR(inst->op1), FR(inst->op2));
+}
+inline void JITContext::Compiler::emitFastArrayLoad(
+    const inst::FastArrayLoadInst *inst) {
+  em_.fastArrayLoad(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+inline void JITContext::Compiler::emitFastArrayStore(
+    const inst::FastArrayStoreInst *inst) {
+  em_.fastArrayStore(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+inline void JITContext::Compiler::emitFastArrayPush(
+    const inst::FastArrayPushInst *inst) {
+  em_.fastArrayPush(FR(inst->op1), FR(inst->op2));
+}
+inline void JITContext::Compiler::emitFastArrayAppend(
+    const inst::FastArrayAppendInst *inst) {
+  em_.fastArrayAppend(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitGetPNameList(
+    const inst::GetPNameListInst *inst) {
+  em_.getPNameList(FR(inst->op1), FR(inst->op2), FR(inst->op3), FR(inst->op4));
+}
+
+inline void JITContext::Compiler::emitGetNextPName(
+    const inst::GetNextPNameInst *inst) {
+  em_.getNextPName(
+      FR(inst->op1),
+      FR(inst->op2),
+      FR(inst->op3),
+      FR(inst->op4),
+      FR(inst->op5));
+}
+
+inline void JITContext::Compiler::emitToPropertyKey(
+    const inst::ToPropertyKeyInst *inst) {
+  em_.toPropertyKey(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitIteratorBegin(
+    const inst::IteratorBeginInst *inst) {
+  em_.iteratorBegin(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitIteratorNext(
+    const inst::IteratorNextInst *inst) {
+  em_.iteratorNext(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+inline void JITContext::Compiler::emitIteratorClose(
+    const inst::IteratorCloseInst *inst) {
+  em_.iteratorClose(FR(inst->op1), (bool)inst->op2);
+}
+
+#define EMIT_GET_ARGUMENTS_PROP_BY_VAL(name, op)                               \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.getArgumentsPropByVal##op(                                             \
+        FR(inst->op1), FR(inst->op2), FR(inst->op3));                          \
+  }
+
+EMIT_GET_ARGUMENTS_PROP_BY_VAL(GetArgumentsPropByValLoose, Loose)
+EMIT_GET_ARGUMENTS_PROP_BY_VAL(GetArgumentsPropByValStrict, Strict)
+
+#undef EMIT_GET_ARGUMENTS_PROP_BY_VAL
+
+inline void JITContext::Compiler::emitGetArgumentsLength(
+    const inst::GetArgumentsLengthInst *inst) {
+  em_.getArgumentsLength(FR(inst->op1), FR(inst->op2));
+}
+
+#define EMIT_REIFY_ARGUMENTS(name, op)                                         \
+  inline void JITContext::Compiler::emit##name(const inst::name##Inst *inst) { \
+    em_.reifyArguments##op(FR(inst->op1));                                     \
+  }
+
+EMIT_REIFY_ARGUMENTS(ReifyArgumentsLoose, Loose)
+EMIT_REIFY_ARGUMENTS(ReifyArgumentsStrict, Strict)
+
+#undef EMIT_REIFY_ARGUMENTS
+
+inline void JITContext::Compiler::emitCreateThisForNew(
+    const inst::CreateThisForNewInst *inst) {
+  auto cacheIdx = inst->op3;
+  em_.createThis(FR(inst->op1), FR(inst->op2), FR(inst->op2), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitCreateThisForSuper(
+    const inst::CreateThisForSuperInst *inst) {
+  auto cacheIdx = inst->op4;
+  em_.createThis(FR(inst->op1), FR(inst->op2), FR(inst->op3), cacheIdx);
+}
+
+inline void JITContext::Compiler::emitSelectObject(
+    const inst::SelectObjectInst *inst) {
+  em_.selectObject(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+inline void JITContext::Compiler::emitLoadThisNS(
+    const inst::LoadThisNSInst *inst) {
+  em_.loadThisNS(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitCoerceThisNS(
+    const inst::CoerceThisNSInst *inst) {
+  em_.coerceThisNS(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitGetNewTarget(
+    const inst::GetNewTargetInst *inst) {
+  em_.getNewTarget(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitDebugger(const inst::DebuggerInst *inst) {
+  em_.debugger();
+}
+
+inline void JITContext::Compiler::emitThrow(const inst::ThrowInst *inst) {
+  em_.throwInst(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitThrowIfEmpty(
+    const inst::ThrowIfEmptyInst *inst) {
+  em_.throwIfEmpty(FR(inst->op1), FR(inst->op2));
+}
+inline void JITContext::Compiler::emitThrowIfUndefined(
+    const inst::ThrowIfUndefinedInst *inst) {
+  em_.throwIfUndefined(FR(inst->op1), FR(inst->op2));
+}
+
+inline void JITContext::Compiler::emitThrowIfThisInitialized(
+    const inst::ThrowIfThisInitializedInst *inst) {
+  em_.throwIfThisInitialized(FR(inst->op1));
+}
+
+inline void JITContext::Compiler::emitAddS(const inst::AddSInst *inst) {
+  em_.addS(FR(inst->op1), FR(inst->op2), FR(inst->op3));
+}
+
+inline void JITContext::Compiler::emitCreateRegExp(
+    const inst::CreateRegExpInst *inst) {
+  em_.createRegExp(
+      FR(inst->op1),
+      symbolIDMayAllocate(inst->op2).unsafeGetRaw(),
+      symbolIDMayAllocate(inst->op3).unsafeGetRaw(),
+      inst->op4);
+}
+
+} // namespace x86_64
+} // namespace vm
+} // namespace hermes
+#endif // HERMESVM_JIT
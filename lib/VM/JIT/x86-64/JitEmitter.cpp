@@ -0,0 +1,4353 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JIT/Config.h"
+#if HERMESVM_JIT
+#include "JitEmitter.h"
+
+#include "../JitHandlers.h"
+
+#include "../RuntimeOffsets.h"
+#include "hermes/BCGen/HBC/StackFrameLayout.h"
+#include "hermes/FrontEndDefs/Builtins.h"
+#include "hermes/Support/ErrorHandling.h"
+#include "hermes/VM/Callable.h"
+#include "hermes/VM/Interpreter.h"
+#include "hermes/VM/StaticHUtils.h"
+
+#define DEBUG_TYPE "jit"
+
+#if defined(HERMESVM_COMPRESSED_POINTERS) && !defined(HERMESVM_CONTIGUOUS_HEAP)
+#error JIT does not support non-contiguous heap with compressed pointers
+#endif
+
+namespace hermes::vm::x86_64 {
+
+namespace {
+
+// Ensure that HermesValue tags are handled correctly by updating this every
+// time the HERMESVALUE_VERSION changes, and going through the JIT and updating
+// any relevant code.
+static_assert(
+    HERMESVALUE_VERSION == 2,
+    "HermesValue version mismatch, JIT may need to be updated");
+
+/// Scratch registers. None of them survive a call.
+constexpr auto xTmp0 = x86::rax;
+constexpr auto xTmp1 = x86::rcx;
+constexpr auto xTmp2 = x86::rdx;
+constexpr auto xTmp3 = x86::r8;
+/// Reserved for loading addresses and immediates that don't fit in an
+/// instruction.
+constexpr auto xScratch = x86::r11;
+
+/// Arguments of the SysV calling convention.
+constexpr auto xArg0 = x86::rdi;
+constexpr auto xArg1 = x86::rsi;
+constexpr auto xArg2 = x86::rdx;
+constexpr auto xArg3 = x86::rcx;
+constexpr auto xArg4 = x86::r8;
+constexpr auto xArg5 = x86::r9;
+
+/// Extract the pointer from the HermesValue in \p inOut.
+void emit_sh_ljs_get_pointer(x86::Assembler &a, const x86::Gp &inOut) {
+  static_assert(
+      HERMESVALUE_VERSION == 2,
+      "The pointer occupies the low kHV_NumDataBits bits");
+  a.shl(inOut, 64 - kHV_NumDataBits);
+  a.shr(inOut, 64 - kHV_NumDataBits);
+}
+
+/// Encode a native pointer in \p inOut into a tagged object pointer
+/// (SHLegacyValue). \p tmp is clobbered.
+void emit_sh_ljs_object(
+    x86::Assembler &a,
+    const x86::Gp &inOut,
+    const x86::Gp &tmp) {
+  static_assert(
+      HERMESVALUE_VERSION == 2,
+      "HVTag_Object << kHV_NumDataBits is 0x1111...0000...");
+  a.mov(tmp, (uint64_t)HVTag_Object << kHV_NumDataBits);
+  a.or_(inOut, tmp);
+}
+
+/// Emit code to check whether \p input has the tag \p tag, using \p tmp.
+/// \p input is not modified unless it is the same as \p tmp, which is allowed.
+/// CPU flags are updated as result. je on success.
+void emit_sh_ljs_has_tag(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input,
+    HVTag tag) {
+  if (tmp != input)
+    a.mov(tmp, input);
+  a.sar(tmp, kHV_NumDataBits);
+  a.cmp(tmp.r32(), (int32_t)tag);
+}
+
+/// Emit code to check whether \p input has the extended tag \p etag, using
+/// \p tmp.
+/// \p input is not modified unless it is the same as \p tmp, which is allowed.
+/// CPU flags are updated as result. je on success.
+void emit_sh_ljs_has_etag(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input,
+    HVETag etag) {
+  static_assert(
+      HERMESVALUE_VERSION == 2, "ETags are at kHV_NumDataBits - 1");
+  if (tmp != input)
+    a.mov(tmp, input);
+  a.sar(tmp, kHV_NumDataBits - 1);
+  a.cmp(tmp.r32(), (int32_t)etag);
+}
+
+/// Emit code to check whether \p input is an object. je on success.
+void emit_sh_ljs_is_object(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  static_assert(
+      (int16_t)HVTag_Object == (int16_t)(-1) && "HV_TagObject must be -1");
+  emit_sh_ljs_has_tag(a, tmp, input, HVTag_Object);
+}
+
+/// Emit code to check whether \p input is a string. je on success.
+void emit_sh_ljs_is_string(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  static_assert((int16_t)HVTag_Str == (int16_t)(-3) && "HV_TagStr must be -3");
+  emit_sh_ljs_has_tag(a, tmp, input, HVTag_Str);
+}
+
+/// Emit code to check whether \p input is a BigInt. je on success.
+void emit_sh_ljs_is_bigint(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_tag(a, tmp, input, HVTag_BigInt);
+}
+
+/// Emit code to check whether \p input is a symbol. je on success.
+void emit_sh_ljs_is_symbol(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_etag(a, tmp, input, HVETag_Symbol);
+}
+
+/// Emit code to check whether \p input is empty. je on success.
+void emit_sh_ljs_is_empty(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_etag(a, tmp, input, HVETag_Empty);
+}
+
+/// Emit code to check whether \p input is null. je on success.
+void emit_sh_ljs_is_null(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_etag(a, tmp, input, HVETag_Null);
+}
+
+/// Emit code to check whether \p input is undefined. je on success.
+void emit_sh_ljs_is_undefined(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_etag(a, tmp, input, HVETag_Undefined);
+}
+
+/// Emit code to check whether \p input is a bool. je on success.
+void emit_sh_ljs_is_bool(
+    x86::Assembler &a,
+    const x86::Gp &tmp,
+    const x86::Gp &input) {
+  emit_sh_ljs_has_etag(a, tmp, input, HVETag_Bool);
+}
+
+/// For a register \p inOut that contains a bool (i.e. either 0 or 1), turn it
+/// into a HermesValue boolean by adding the corresponding tag. \p tmp is
+/// clobbered.
+void emit_sh_ljs_bool(
+    x86::Assembler &a,
+    const x86::Gp &inOut,
+    const x86::Gp &tmp) {
+  static constexpr SHLegacyValue baseBool = HermesValue::encodeBoolValue(false);
+  static_assert(HERMESVALUE_VERSION == 2);
+  a.shl(inOut, kHV_BoolBitIdx);
+  a.mov(tmp, baseBool.raw);
+  a.or_(inOut, tmp);
+}
+
+/// For a register containing a pointer to a GCCell, retrieve its CellKind (a
+/// single byte) and store it zero-extended in \p out.
+void emit_gccell_get_kind(
+    x86::Assembler &a,
+    const x86::Gp &out,
+    const x86::Gp &in) {
+  a.movzx(
+      out.r32(),
+      x86::byte_ptr(
+          in,
+          offsetof(SHGCCell, kindAndSize) + RuntimeOffsets::kindAndSizeKind));
+}
+
+/// For a register \p inOut that contains a CellKind, check whether it falls
+/// within the kind range [first, last]. \p inOut is clobbered.
+/// CPU flags are updated as result. jbe on success, or ja on failure.
+void emit_cellkind_in_range(
+    x86::Assembler &a,
+    const x86::Gp &inOut,
+    CellKind first,
+    CellKind last) {
+  a.sub(inOut.r32(), (uint32_t)first);
+  a.cmp(inOut.r32(), (uint32_t)last - (uint32_t)first);
+}
+
+/// For a register \p xmmInput, which contains a double, check whether it is a
+/// valid signed 32-bit integer.
+/// CPU flags are updated. je on success, and jp must be checked first since
+/// NaN compares equal to everything with ucomisd.
+/// If successful, \p gpTemp will contain the number converted to int32.
+/// \pre xmmTemp != xmmInput, because both are used in the comparison.
+void emit_double_is_int32(
+    x86::Assembler &a,
+    const x86::Gp &gpTemp,
+    const x86::Xmm &xmmTemp,
+    const x86::Xmm &xmmInput) {
+  assert(xmmTemp != xmmInput && "must use a different temp");
+  // cvttsd2si returns INT32_MIN for out of range values, which will not
+  // convert back to the same double unless the input was INT32_MIN.
+  a.cvttsd2si(gpTemp.r32(), xmmInput);
+  a.cvtsi2sd(xmmTemp, gpTemp.r32());
+  a.ucomisd(xmmTemp, xmmInput);
+}
+
+/// For a register \p xmmInput, which contains a double, check whether it is a
+/// valid unsigned 32-bit integer.
+/// CPU flags are updated, with the same conventions as emit_double_is_int32().
+/// If successful, \p gpTemp will contain the number converted to uint32.
+/// \pre xmmTemp != xmmInput, because both are used in the comparison.
+void emit_double_is_uint32(
+    x86::Assembler &a,
+    const x86::Gp &gpTemp,
+    const x86::Xmm &xmmTemp,
+    const x86::Xmm &xmmInput) {
+  assert(xmmTemp != xmmInput && "must use a different temp");
+  // Convert to a 64-bit integer, and then check that the result fits in 32
+  // bits by converting just the low 32 bits back.
+  a.cvttsd2si(gpTemp.r64(), xmmInput);
+  a.mov(gpTemp.r32(), gpTemp.r32());
+  a.cvtsi2sd(xmmTemp, gpTemp.r64());
+  a.ucomisd(xmmTemp, xmmInput);
+}
+
+/// Given a compressed pointer in \p inOut that is known to be non-null,
+/// decompress it and place the result in \p inOut.
+void emit_sh_cp_decode_non_null(x86::Assembler &a, const x86::Gp &inOut) {
+#ifdef HERMESVM_COMPRESSED_POINTERS
+  a.add(inOut, xRuntime);
+#endif
+}
+
+/// Load a compressed pointer from \p mem.
+void emit_load_cp(x86::Assembler &a, const x86::Gp &dest, x86::Mem mem) {
+#ifdef HERMESVM_COMPRESSED_POINTERS
+  mem.setSize(4);
+  a.mov(dest.r32(), mem);
+#else
+  mem.setSize(8);
+  a.mov(dest.r64(), mem);
+#endif
+}
+
+#ifndef HERMESVM_BOXED_DOUBLES
+static_assert(
+    sizeof(SmallHermesValue) == sizeof(HermesValue),
+    "SmallHermesValue can be loaded as a HermesValue without boxed doubles");
+#endif
+
+/// The element type of a typed array kind.
+struct TypedArrayElement {
+  CellKind kind;
+  uint8_t size;
+  bool isFloat;
+  bool isSigned;
+};
+
+/// The element types of all typed array kinds, in CellKind order.
+constexpr TypedArrayElement kTypedArrayElements[] = {
+#define TYPED_ARRAY(name, type)   \
+  {CellKind::name##ArrayKind,     \
+   sizeof(type),                  \
+   std::is_floating_point_v<type>, \
+   std::is_signed_v<type>},
+#include "hermes/VM/TypedArrays.def"
+};
+static_assert(
+    kTypedArrayElements[0].kind == CellKind::TypedArrayBaseKind_first &&
+        std::size(kTypedArrayElements) ==
+            (size_t)CellKind::TypedArrayBaseKind_last -
+                (size_t)CellKind::TypedArrayBaseKind_first + 1,
+    "Typed array kinds must be contiguous and in TypedArrays.def order");
+
+class OurErrorHandler : public asmjit::ErrorHandler {
+  asmjit::Error &expectedError_;
+  std::function<void(std::string &&message)> const longjmpError_;
+
+ public:
+  /// \param expectedError if we get an error matching this value, we ignore it.
+  explicit OurErrorHandler(
+      asmjit::Error &expectedError,
+      const std::function<void(std::string &&message)> &longjmpError)
+      : expectedError_(expectedError), longjmpError_(longjmpError) {}
+
+  void handleError(
+      asmjit::Error err,
+      const char *message,
+      asmjit::BaseEmitter *origin) override {
+    if (err == expectedError_) {
+      LLVM_DEBUG(
+          llvh::outs() << "Expected AsmJit error: " << err << ": "
+                       << asmjit::DebugUtils::errorAsString(err) << ": "
+                       << message << "\n");
+      return;
+    }
+
+    std::string formattedMsg{};
+    {
+      // Ensure we run any destructors for the ostream before longjmp.
+      llvh::raw_string_ostream OS{formattedMsg};
+      OS << "AsmJit error: " << err << ": "
+         << asmjit::DebugUtils::errorAsString(err) << ": " << message;
+      OS.flush();
+    }
+
+    // IMPORTANT: From here on, we MUST ensure that no destructors need to run.
+    // One exception: formattedMsg will have its destructor skipped, but we're
+    // moving out of it so in practice the std::string won't have anything to
+    // free, avoiding leaks.
+    LLVM_DEBUG(llvh::dbgs() << formattedMsg << "\n");
+    longjmpError_(std::move(formattedMsg));
+  }
+};
+
+#ifndef ASMJIT_NO_LOGGING
+class OurLogger : public asmjit::Logger {
+  ASMJIT_API asmjit::Error _log(const char *data, size_t size) noexcept
+      override {
+    llvh::outs()
+        << (size == SIZE_MAX ? llvh::StringRef(data)
+                             : llvh::StringRef(data, size));
+    return asmjit::kErrorOk;
+  }
+};
+#endif
+
+} // unnamed namespace
+
+/// Save the current IP and emit a call to a runtime function. This should be
+/// used in most cases when invoking slow paths and handlers for complex
+/// functionality.
+#define EMIT_RUNTIME_CALL(em, type, func)      \
+  do {                                         \
+    using _FnT = type;                         \
+    _FnT _fn = func;                           \
+    (void)_fn;                                 \
+    (em).callWithSavedIP((void *)func, #func); \
+  } while (0)
+
+/// Call a runtime function without saving the IP. This is intended for special
+/// cases where we want to preserve the currently saved IP or if the IP is not
+/// needed.
+#define EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(em, type, func) \
+  do {                                                     \
+    using _FnT = type;                                     \
+    _FnT _fn = func;                                       \
+    (void)_fn;                                             \
+    (em).callIndirect((void *)func, #func);                \
+  } while (0)
+
+Emitter::Emitter(
+    asmjit::JitRuntime &jitRT,
+    unsigned dumpJitCode,
+    bool emitAsserts,
+    CodeBlock *codeBlock,
+    ReadPropertyCacheEntry *readPropertyCache,
+    WritePropertyCacheEntry *writePropertyCache,
+    uint32_t numFrameRegs,
+    const std::function<void(std::string &&message)> &longjmpError)
+    : dumpJitCode_(dumpJitCode),
+      emitAsserts_(emitAsserts),
+      numFrameRegs_(numFrameRegs),
+      codeBlock_(codeBlock) {
+  errorHandler_ = std::unique_ptr<asmjit::ErrorHandler>(
+      new OurErrorHandler(expectedError_, longjmpError));
+  knownNumbers_.resize(numFrameRegs);
+
+  code.init(jitRT.environment(), jitRT.cpuFeatures());
+  code.setErrorHandler(errorHandler_.get());
+
+#ifndef ASMJIT_NO_LOGGING
+  if (dumpJitCode_ & DumpJitCode::Code) {
+    logger_ = std::unique_ptr<asmjit::Logger>(new OurLogger());
+    logger_->setIndentation(asmjit::FormatIndentationGroup::kCode, 4);
+    logger_->addFlags(asmjit::FormatFlags::kHexImms);
+    code.setLogger(logger_.get());
+  }
+#endif
+
+  code.attach(&a);
+
+  roDataLabel_ = a.newNamedLabel("RO_DATA");
+  returnLabel_ = a.newNamedLabel("leave");
+
+  // Save read/write property cache addresses.
+  roOfsReadPropertyCachePtr_ = relocatableConst(
+      (uint64_t)readPropertyCache,
+      JITRelocKind::ReadPropertyCache,
+      "readPropertyCache");
+  roOfsWritePropertyCachePtr_ = relocatableConst(
+      (uint64_t)writePropertyCache,
+      JITRelocKind::WritePropertyCache,
+      "writePropertyCache");
+}
+
+void Emitter::enter(uint32_t numCount, uint32_t npCount) {
+  // Frame registers are never allocated to hardware registers, so the number
+  // and non-pointer counts are unused.
+  (void)numCount;
+  (void)npCount;
+
+  if (!codeBlock_->getRuntimeModule()
+           ->getBytecode()
+           ->getExceptionTable(codeBlock_->getFunctionID())
+           .empty())
+    catchTableLabel_ = a.newNamedLabel("CATCH_TABLE");
+
+  frameSetup(numFrameRegs_);
+}
+
+void Emitter::comment(const char *fmt, ...) {
+  if (!hasLogger())
+    return;
+  va_list args;
+  va_start(args, fmt);
+  char buf[80];
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  a.comment(buf);
+}
+
+JITCompiledFunctionPtr Emitter::addToRuntime(asmjit::JitRuntime &jr) {
+  code.detach(&a);
+  JITCompiledFunctionPtr fn;
+  asmjit::Error err = jr.add(&fn, &code);
+  if (err) {
+    llvh::errs() << "AsmJit failed: " << asmjit::DebugUtils::errorAsString(err)
+                 << "\n";
+    hermes::hermes_fatal("AsmJit failed");
+  }
+  return fn;
+}
+
+void Emitter::newBasicBlock(const asmjit::Label &label) {
+  // The block may be reached from several places, so nothing is known about
+  // the registers.
+  knownNumbers_.reset();
+  a.bind(label);
+}
+
+int32_t Emitter::getDebugFunctionName() {
+  if (roOfsDebugFunctionName_ < 0) {
+    std::string str;
+    llvh::raw_string_ostream ss(str);
+    ss << codeBlock_->getFunctionID() << "(" << codeBlock_->getNameString()
+       << ")";
+    ss.flush();
+    int32_t size = str.size() + 1;
+    roOfsDebugFunctionName_ = reserveData(size, 1, asmjit::TypeId::kInt8, size);
+    memcpy(roData_.data() + roOfsDebugFunctionName_, str.data(), size);
+  }
+  return roOfsDebugFunctionName_;
+}
+
+void Emitter::saveRegistersAndCheckStack() {
+  // Higher addresses are at the top.
+  // +-----------------------------+<---- old rsp
+  // |       return address        |
+  // +-----------------------------+
+  // |             rbp             |
+  // +-----------------------------+<---- new rbp
+  // |             rbx             |
+  // +-----------------------------+
+  // |             r12             |
+  // +-----------------------------+
+  // |             r13             |
+  // +-----------------------------+
+  // |     r14 (for alignment)     |
+  // +-----------------------------+
+  // |  Saved SHLocals* (optional) |
+  // +-----------------------------+
+  // |      SHJmpBuf (optional)    |
+  // +-----------------------------+<--- new rsp
+  a.push(x86::rbp);
+  a.mov(x86::rbp, x86::rsp);
+  a.push(x86::rbx);
+  a.push(x86::r12);
+  a.push(x86::r13);
+  a.push(x86::r14);
+  if (uint32_t localAreaSize = getLocalAreaSize())
+    a.sub(x86::rsp, localAreaSize);
+
+  comment("// xRuntime");
+  a.mov(xRuntime, xArg0);
+
+  // Save the SHLocals pointer because we don't allocate and push a new
+  // SHLocals in the JIT.
+  // Used in CatchInst to restore state.
+  if (catchTableLabel_.isValid()) {
+    comment("// saved SHLocals *");
+    a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::shLocals));
+    a.mov(x86::qword_ptr(x86::rsp, getSavedSHLocalsOffset()), xTmp0);
+  }
+
+#ifndef HERMES_CHECK_NATIVE_STACK
+#error Only native stack checking is supported in the JIT
+#endif
+
+  comment("// _sh_check_native_stack_overflow");
+  asmjit::Label nativeOverflowLab = newSlowPathLabel();
+  asmjit::Label nativeOverflowContLab = newContLabel();
+  // Subtract the frame pointer from nativeStackHigh and compare it against the
+  // size. If the difference is less than the stack size, then we are still
+  // within the current stack bounds.
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::nativeStackHigh));
+  a.sub(xTmp0, x86::rbp);
+  a.cmp(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::nativeStackSize));
+  // If the frame pointer is within bounds, we are done. Otherwise, we need to
+  // check if the bounds have changed.
+  a.ja(nativeOverflowLab);
+  a.bind(nativeOverflowContLab);
+  slowPaths_.push_back(
+      {.slowPathLab = nativeOverflowLab,
+       .contLab = nativeOverflowContLab,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Slow path: _sh_check_native_stack_overflow");
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         // Do not save the IP because we have not yet set up the stack frame
+         // for this function. If this throws, the exception should appear in
+         // the caller.
+         EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+             em, void (*)(SHRuntime *), _sh_check_native_stack_overflow);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::frameSetup(unsigned numFrameRegs) {
+  saveRegistersAndCheckStack();
+
+  comment("// xFrame");
+  a.mov(xFrame, x86::qword_ptr(xRuntime, RuntimeOffsets::stackPointer));
+
+  // If the function has a prohibitInvoke flag, we need to check if it has been
+  // called correctly.
+  auto prohibitInvoke = codeBlock_->getHeaderFlags().getProhibitInvoke();
+  if (prohibitInvoke != ProhibitInvoke::None) {
+    // Compare new.target against undefined.
+    a.mov(xTmp0, frameSlot(StackFrameLayout::NewTarget));
+    emit_sh_ljs_is_undefined(a, xTmp0, xTmp0);
+
+    void (*slowCall)(SHRuntime *);
+    const char *slowCallName;
+    asmjit::Label throwInvalidInvokeLab;
+    if (prohibitInvoke == ProhibitInvoke::Call) {
+      // If regular calls are prohibited, then we jump to throwInvalidInvoke if
+      // new.target is undefined.
+      throwInvalidInvokeLab = a.newNamedLabel("throwInvalidCall");
+      a.je(throwInvalidInvokeLab);
+
+      slowCall = _sh_throw_invalid_call;
+      slowCallName = "_sh_throw_invalid_call";
+    } else {
+      assert(
+          prohibitInvoke == ProhibitInvoke::Construct &&
+          "Unknown prohibitInvoke");
+      // If construct calls are prohibited, then we jump to throwInvalidInvoke
+      // if new.target is not undefined.
+      throwInvalidInvokeLab = a.newNamedLabel("throwInvalidConstruct");
+      a.jne(throwInvalidInvokeLab);
+
+      slowCall = _sh_throw_invalid_construct;
+      slowCallName = "_sh_throw_invalid_construct";
+    }
+
+    slowPaths_.push_back(
+        {.slowPathLab = throwInvalidInvokeLab,
+         .slowCall = (void *)slowCall,
+         .slowCallName = slowCallName,
+         .emit = [](Emitter &em, SlowPath &sl) {
+           em.comment("// Slow path: %s", sl.slowCallName);
+           em.a.bind(sl.slowPathLab);
+           em.a.mov(xArg0, xRuntime);
+           // Note that we don't save the IP, because this is being thrown in
+           // the caller's context.
+           em.callIndirect(sl.slowCall, sl.slowCallName);
+           // Function does not return.
+         }});
+  }
+
+  // NOTE: Unlike _sh_enter, we do not push an SHLocals object.
+  //  SHLegacyValue *frame = _sh_enter(shr, &locals.head, 13);
+  comment("// _sh_enter");
+  asmjit::Label registerOverflowLab = newSlowPathLabel();
+
+  // Compute the remaining available stack space:
+  // runtime.registerStackEnd_ - runtime.stackPointer_
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::registerStackEnd));
+  a.sub(xTmp0, xFrame);
+  // Check if we need more registers than remain.
+  size_t totalRegsToAlloc = numFrameRegs + hbc::StackFrameLayout::FirstLocal;
+  size_t regAllocSize = totalRegsToAlloc * sizeof(SHLegacyValue);
+  if (regAllocSize > INT32_MAX)
+    hermes_fatal("JIT frame too large");
+  a.cmp(xTmp0, (int32_t)regAllocSize);
+  a.jb(registerOverflowLab);
+
+  // Advance the register stack.
+  a.lea(xTmp0, x86::ptr(xFrame, (int32_t)regAllocSize));
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::stackPointer), xTmp0);
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::currentFrame), xFrame);
+
+  // Fill it with undefined.
+  a.mov(xTmp0, _sh_ljs_undefined().raw);
+  if (totalRegsToAlloc <= 16) {
+    // If the number of registers is small, just fill them directly.
+    for (size_t i = 0; i < totalRegsToAlloc; ++i)
+      a.mov(x86::qword_ptr(xFrame, i * sizeof(SHLegacyValue)), xTmp0);
+  } else {
+    // rdi and rcx are free here, since the runtime pointer has been moved to
+    // xRuntime. The direction flag is guaranteed clear by the ABI.
+    a.mov(x86::rdi, xFrame);
+    a.mov(x86::ecx, (uint32_t)totalRegsToAlloc);
+    a.rep().stosq();
+  }
+
+  // Create the slow path for throwing a register stack overflow.
+  slowPaths_.push_back(
+      {.slowPathLab = registerOverflowLab,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Slow path: _sh_throw_register_stack_overflow");
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         // Do not save the IP because we have not yet set up the stack frame
+         // for this function. The exception should appear in the caller.
+         EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+             em, void (*)(SHRuntime *), _sh_throw_register_stack_overflow);
+       }});
+
+  enterTryAndLogEntry();
+}
+
+void Emitter::enterTryAndLogEntry() {
+  if (catchTableLabel_.isValid()) {
+    comment("// _sh_try");
+    uint32_t jmpBufOffset = getJmpBufOffset();
+    // buf->prev = shr->shCurJmpBuf;
+    a.mov(xTmp0, x86::qword_ptr(xRuntime, offsetof(SHRuntime, shCurJmpBuf)));
+    a.mov(
+        x86::qword_ptr(x86::rsp, jmpBufOffset + offsetof(SHJmpBuf, prev)),
+        xTmp0);
+
+    // shr->shCurJmpBuf = buf;
+    a.lea(xTmp0, x86::ptr(x86::rsp, jmpBufOffset));
+    a.mov(x86::qword_ptr(xRuntime, offsetof(SHRuntime, shCurJmpBuf)), xTmp0);
+
+    // _setjmp(buf->buf);
+    a.lea(xArg0, x86::ptr(x86::rsp, jmpBufOffset + offsetof(SHJmpBuf, buf)));
+    EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(*this, int (*)(jmp_buf), _sh_setjmp);
+    // If this a catch, go to the catch table to jump to either a handler BB or
+    // rethrow.
+    a.test(x86::eax, x86::eax);
+    a.jnz(catchTableLabel_);
+  }
+
+  if (dumpJitCode_ & DumpJitCode::EntryExit) {
+    comment("// print entry");
+    a.mov(xArg0.r32(), 1);
+    a.lea(xArg1, x86::ptr(roDataLabel_, getDebugFunctionName()));
+    EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+        *this, void (*)(bool, const char *), _sh_print_function_entry_exit);
+  }
+}
+
+void Emitter::leave(
+    llvh::ArrayRef<const asmjit::Label *> exceptionHandlers,
+    llvh::ArrayRef<OSRTarget> osrTargets) {
+  comment("// leaveFrame");
+  a.bind(returnLabel_);
+  if (dumpJitCode_ & DumpJitCode::EntryExit) {
+    comment("// print exit");
+    a.xor_(xArg0.r32(), xArg0.r32());
+    a.lea(xArg1, x86::ptr(roDataLabel_, getDebugFunctionName()));
+    EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+        *this, void (*)(bool, const char *), _sh_print_function_entry_exit);
+  }
+
+  if (catchTableLabel_.isValid()) {
+    comment("// _sh_end_try");
+    // shr->shCurJmpBuf = buf->prev
+    uint32_t jmpBufOffset = getJmpBufOffset();
+    a.mov(
+        xTmp0,
+        x86::qword_ptr(x86::rsp, jmpBufOffset + offsetof(SHJmpBuf, prev)));
+    a.mov(x86::qword_ptr(xRuntime, offsetof(SHRuntime, shCurJmpBuf)), xTmp0);
+  }
+
+  // _sh_leave(shr, &locals.head, frame);
+  // Restore the previous stack frame.
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::stackPointer), xFrame);
+  a.mov(xTmp0, frameSlot(StackFrameLayout::PreviousFrame));
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::currentFrame), xTmp0);
+
+  // The return value has been stashed in xRetVal by ret(). Move it to the
+  // return register.
+  a.mov(x86::rax, xRetVal);
+
+  // Restore the callee-saved registers, which are stored right below rbp.
+  a.lea(x86::rsp, x86::ptr(x86::rbp, -4 * 8));
+  a.pop(x86::r14);
+  a.pop(x86::r13);
+  a.pop(x86::r12);
+  a.pop(x86::rbx);
+  a.pop(x86::rbp);
+  a.ret();
+
+  emitOSREntry(osrTargets);
+  emitCatchTable(exceptionHandlers);
+  emitSlowPaths();
+  emitROData();
+}
+
+void Emitter::callIndirect(void *fn, const char *name) {
+  a.call(x86::qword_ptr(roDataLabel_, registerCallTarget(fn, name)));
+}
+
+void Emitter::callWithSavedIP(void *fn, const char *name) {
+  // Save the current IP in the runtime.
+  getBytecodeIP(xScratch);
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::currentIP), xScratch);
+
+  // Call the passed function.
+  callIndirect(fn, name);
+
+  if (emitAsserts_) {
+    // Invalidate the current IP to make sure it is set before the next call.
+    a.mov(
+        x86::qword_ptr(xRuntime, RuntimeOffsets::currentIP),
+        (int32_t)Runtime::kInvalidCurrentIP);
+  }
+}
+
+void Emitter::loadBits64InGp(
+    const x86::Gp &dst,
+    uint64_t bits,
+    const char *constName) {
+  (void)constName;
+  if (bits == 0)
+    a.xor_(dst.r32(), dst.r32());
+  else
+    a.mov(dst, bits);
+}
+
+void Emitter::loadRelocatable(
+    const x86::Gp &dst,
+    uint64_t bits,
+    JITRelocKind kind,
+    uint64_t payload,
+    const char *constName) {
+  (void)constName;
+  assert(
+      (kind != JITRelocKind::RuntimeModule ||
+       bits - payload == (uint64_t)codeBlock_->getRuntimeModule()) &&
+      "RuntimeModule relocations must refer to the CodeBlock's module");
+  // movabs always encodes the full 64-bit immediate at the end of the
+  // instruction.
+  a.movabs(dst, bits);
+  relocs_.push_back({(uint32_t)a.offset() - 8, 8, kind, payload});
+}
+
+void Emitter::loadSymbolID(const x86::Gp &dst, SHSymbolID symID) {
+  // A 32-bit mov always encodes the immediate at the end of the instruction.
+  a.mov(dst.r32(), symID);
+  relocs_.push_back(
+      {(uint32_t)a.offset() - 4, 4, JITRelocKind::SymbolID, symID});
+}
+
+void Emitter::storeBits64(
+    const x86::Mem &mem,
+    uint64_t bits,
+    const x86::Gp &tmp) {
+  if (asmjit::Support::isInt32((int64_t)bits)) {
+    a.mov(mem, (int32_t)bits);
+  } else {
+    a.mov(tmp, bits);
+    a.mov(mem, tmp);
+  }
+}
+
+void Emitter::loadReadCacheEntry(const x86::Gp &dst, uint8_t cacheIdx) {
+  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
+    a.xor_(dst.r32(), dst.r32());
+    return;
+  }
+  a.mov(dst, roData(roOfsReadPropertyCachePtr_));
+  if (cacheIdx != 0)
+    a.add(dst, (int32_t)(sizeof(SHReadPropertyCacheEntry) * cacheIdx));
+}
+
+void Emitter::loadWriteCacheEntry(const x86::Gp &dst, uint8_t cacheIdx) {
+  if (cacheIdx == hbc::PROPERTY_CACHING_DISABLED) {
+    a.xor_(dst.r32(), dst.r32());
+    return;
+  }
+  a.mov(dst, roData(roOfsWritePropertyCachePtr_));
+  if (cacheIdx != 0)
+    a.add(dst, (int32_t)(sizeof(SHWritePropertyCacheEntry) * cacheIdx));
+}
+
+void Emitter::getBytecodeIP(const x86::Gp &dst) {
+  loadRelocatable(
+      dst,
+      (uint64_t)emittingIP,
+      JITRelocKind::BytecodeIP,
+      (const uint8_t *)emittingIP - codeBlock_->begin(),
+      "IP");
+}
+
+void Emitter::unreachable() {
+  EMIT_RUNTIME_CALL(*this, void (*)(), _sh_unreachable);
+}
+
+void Emitter::profilePoint(uint16_t pointIndex) {
+  comment("// ProfilePoint %u", pointIndex);
+#ifdef HERMESVM_PROFILER_BB
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1.r32(), pointIndex);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, uint16_t),
+      _interpreter_register_bb_execution);
+#else
+  // No-op if profiling is not enabled.
+#endif
+}
+
+void Emitter::catchInst(FR frRes) {
+  comment("// Catch r%u", frRes.index());
+
+  // Catch simply returns the thrown value and clears it.
+
+  // Read thrown value.
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::thrownValue));
+  a.mov(frMem(frRes), xTmp0);
+  // Clear thrown value.
+  storeBits64(
+      x86::qword_ptr(xRuntime, RuntimeOffsets::thrownValue),
+      _sh_ljs_empty().raw,
+      xTmp0);
+}
+
+void Emitter::ret(FR frValue) {
+  a.mov(xRetVal, frMem(frValue));
+  a.jmp(returnLabel_);
+}
+
+void Emitter::mov(FR frRes, FR frInput, bool logComment) {
+  // Sometimes mov() is used by other instructions, so logging is optional.
+  if (logComment)
+    comment("// %s r%u, r%u", "mov", frRes.index(), frInput.index());
+  if (frRes == frInput)
+    return;
+
+  a.mov(xTmp0, frMem(frInput));
+  a.mov(frMem(frRes), xTmp0);
+  if (isKnownNumber(frInput))
+    setKnownNumber(frRes);
+}
+
+void Emitter::loadParam(FR frRes, uint32_t paramIndex) {
+  comment("// LoadParam r%u, %u", frRes.index(), paramIndex);
+
+  asmjit::Label undefLab = a.newLabel();
+  asmjit::Label contLab = a.newLabel();
+
+  // ArgCount does not include "this", so paramIndex 0 is always available.
+  a.cmp(
+      x86::dword_ptr(
+          xFrame, StackFrameLayout::ArgCount * (int)sizeof(SHLegacyValue)),
+      paramIndex);
+  a.jb(undefLab);
+
+  int64_t ofs = ((int64_t)StackFrameLayout::ThisArg - (int64_t)paramIndex) *
+      (int64_t)sizeof(SHLegacyValue);
+  if (ofs < INT32_MIN)
+    hermes_fatal("JIT integer overflow");
+  a.mov(xTmp0, x86::qword_ptr(xFrame, (int32_t)ofs));
+  a.jmp(contLab);
+
+  a.bind(undefLab);
+  loadBits64InGp(xTmp0, _sh_ljs_undefined().raw, "undefined");
+
+  a.bind(contLab);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::loadConstDouble(FR frRes, double val, const char *name) {
+  comment("// LoadConst%s r%u, %f", name, frRes.index(), val);
+  storeBits64(frMem(frRes), llvh::DoubleToBits(val), xTmp0);
+  setKnownNumber(frRes);
+}
+
+void Emitter::loadConstBits64(FR frRes, uint64_t bits, const char *name) {
+  comment(
+      "// LoadConst%s r%u, %llu",
+      name,
+      frRes.index(),
+      (unsigned long long)bits);
+  storeBits64(frMem(frRes), bits, xTmp0);
+}
+
+void Emitter::loadConstString(
+    FR frRes,
+    RuntimeModule *runtimeModule,
+    uint32_t stringID) {
+  comment("// LoadConstString r%u, stringID %u", frRes.index(), stringID);
+
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)runtimeModule,
+      JITRelocKind::RuntimeModule,
+      0,
+      "RuntimeModule");
+  a.mov(xArg2.r32(), stringID);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHRuntimeModule *, uint32_t),
+      _sh_ljs_get_bytecode_string);
+  movFRFromRet(frRes);
+}
+
+void Emitter::loadConstBigInt(
+    FR frRes,
+    RuntimeModule *runtimeModule,
+    uint32_t bigIntID) {
+  comment("// LoadConstBigInt r%u, bigIntID %u", frRes.index(), bigIntID);
+
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)runtimeModule,
+      JITRelocKind::RuntimeModule,
+      0,
+      "RuntimeModule");
+  a.mov(xArg2.r32(), bigIntID);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHRuntimeModule *, uint32_t),
+      _sh_ljs_get_bytecode_bigint);
+  movFRFromRet(frRes);
+}
+
+void Emitter::toNumber(FR frRes, FR frInput) {
+  comment("// %s r%u, r%u", "toNumber", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // Since HermesValue is NaN-boxed we know that all non-number values will be
+  // NaN. So we can conveniently test for non-number values by checking for NaN
+  // (which is unordered with itself).
+  static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+  a.movsd(x86::xmm0, frMem(frInput));
+  a.ucomisd(x86::xmm0, x86::xmm0);
+  a.jp(slowPathLab);
+  a.bind(contLab);
+  a.movsd(frMem(frRes), x86::xmm0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: toNumber r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             double (*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_to_double_rjs);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::toNumeric(FR frRes, FR frInput) {
+  comment("// %s r%u, r%u", "toNumeric", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+  a.movsd(x86::xmm0, frMem(frInput));
+  a.ucomisd(x86::xmm0, x86::xmm0);
+  a.jp(slowPathLab);
+  a.movsd(frMem(frRes), x86::xmm0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: toNumeric r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_to_numeric_rjs);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::toInt32(FR frRes, FR frInput) {
+  comment("// ToInt32 r%u, r%u", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  a.movsd(x86::xmm1, frMem(frInput));
+  emit_double_is_int32(a, xTmp0, x86::xmm0, x86::xmm1);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+  // The input is already an int32, so xmm0 contains the result.
+  a.bind(contLab);
+  a.movsd(frMem(frRes), x86::xmm0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: ToInt32 r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             double (*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_to_int32_rjs);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::addEmptyString(FR frRes, FR frInput) {
+  comment("// AddEmptyString r%u, r%u", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // Check if the input is already a string and don't do anything.
+  a.mov(xTmp0, frMem(frInput));
+  emit_sh_ljs_is_string(a, xTmp1, xTmp0);
+  a.jne(slowPathLab);
+  a.bind(contLab);
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: AddEmptyString r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_add_empty_string_rjs);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::newObject(FR frRes) {
+  comment("// NewObject r%u", frRes.index());
+  a.mov(xArg0, xRuntime);
+  EMIT_RUNTIME_CALL(*this, SHLegacyValue(*)(SHRuntime *), _sh_ljs_new_object);
+  movFRFromRet(frRes);
+}
+
+void Emitter::newObjectWithParent(FR frRes, FR frParent) {
+  comment("// NewObjectWithParent r%u, r%u", frRes.index(), frParent.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frParent);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+      _sh_ljs_new_object_with_parent);
+  movFRFromRet(frRes);
+}
+
+void Emitter::newObjectWithBuffer(
+    FR frRes,
+    uint32_t shapeTableIndex,
+    uint32_t valBufferOffset) {
+  comment(
+      "// NewObjectWithBuffer r%u, %u, %u",
+      frRes.index(),
+      shapeTableIndex,
+      valBufferOffset);
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)codeBlock_,
+      JITRelocKind::CodeBlock,
+      0,
+      "CodeBlock");
+  a.mov(xArg2.r32(), shapeTableIndex);
+  a.mov(xArg3.r32(), valBufferOffset);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHCodeBlock *, uint32_t, uint32_t),
+      _interpreter_create_object_from_buffer);
+  movFRFromRet(frRes);
+}
+
+void Emitter::newArray(FR frRes, uint32_t size) {
+  comment("// NewArray r%u, %u", frRes.index(), size);
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1.r32(), size);
+  EMIT_RUNTIME_CALL(
+      *this, SHLegacyValue(*)(SHRuntime *, uint32_t), _sh_ljs_new_array);
+  movFRFromRet(frRes);
+}
+
+void Emitter::newArrayWithBuffer(
+    FR frRes,
+    uint32_t numElements,
+    uint32_t numLiterals,
+    uint32_t bufferIndex) {
+  comment(
+      "// NewArrayWithBuffer r%u, %u, %u, %u",
+      frRes.index(),
+      numElements,
+      numLiterals,
+      bufferIndex);
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)codeBlock_,
+      JITRelocKind::CodeBlock,
+      0,
+      "CodeBlock");
+  a.mov(xArg2.r32(), numElements);
+  a.mov(xArg3.r32(), numLiterals);
+  a.mov(xArg4.r32(), bufferIndex);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *, SHCodeBlock *, uint32_t, uint32_t, uint32_t),
+      _interpreter_create_array_from_buffer);
+  movFRFromRet(frRes);
+}
+
+void Emitter::newFastArray(FR frRes, uint32_t size) {
+  comment("// NewFastArray r%u, %u", frRes.index(), size);
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1.r32(), size);
+  EMIT_RUNTIME_CALL(
+      *this, SHLegacyValue(*)(SHRuntime *, uint32_t), _sh_new_fastarray);
+  movFRFromRet(frRes);
+}
+
+void Emitter::fastArrayLength(FR frRes, FR frArr) {
+  comment("// FastArrayLength r%u, r%u", frRes.index(), frArr.index());
+  a.mov(xTmp0, frMem(frArr));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+
+#ifdef HERMESVM_BOXED_DOUBLES
+  emit_load_cp(
+      a, xTmp0, x86::ptr(xTmp0, offsetof(SHFastArray, indexedStorage)));
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  // Zero-extend the 32-bit size before converting it.
+  a.mov(xTmp0.r32(), x86::dword_ptr(xTmp0, offsetof(SHArrayStorage, size)));
+  a.cvtsi2sd(x86::xmm0, xTmp0);
+  a.movsd(frMem(frRes), x86::xmm0);
+#else
+  a.mov(xTmp0, x86::qword_ptr(xTmp0, offsetof(SHFastArray, length)));
+  a.mov(frMem(frRes), xTmp0);
+#endif
+}
+
+void Emitter::fastArrayLoad(FR frRes, FR frArr, FR frIdx) {
+  comment(
+      "// FastArrayLoad r%u, r%u, r%u",
+      frRes.index(),
+      frArr.index(),
+      frIdx.index());
+#if defined(HERMESVM_COMPRESSED_POINTERS) || defined(HERMESVM_BOXED_DOUBLES)
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frArr);
+  a.movsd(x86::xmm0, frMem(frIdx));
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, double idx),
+      _sh_fastarray_load);
+  movFRFromRet(frRes);
+#else
+  asmjit::Label slowPathLab = newSlowPathLabel();
+
+  // Load the storage pointer.
+  a.mov(xTmp0, frMem(frArr));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  a.mov(xTmp0, x86::qword_ptr(xTmp0, offsetof(SHFastArray, indexedStorage)));
+
+  // The index must be a uint32 smaller than the size.
+  a.movsd(x86::xmm1, frMem(frIdx));
+  emit_double_is_uint32(a, xTmp1, x86::xmm0, x86::xmm1);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+  a.cmp(xTmp1.r32(), x86::dword_ptr(xTmp0, offsetof(SHArrayStorageSmall, size)));
+  a.jae(slowPathLab);
+
+  a.mov(
+      xTmp0,
+      x86::qword_ptr(
+          xTmp0, xTmp1, 3, offsetof(SHArrayStorageSmall, storage)));
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .frRes = frRes,
+       .frInput1 = frArr,
+       .frInput2 = frIdx,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: FastArrayLoad r%u, r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         EMIT_RUNTIME_CALL(em, void (*)(SHRuntime *), _sh_throw_array_oob);
+       }});
+#endif
+}
+
+void Emitter::fastArrayStore(FR frArr, FR frIdx, FR frVal) {
+  comment(
+      "// FastArrayStore r%u, r%u, r%u",
+      frArr.index(),
+      frIdx.index(),
+      frVal.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frVal);
+  loadFrameAddr(xArg2, frArr);
+  a.movsd(x86::xmm0, frMem(frIdx));
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, const SHLegacyValue *, SHLegacyValue *, double idx),
+      _sh_fastarray_store);
+}
+
+void Emitter::fastArrayPush(FR frArr, FR frVal) {
+  comment("// FastArrayPush r%u, r%u", frArr.index(), frVal.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frVal);
+  loadFrameAddr(xArg2, frArr);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+      _sh_fastarray_push);
+}
+
+void Emitter::fastArrayAppend(FR frArr, FR frOther) {
+  comment("// FastArrayAppend r%u, r%u", frArr.index(), frOther.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frOther);
+  loadFrameAddr(xArg2, frArr);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+      _sh_fastarray_append);
+}
+
+void Emitter::getGlobalObject(FR frRes) {
+  comment("// GetGlobalObject r%u", frRes.index());
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::globalObject));
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::declareGlobalVar(SHSymbolID symID) {
+  comment("// DeclareGlobalVar %u", symID);
+  a.mov(xArg0, xRuntime);
+  loadSymbolID(xArg1, symID);
+  EMIT_RUNTIME_CALL(
+      *this, void (*)(SHRuntime *, SHSymbolID), _sh_ljs_declare_global_var);
+}
+
+void Emitter::createTopLevelEnvironment(FR frRes, uint32_t size) {
+  comment("// CreateTopLevelEnvironment r%u, %u", frRes.index(), size);
+  a.mov(xArg0, xRuntime);
+  a.xor_(xArg1.r32(), xArg1.r32());
+  a.mov(xArg2.r32(), size);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *, uint32_t),
+      _sh_ljs_create_environment);
+  movFRFromRet(frRes);
+}
+
+void Emitter::createFunctionEnvironment(FR frRes, uint32_t size) {
+  comment("// CreateFunctionEnvironment r%u, %u", frRes.index(), size);
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, xFrame);
+  a.mov(xArg2.r32(), size);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, uint32_t),
+      _sh_ljs_create_function_environment);
+  movFRFromRet(frRes);
+}
+
+void Emitter::createEnvironment(FR frRes, FR frParent, uint32_t size) {
+  comment(
+      "// CreateEnvironment r%u, r%u, %u",
+      frRes.index(),
+      frParent.index(),
+      size);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frParent);
+  a.mov(xArg2.r32(), size);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *, uint32_t),
+      _sh_ljs_create_environment);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getParentEnvironment(FR frRes, uint32_t level) {
+  comment("// GetParentEnvironment r%u, %u", frRes.index(), level);
+  // Get current closure.
+  a.mov(xTmp0, frameSlot(StackFrameLayout::CalleeClosureOrCB));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  // xTmp0 = closure->environment
+  emit_load_cp(a, xTmp0, x86::ptr(xTmp0, offsetof(SHCallable, environment)));
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  for (; level; --level) {
+    // xTmp0 = env->parent.
+    emit_load_cp(
+        a, xTmp0, x86::ptr(xTmp0, offsetof(SHEnvironment, parentEnvironment)));
+    emit_sh_cp_decode_non_null(a, xTmp0);
+  }
+  emit_sh_ljs_object(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::getEnvironment(FR frRes, FR frSource, uint32_t level) {
+  comment(
+      "// GetEnvironment r%u, r%u, %u", frRes.index(), frSource.index(), level);
+  a.mov(xTmp0, frMem(frSource));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  for (; level; --level) {
+    // xTmp0 = env->parent.
+    emit_load_cp(
+        a, xTmp0, x86::ptr(xTmp0, offsetof(SHEnvironment, parentEnvironment)));
+    emit_sh_cp_decode_non_null(a, xTmp0);
+  }
+  emit_sh_ljs_object(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::getClosureEnvironment(FR frRes, FR frClosure) {
+  comment(
+      "// GetClosureEnvironment r%u, r%u", frRes.index(), frClosure.index());
+  // We know the layout of the closure, so we can load directly.
+  a.mov(xTmp0, frMem(frClosure));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  emit_load_cp(a, xTmp0, x86::ptr(xTmp0, offsetof(SHCallable, environment)));
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  // The result is a pointer, so add the object tag.
+  emit_sh_ljs_object(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::loadFromEnvironment(FR frRes, FR frEnv, uint32_t slot) {
+  comment(
+      "// LoadFromEnvironment r%u, r%u, %u",
+      frRes.index(),
+      frEnv.index(),
+      slot);
+  a.mov(xTmp0, frMem(frEnv));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  a.mov(
+      xTmp0,
+      x86::qword_ptr(
+          xTmp0,
+          (int32_t)(offsetof(SHEnvironment, slots) +
+                    sizeof(SHLegacyValue) * slot)));
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::storeToEnvironment(bool np, FR frEnv, uint32_t slot, FR frValue) {
+  comment(
+      "// Store%sToEnvironment r%u, %u, r%u",
+      np ? "NP" : "",
+      frEnv.index(),
+      slot,
+      frValue.index());
+  // The store needs a write barrier unless the value is known to be a
+  // non-pointer, so leave it to the runtime.
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, frMem(frEnv));
+  a.mov(xArg2, frMem(frValue));
+  a.mov(xArg3.r32(), slot);
+  if (np) {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(SHRuntime *, SHLegacyValue, SHLegacyValue, uint32_t),
+        _sh_ljs_store_np_to_env);
+  } else {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(SHRuntime *, SHLegacyValue, SHLegacyValue, uint32_t),
+        _sh_ljs_store_to_env);
+  }
+}
+
+void Emitter::createClosure(
+    FR frRes,
+    FR frEnv,
+    RuntimeModule *runtimeModule,
+    uint32_t functionID) {
+  comment(
+      "// CreateClosure r%u, r%u, %u",
+      frRes.index(),
+      frEnv.index(),
+      functionID);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frEnv);
+  loadRelocatable(
+      xArg2,
+      (uint64_t)runtimeModule,
+      JITRelocKind::RuntimeModule,
+      0,
+      "RuntimeModule");
+  a.mov(xArg3.r32(), functionID);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *, const SHLegacyValue *, SHRuntimeModule *, uint32_t),
+      _sh_ljs_create_bytecode_closure);
+  movFRFromRet(frRes);
+}
+
+void Emitter::createBaseClass(FR frRes, FR frPrototypeOut, FR frEnv) {
+  comment(
+      "// CreateBaseClass r%u, r%u, r%u",
+      frRes.index(),
+      frPrototypeOut.index(),
+      frEnv.index());
+  a.mov(xArg0, xRuntime);
+  // The interpreter expects that the frameRegs it receives starts on the first
+  // local register. It writes the results directly into the frame.
+  a.lea(
+      xArg1,
+      x86::ptr(
+          xFrame, hbc::StackFrameLayout::FirstLocal * sizeof(SHLegacyValue)));
+  EMIT_RUNTIME_CALL(
+      *this, void (*)(SHRuntime *, SHLegacyValue *), _interpreter_create_class);
+}
+
+void Emitter::createDerivedClass(
+    FR frRes,
+    FR frPrototypeOut,
+    FR frEnv,
+    FR frSuperClass) {
+  comment(
+      "// CreateDerivedClass r%u, r%u, r%u r%u",
+      frRes.index(),
+      frPrototypeOut.index(),
+      frEnv.index(),
+      frSuperClass.index());
+  a.mov(xArg0, xRuntime);
+  // The interpreter expects that the frameRegs it receives starts on the first
+  // local register. It writes the results directly into the frame.
+  a.lea(
+      xArg1,
+      x86::ptr(
+          xFrame, hbc::StackFrameLayout::FirstLocal * sizeof(SHLegacyValue)));
+  EMIT_RUNTIME_CALL(
+      *this, void (*)(SHRuntime *, SHLegacyValue *), _interpreter_create_class);
+}
+
+void Emitter::createGenerator(
+    FR frRes,
+    FR frEnv,
+    RuntimeModule *runtimeModule,
+    uint32_t functionID) {
+  comment(
+      "// CreateGenerator r%u, r%u, %u",
+      frRes.index(),
+      frEnv.index(),
+      functionID);
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, xFrame);
+  loadFrameAddr(xArg2, frEnv);
+  loadRelocatable(
+      xArg3,
+      (uint64_t)runtimeModule,
+      JITRelocKind::RuntimeModule,
+      0,
+      "RuntimeModule");
+  a.mov(xArg4.r32(), functionID);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *,
+          SHLegacyValue *,
+          const SHLegacyValue *,
+          SHRuntimeModule *,
+          uint32_t),
+      _interpreter_create_generator);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getArgumentsLength(FR frRes, FR frLazyReg) {
+  comment("// GetArgumentsLength r%u, r%u", frRes.index(), frLazyReg.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  a.mov(xTmp0, frMem(frLazyReg));
+  emit_sh_ljs_is_object(a, xTmp0, xTmp0);
+  a.je(slowPathLab);
+
+  // Fast path: if it's not an object, read from the frame.
+  static_assert(
+      HERMESVALUE_VERSION == 2,
+      "NativeUint32 is stored as the lower 32 bits of the raw HermesValue");
+  // Zero-extend the 32-bit count, and encode it as a double.
+  a.mov(
+      xTmp0.r32(),
+      x86::dword_ptr(
+          xFrame, StackFrameLayout::ArgCount * (int)sizeof(SHLegacyValue)));
+  a.cvtsi2sd(x86::xmm0, xTmp0);
+  a.movsd(frMem(frRes), x86::xmm0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frLazyReg,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: GetArgumentsLength r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.a.mov(xArg1, xFrame);
+         em.loadFrameAddr(xArg2, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+             _sh_ljs_get_arguments_length);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::getArgumentsPropByValImpl(
+    FR frRes,
+    FR frIndex,
+    FR frLazyReg,
+    const char *name,
+    SHLegacyValue (*shImpl)(
+        SHRuntime *shr,
+        SHLegacyValue *frame,
+        SHLegacyValue *idx,
+        SHLegacyValue *lazyReg),
+    const char *shImplName) {
+  comment(
+      "// %s r%u, r%u, r%u",
+      name,
+      frRes.index(),
+      frIndex.index(),
+      frLazyReg.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // If lazyReg is an object, go to slow path.
+  a.mov(xTmp0, frMem(frLazyReg));
+  emit_sh_ljs_is_object(a, xTmp0, xTmp0);
+  a.je(slowPathLab);
+
+  // If index is not an integer, go to slow path.
+  a.movsd(x86::xmm1, frMem(frIndex));
+  a.cvttsd2si(xTmp1, x86::xmm1);
+  a.cvtsi2sd(x86::xmm0, xTmp1);
+  a.ucomisd(x86::xmm0, x86::xmm1);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+
+  // If index >= arg count or index < 0, go to slow path.
+  // Use an unsigned comparison to handle the negative index case.
+  a.mov(
+      xTmp0.r32(),
+      x86::dword_ptr(
+          xFrame, StackFrameLayout::ArgCount * (int)sizeof(SHLegacyValue)));
+  a.cmp(xTmp1, xTmp0);
+  a.jae(slowPathLab);
+
+  // Load the argument from the stack.
+  // We want framePtr[(firstArg - index) * 8].
+  a.neg(xTmp1);
+  a.mov(
+      xTmp0,
+      x86::qword_ptr(
+          xFrame,
+          xTmp1,
+          3,
+          StackFrameLayout::FirstArg * (int)sizeof(SHLegacyValue)));
+  a.mov(frMem(frRes), xTmp0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frRes,
+       .frInput1 = frIndex,
+       .frInput2 = frLazyReg,
+       .slowCall = (void *)shImpl,
+       .slowCallName = shImplName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Slow path: %s r%u", sl.name, sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.a.mov(xArg1, xFrame);
+         em.loadFrameAddr(xArg2, sl.frInput1);
+         em.loadFrameAddr(xArg3, sl.frInput2);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::reifyArgumentsImpl(FR frLazyReg, bool strict, const char *name) {
+  comment("// %s r%u", name, frLazyReg.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // If the lazyReg is not an object, it needs to be reified, go to slow path.
+  a.mov(xTmp0, frMem(frLazyReg));
+  emit_sh_ljs_is_object(a, xTmp0, xTmp0);
+  a.jne(slowPathLab);
+  // Fast path: do nothing.
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frInput1 = frLazyReg,
+       .slowCall = strict ? (void *)_sh_ljs_reify_arguments_strict
+                          : (void *)_sh_ljs_reify_arguments_loose,
+       .slowCallName = strict ? "_sh_ljs_reify_arguments_strict"
+                              : "_sh_ljs_reify_arguments_loose",
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Slow path: %s r%u", sl.name, sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.a.mov(xArg1, xFrame);
+         em.loadFrameAddr(xArg2, sl.frInput1);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::createThis(
+    FR frRes,
+    FR frCallee,
+    FR frNewTarget,
+    uint8_t cacheIdx) {
+  comment(
+      "// CreateThis r%u, r%u, r%u, cache %u",
+      frRes.index(),
+      frCallee.index(),
+      frNewTarget.index(),
+      cacheIdx);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frCallee);
+  loadFrameAddr(xArg2, frNewTarget);
+  loadReadCacheEntry(xArg3, cacheIdx);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *,
+          SHLegacyValue *,
+          SHLegacyValue *,
+          SHReadPropertyCacheEntry *),
+      _sh_ljs_create_this);
+  movFRFromRet(frRes);
+}
+
+void Emitter::selectObject(FR frRes, FR frThis, FR frConstructed) {
+  comment(
+      "// SelectObject r%u, r%u, r%u",
+      frRes.index(),
+      frThis.index(),
+      frConstructed.index());
+  // If frConstructed is an object, use it, otherwise use frThis.
+  a.mov(xTmp0, frMem(frConstructed));
+  emit_sh_ljs_is_object(a, xTmp1, xTmp0);
+  a.cmovne(xTmp0, frMem(frThis));
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::loadThisNS(FR frRes) {
+  comment("// LoadThisNS r%u", frRes.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // Load the ThisArg from the stack. If it is an object, we are done.
+  a.mov(xTmp0, frameSlot(StackFrameLayout::ThisArg));
+  emit_sh_ljs_is_object(a, xTmp1, xTmp0);
+  a.jne(slowPathLab);
+  a.bind(contLab);
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Slow path: LoadThisNS r%u", sl.frRes.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.a.mov(xArg1, frameSlot(StackFrameLayout::ThisArg));
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHLegacyValue),
+             _sh_ljs_coerce_this_ns);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::coerceThisNS(FR frRes, FR frThis) {
+  comment("// CoerceThisNS r%u, r%u", frRes.index(), frThis.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // If the operand is an object, we are done, otherwise, go to the slow path.
+  a.mov(xTmp0, frMem(frThis));
+  emit_sh_ljs_is_object(a, xTmp1, xTmp0);
+  a.jne(slowPathLab);
+  a.bind(contLab);
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frThis,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: CoerceThis r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.a.mov(xArg1, frMem(sl.frInput1));
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHLegacyValue),
+             _sh_ljs_coerce_this_ns);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::debugger() {
+  comment("// Debugger");
+  if (dumpJitCode_ & DumpJitCode::BRK)
+    a.int3();
+}
+
+void Emitter::getNewTarget(FR frRes) {
+  comment("// GetNewTarget r%u", frRes.index());
+  a.mov(xTmp0, frameSlot(StackFrameLayout::NewTarget));
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::iteratorBegin(FR frRes, FR frSource) {
+  comment("// IteratorBegin r%u, r%u", frRes.index(), frSource.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frSource);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *),
+      _sh_ljs_iterator_begin_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::iteratorNext(FR frRes, FR frIteratorOrIdx, FR frSourceOrNext) {
+  comment(
+      "// IteratorNext r%u, r%u, r%u",
+      frRes.index(),
+      frIteratorOrIdx.index(),
+      frSourceOrNext.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frIteratorOrIdx);
+  loadFrameAddr(xArg2, frSourceOrNext);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, const SHLegacyValue *),
+      _sh_ljs_iterator_next_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::iteratorClose(FR frIteratorOrIdx, bool ignoreExceptions) {
+  comment(
+      "// IteratorClose r%u, %u", frIteratorOrIdx.index(), ignoreExceptions);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frIteratorOrIdx);
+  a.mov(xArg2.r32(), (uint32_t)ignoreExceptions);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, const SHLegacyValue *, bool),
+      _sh_ljs_iterator_close_rjs);
+}
+
+void Emitter::throwInst(FR frInput) {
+  comment("// Throw r%u", frInput.index());
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, frMem(frInput));
+  EMIT_RUNTIME_CALL(*this, void (*)(SHRuntime *, SHLegacyValue), _sh_throw);
+}
+
+void Emitter::throwIfEmptyUndefinedImpl(FR frRes, FR frInput, bool empty) {
+  comment(
+      "// %s r%u, r%u",
+      empty ? "ThrowIfEmpty" : "ThrowIfUndefined",
+      frRes.index(),
+      frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+
+  a.mov(xTmp0, frMem(frInput));
+  if (empty)
+    emit_sh_ljs_is_empty(a, xTmp1, xTmp0);
+  else
+    emit_sh_ljs_is_undefined(a, xTmp1, xTmp0);
+  a.je(slowPathLab);
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .name = empty ? "ThrowIfEmpty" : "ThrowIfUndefined",
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: %s r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         EMIT_RUNTIME_CALL(em, void (*)(SHRuntime *), _sh_throw_empty);
+         // Call does not return.
+       }});
+}
+
+void Emitter::throwIfThisInitialized(FR frInput) {
+  comment("// ThrowIfThisInitialized r%u", frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+
+  a.mov(xTmp0, frMem(frInput));
+  emit_sh_ljs_is_empty(a, xTmp0, xTmp0);
+  a.jne(slowPathLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: ThrowIfThisInitialized r%u", sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         EMIT_RUNTIME_CALL(
+             em, void (*)(SHRuntime *), _sh_throw_this_already_initialized);
+         // Call does not return.
+       }});
+}
+
+void Emitter::createRegExp(
+    FR frRes,
+    SHSymbolID patternID,
+    SHSymbolID flagsID,
+    uint32_t regexpID) {
+  comment("// CreateRegExp r%u, %u, %u", frRes.index(), patternID, flagsID);
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)codeBlock_,
+      JITRelocKind::CodeBlock,
+      0,
+      "CodeBlock");
+  loadSymbolID(xArg2, patternID);
+  loadSymbolID(xArg3, flagsID);
+  a.mov(xArg4.r32(), regexpID);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *, SHCodeBlock *, uint32_t, uint32_t, uint32_t),
+      _interpreter_create_regexp);
+  movFRFromRet(frRes);
+}
+
+void Emitter::loadParentNoTraps(FR frRes, FR frObj) {
+  comment("// LoadParentNoTraps r%u, r%u", frRes.index(), frObj.index());
+  asmjit::Label contLab = a.newLabel();
+
+  a.mov(xTmp0, frMem(frObj));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  emit_load_cp(a, xTmp0, x86::ptr(xTmp0, offsetof(SHJSObject, parent)));
+  // If the parent is nullptr, the result is null, otherwise it is the encoded
+  // pointer.
+  loadBits64InGp(xTmp1, _sh_ljs_null().raw, "null");
+  a.test(xTmp0, xTmp0);
+  a.jz(contLab);
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  a.mov(xTmp1, xTmp0);
+  emit_sh_ljs_object(a, xTmp1, xTmp2);
+  a.bind(contLab);
+  a.mov(frMem(frRes), xTmp1);
+}
+
+void Emitter::typedLoadParent(FR frRes, FR frObj) {
+  comment("// TypedLoadParent r%u, r%u", frRes.index(), frObj.index());
+  a.mov(xTmp0, frMem(frObj));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  emit_load_cp(a, xTmp0, x86::ptr(xTmp0, offsetof(SHJSObject, parent)));
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  emit_sh_ljs_object(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::typedStoreParent(FR frStoredValue, FR frObj) {
+  comment("// TypedStoreParent r%u, r%u", frStoredValue.index(), frObj.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frStoredValue);
+  loadFrameAddr(xArg2, frObj);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, const SHLegacyValue *, const SHLegacyValue *),
+      _sh_typed_store_parent);
+}
+
+void Emitter::putByValImpl(
+    FR frTarget,
+    FR frKey,
+    FR frValue,
+    const char *name,
+    void (*shImpl)(
+        SHRuntime *shr,
+        SHLegacyValue *target,
+        SHLegacyValue *key,
+        SHLegacyValue *value),
+    const char *shImplName) {
+  comment(
+      "// %s r%u, r%u, r%u",
+      name,
+      frTarget.index(),
+      frKey.index(),
+      frValue.index());
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+  asmjit::Label typedArrayLab = a.newLabel();
+
+  elementAccessChecks(frTarget, frKey, slowPathLab);
+#if !defined(HERMESVM_BOXED_DOUBLES) && !defined(HERMESVM_COMPRESSED_POINTERS)
+  static_assert(
+      HERMESVALUE_VERSION == 2,
+      "Pointer ETags are the highest, holes are HVETag_Empty");
+  a.cmp(xTmp2.r32(), (uint32_t)CellKind::JSArrayKind);
+  a.jne(typedArrayLab);
+  arrayElementAddr(slowPathLab, /* store */ true);
+  // Storing into a hole may call a setter in the prototype chain. Otherwise,
+  // a write barrier is only needed if the old or the new value is a pointer,
+  // or if the old value is a symbol, which the snapshot barrier must mark.
+  a.mov(xTmp2, x86::qword_ptr(xTmp0));
+  a.sar(xTmp2, kHV_NumDataBits - 1);
+  a.cmp(xTmp2.r32(), (int32_t)HVETag_Empty);
+  a.je(slowPathLab);
+  a.cmp(xTmp2.r32(), (int32_t)HVETag_Symbol);
+  a.je(slowPathLab);
+  a.cmp(xTmp2.r32(), (int32_t)HVETag_FirstPointer);
+  a.jae(slowPathLab);
+  a.mov(xTmp3, frMem(frValue));
+  a.mov(xTmp2, xTmp3);
+  a.sar(xTmp2, kHV_NumDataBits - 1);
+  a.cmp(xTmp2.r32(), (int32_t)HVETag_FirstPointer);
+  a.jae(slowPathLab);
+  a.mov(x86::qword_ptr(xTmp0), xTmp3);
+#else
+  // Array elements must be boxed, only typed arrays are handled inline.
+  a.jmp(typedArrayLab);
+#endif
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = typedArrayLab,
+       .contLab = contLab,
+       .target = slowPathLab,
+       .frInput1 = frValue,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Typed array: putByVal r%u", sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.typedArrayElementAccess(sl, /* store */ true);
+       }});
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frTarget,
+       .frInput1 = frKey,
+       .frInput2 = frValue,
+       .slowCall = (void *)shImpl,
+       .slowCallName = shImplName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: %s r%u, r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frRes);
+         em.loadFrameAddr(xArg2, sl.frInput1);
+         em.loadFrameAddr(xArg3, sl.frInput2);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::putByValWithReceiver(
+    FR frTarget,
+    FR frKey,
+    FR frValue,
+    FR frReceiver,
+    bool isStrict) {
+  comment(
+      "// PutByValWithReceiver r%u, r%u, r%u, r%u, %d",
+      frTarget.index(),
+      frKey.index(),
+      frValue.index(),
+      frReceiver.index(),
+      isStrict);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadFrameAddr(xArg2, frKey);
+  loadFrameAddr(xArg3, frValue);
+  loadFrameAddr(xArg4, frReceiver);
+  a.mov(xArg5.r32(), (uint32_t)isStrict);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(
+          SHRuntime *shr,
+          SHLegacyValue *target,
+          SHLegacyValue *key,
+          SHLegacyValue *value,
+          SHLegacyValue *receiver,
+          bool isStrict),
+      _sh_ljs_put_by_val_with_receiver_rjs);
+}
+
+void Emitter::delByVal(FR frRes, FR frTarget, FR frKey, bool strict) {
+  comment(
+      "// DelByVal r%u, r%u, r%u, %d",
+      frRes.index(),
+      frTarget.index(),
+      frKey.index(),
+      strict);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadFrameAddr(xArg2, frKey);
+  if (strict) {
+    EMIT_RUNTIME_CALL(
+        *this,
+        SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+        _sh_ljs_del_by_val_strict);
+  } else {
+    EMIT_RUNTIME_CALL(
+        *this,
+        SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+        _sh_ljs_del_by_val_loose);
+  }
+  movFRFromRet(frRes);
+}
+
+void Emitter::getByIdImpl(
+    FR frRes,
+    SHSymbolID symID,
+    FR frSource,
+    uint8_t cacheIdx,
+    const char *name,
+    SHLegacyValue (*shImpl)(
+        SHRuntime *shr,
+        const SHLegacyValue *source,
+        SHSymbolID symID,
+        SHReadPropertyCacheEntry *propCacheEntry),
+    const char *shImplName) {
+  comment(
+      "// %s r%u, r%u, cache %u, symID %u",
+      name,
+      frRes.index(),
+      frSource.index(),
+      cacheIdx,
+      symID);
+
+#if !defined(HERMESVM_BOXED_DOUBLES) && !defined(HERMESVM_COMPRESSED_POINTERS)
+  // SmallHermesValue has the same encoding as HermesValue here, so a property
+  // can be loaded inline when the hidden class matches the one recorded in the
+  // read cache.
+  static_assert(
+      sizeof(SHGCSmallHermesValue) == 8, "Property slots are scaled by 8");
+  if (cacheIdx != hbc::PROPERTY_CACHING_DISABLED) {
+    asmjit::Label slowPathLab = newSlowPathLabel();
+    asmjit::Label contLab = newContLabel();
+    asmjit::Label indirectLab = a.newLabel();
+
+    // xTmp0 = source, must be an object.
+    a.mov(xTmp0, frMem(frSource));
+    emit_sh_ljs_is_object(a, xTmp1, xTmp0);
+    a.jne(slowPathLab);
+    // xTmp0 is the pointer to the object.
+    emit_sh_ljs_get_pointer(a, xTmp0);
+
+    // xTmp2 points to the cache entry.
+    a.mov(xTmp2, roData(roOfsReadPropertyCachePtr_));
+    if (cacheIdx != 0)
+      a.add(xTmp2, (int32_t)(sizeof(SHReadPropertyCacheEntry) * cacheIdx));
+
+    // Compare the hidden class of the object with the cached one.
+    emit_load_cp(a, xTmp1, x86::ptr(xTmp0, offsetof(SHJSObject, clazz)));
+    emit_load_cp(
+        a, xTmp3, x86::ptr(xTmp2, offsetof(SHReadPropertyCacheEntry, clazz)));
+    a.cmp(xTmp1, xTmp3);
+    a.jne(slowPathLab);
+
+    // Hidden class matches. Fetch the slot.
+    a.mov(
+        xTmp1.r32(),
+        x86::dword_ptr(xTmp2, offsetof(SHReadPropertyCacheEntry, slot)));
+    a.cmp(xTmp1.r32(), HERMESVM_DIRECT_PROPERTY_SLOTS);
+    a.jae(indirectLab);
+
+    // Load from a direct slot.
+    a.mov(
+        xTmp0,
+        x86::qword_ptr(
+            xTmp0,
+            xTmp1,
+            3,
+            offsetof(SHJSObjectAndDirectProps, directProps)));
+    a.mov(frMem(frRes), xTmp0);
+    a.jmp(contLab);
+
+    // Load from an indirect slot.
+    a.bind(indirectLab);
+    emit_load_cp(a, xTmp0, x86::ptr(xTmp0, offsetof(SHJSObject, propStorage)));
+    emit_sh_cp_decode_non_null(a, xTmp0);
+    constexpr int32_t ofs = (int32_t)offsetof(SHArrayStorageSmall, storage) -
+        HERMESVM_DIRECT_PROPERTY_SLOTS * (int32_t)sizeof(SHGCSmallHermesValue);
+    a.mov(xTmp0, x86::qword_ptr(xTmp0, xTmp1, 3, ofs));
+    a.mov(frMem(frRes), xTmp0);
+    a.bind(contLab);
+
+    slowPaths_.push_back(
+        {.slowPathLab = slowPathLab,
+         .contLab = contLab,
+         .name = name,
+         .frRes = frRes,
+         .frInput1 = frSource,
+         .invert = false,
+         .passArgsByVal = false,
+         .slowCall = (void *)shImpl,
+         .slowCallName = shImplName,
+         .symID = symID,
+         .cacheIdx = cacheIdx,
+         .emittingIP = emittingIP,
+         .emit = [](Emitter &em, SlowPath &sl) {
+           em.comment(
+               "// Slow path: %s r%u, r%u",
+               sl.name,
+               sl.frRes.index(),
+               sl.frInput1.index());
+           em.a.bind(sl.slowPathLab);
+           em.a.mov(xArg0, xRuntime);
+           em.loadFrameAddr(xArg1, sl.frInput1);
+           em.loadSymbolID(xArg2, sl.symID);
+           em.loadReadCacheEntry(xArg3, sl.cacheIdx);
+           em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+           em.movFRFromRet(sl.frRes);
+           em.a.jmp(sl.contLab);
+         }});
+    return;
+  }
+#endif
+
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frSource);
+  loadSymbolID(xArg2, symID);
+  loadReadCacheEntry(xArg3, cacheIdx);
+  callWithSavedIP((void *)shImpl, shImplName);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getByIdWithReceiver(
+    FR frRes,
+    SHSymbolID symID,
+    FR frSource,
+    FR frReceiver,
+    uint8_t cacheIdx) {
+  comment(
+      "// GetByIdWithReceiver r%u, r%u, r%u, cache %u, symID %u",
+      frRes.index(),
+      frSource.index(),
+      frReceiver.index(),
+      cacheIdx,
+      symID);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frSource);
+  loadFrameAddr(xArg2, frReceiver);
+  loadSymbolID(xArg3, symID);
+  loadReadCacheEntry(xArg4, cacheIdx);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime * shr,
+          const SHLegacyValue *source,
+          const SHLegacyValue *receiver,
+          SHSymbolID symID,
+          SHReadPropertyCacheEntry *propCacheEntry),
+      _sh_ljs_get_by_id_with_receiver_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getByValWithReceiver(
+    FR frRes,
+    FR frSource,
+    FR frKey,
+    FR frReceiver) {
+  comment(
+      "// GetByValWithReceiver r%u, r%u, r%u, r%u",
+      frRes.index(),
+      frSource.index(),
+      frReceiver.index(),
+      frKey.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frSource);
+  loadFrameAddr(xArg2, frKey);
+  loadFrameAddr(xArg3, frReceiver);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime * shr,
+          SHLegacyValue * source,
+          SHLegacyValue * key,
+          SHLegacyValue * receiver),
+      _sh_ljs_get_by_val_with_receiver_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getByVal(FR frRes, FR frSource, FR frKey) {
+  comment(
+      "// getByVal r%u, r%u, r%u",
+      frRes.index(),
+      frSource.index(),
+      frKey.index());
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+  asmjit::Label typedArrayLab = a.newLabel();
+
+  elementAccessChecks(frSource, frKey, slowPathLab);
+#if !defined(HERMESVM_BOXED_DOUBLES) && !defined(HERMESVM_COMPRESSED_POINTERS)
+  a.cmp(xTmp2.r32(), (uint32_t)CellKind::JSArrayKind);
+  a.jne(typedArrayLab);
+  arrayElementAddr(slowPathLab, /* store */ false);
+  a.mov(xTmp0, x86::qword_ptr(xTmp0));
+  // Holes need a lookup in the prototype chain.
+  emit_sh_ljs_is_empty(a, xTmp2, xTmp0);
+  a.je(slowPathLab);
+  a.mov(frMem(frRes), xTmp0);
+#else
+  // Array elements must be unboxed, only typed arrays are handled inline.
+  a.jmp(typedArrayLab);
+#endif
+  a.bind(contLab);
+
+  // Typed arrays are less common, so their elements are accessed out of line.
+  slowPaths_.push_back(
+      {.slowPathLab = typedArrayLab,
+       .contLab = contLab,
+       .target = slowPathLab,
+       .frRes = frRes,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Typed array: getByVal r%u", sl.frRes.index());
+         em.a.bind(sl.slowPathLab);
+         em.typedArrayElementAccess(sl, /* store */ false);
+       }});
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frSource,
+       .frInput2 = frKey,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: getByVal r%u, r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         em.loadFrameAddr(xArg2, sl.frInput2);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+             _sh_ljs_get_by_val_rjs);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::elementAccessChecks(
+    FR frObj,
+    FR frKey,
+    const asmjit::Label &slowPathLab) {
+  // xTmp1 = the key, which must be a uint32 number.
+  a.movsd(x86::xmm1, frMem(frKey));
+  emit_double_is_uint32(a, xTmp1, x86::xmm0, x86::xmm1);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+  // xTmp0 = pointer to the object.
+  a.mov(xTmp0, frMem(frObj));
+  emit_sh_ljs_is_object(a, xTmp2, xTmp0);
+  a.jne(slowPathLab);
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  emit_gccell_get_kind(a, xTmp2, xTmp0);
+}
+
+void Emitter::arrayElementAddr(const asmjit::Label &slowPathLab, bool store) {
+  // Elements are all in the indexed storage only with fast index properties,
+  // and frozen arrays can't be written.
+  SHObjectFlags fastIndex{};
+  fastIndex.fastIndexProperties = 1;
+  if (!store) {
+    a.test(x86::dword_ptr(xTmp0, offsetof(SHJSObject, flags)), fastIndex.bits);
+    a.jz(slowPathLab);
+  } else {
+    SHObjectFlags frozen{};
+    frozen.frozen = 1;
+    a.mov(xTmp2.r32(), x86::dword_ptr(xTmp0, offsetof(SHJSObject, flags)));
+    a.and_(xTmp2.r32(), fastIndex.bits | frozen.bits);
+    a.cmp(xTmp2.r32(), fastIndex.bits);
+    a.jne(slowPathLab);
+  }
+
+  // xTmp2 = index in the storage, which must be in [beginIndex, endIndex).
+  a.cmp(xTmp1.r32(), x86::dword_ptr(xTmp0, RuntimeOffsets::arrayEndIndex));
+  a.jae(slowPathLab);
+  a.mov(xTmp2.r32(), xTmp1.r32());
+  a.sub(xTmp2.r32(), x86::dword_ptr(xTmp0, RuntimeOffsets::arrayBeginIndex));
+  a.jb(slowPathLab);
+  // The range isn't empty, so there is a storage.
+  emit_load_cp(
+      a, xTmp0, x86::ptr(xTmp0, RuntimeOffsets::arrayIndexedStorage));
+  emit_sh_cp_decode_non_null(a, xTmp0);
+
+  asmjit::Label segmentLab = a.newLabel();
+  asmjit::Label addrLab = a.newLabel();
+  a.cmp(xTmp2.r32(), SegmentedArraySmall::kValueToSegmentThreshold);
+  a.jae(segmentLab);
+  a.lea(
+      xTmp0,
+      x86::ptr(xTmp0, xTmp2, 3, RuntimeOffsets::segmentedArrayInlineStorage));
+  a.bind(addrLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = segmentLab,
+       .contLab = addrLab,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         using Segment = SegmentedArraySmall::Segment;
+         static_assert(
+             llvh::isPowerOf2_32(Segment::kMaxLength),
+             "Segment index is computed with a shift");
+         auto &a = em.a;
+         em.comment("// Array segment");
+         a.bind(sl.slowPathLab);
+         // xTmp3 = segment number, xTmp2 = index in the segment.
+         a.sub(xTmp2.r32(), SegmentedArraySmall::kValueToSegmentThreshold);
+         a.mov(xTmp3.r32(), xTmp2.r32());
+         a.shr(xTmp3.r32(), llvh::Log2_32(Segment::kMaxLength));
+         a.and_(xTmp2.r32(), Segment::kMaxLength - 1);
+         // The segments are stored as objects after the inline storage.
+         a.mov(
+             xTmp0,
+             x86::qword_ptr(
+                 xTmp0,
+                 xTmp3,
+                 3,
+                 RuntimeOffsets::segmentedArrayInlineStorage +
+                     SegmentedArraySmall::kValueToSegmentThreshold *
+                         sizeof(SHGCSmallHermesValue)));
+         emit_sh_ljs_get_pointer(a, xTmp0);
+         a.lea(xTmp0, x86::ptr(xTmp0, xTmp2, 3, RuntimeOffsets::segmentData));
+         a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::typedArrayElementAccess(const SlowPath &sl, bool store) {
+  // Entered with xTmp0 = pointer to the object, xTmp1 = index, and xTmp2 =
+  // CellKind. sl.target is the generic slow path.
+  emit_cellkind_in_range(
+      a,
+      xTmp2,
+      CellKind::TypedArrayBaseKind_first,
+      CellKind::TypedArrayBaseKind_last);
+  a.ja(sl.target);
+  a.cmp(xTmp1.r32(), x86::dword_ptr(xTmp0, RuntimeOffsets::typedArrayLength));
+  a.jae(sl.target);
+
+  // xTmp3 = start of the elements. The buffer may be missing or detached.
+  a.mov(xTmp3.r32(), x86::dword_ptr(xTmp0, RuntimeOffsets::typedArrayOffset));
+  emit_load_cp(a, xTmp0, x86::ptr(xTmp0, RuntimeOffsets::typedArrayBuffer));
+  a.test(xTmp0, xTmp0);
+  a.jz(sl.target);
+  emit_sh_cp_decode_non_null(a, xTmp0);
+  a.cmp(x86::byte_ptr(xTmp0, RuntimeOffsets::arrayBufferAttached), 0);
+  a.je(sl.target);
+  a.add(xTmp3, x86::qword_ptr(xTmp0, RuntimeOffsets::arrayBufferData));
+  if (store)
+    a.movsd(x86::xmm1, frMem(sl.frInput1));
+
+  // Dispatch on the kind, xTmp2 is its index in kTypedArrayElements. BigInts
+  // are allocated, so they are left to the slow path.
+  asmjit::Label tableLab = a.newLabel();
+  a.lea(xTmp0, x86::ptr(tableLab));
+  a.movsxd(xTmp2, x86::dword_ptr(xTmp0, xTmp2, 2));
+  a.add(xTmp2, xTmp0);
+  a.jmp(xTmp2);
+
+  auto isBigInt = [](const TypedArrayElement &elem) {
+    return !elem.isFloat && elem.size == 8;
+  };
+  llvh::SmallVector<asmjit::Label, 16> kindLabs{};
+  for (const TypedArrayElement &elem : kTypedArrayElements)
+    kindLabs.push_back(isBigInt(elem) ? sl.target : a.newLabel());
+  a.align(asmjit::AlignMode::kData, 4);
+  a.bind(tableLab);
+  for (const asmjit::Label &lab : kindLabs)
+    a.embedLabelDelta(lab, tableLab, /* size */ 4);
+
+  // Loads convert the element to a double in xmm0 and jump here.
+  asmjit::Label loadedLab = store ? asmjit::Label{} : a.newLabel();
+  for (size_t i = 0; i < std::size(kTypedArrayElements); ++i) {
+    const TypedArrayElement &elem = kTypedArrayElements[i];
+    if (isBigInt(elem))
+      continue;
+    a.bind(kindLabs[i]);
+    x86::Mem mem = x86::ptr(xTmp3, xTmp1, llvh::Log2_32(elem.size));
+    mem.setSize(elem.size);
+
+    if (!store) {
+      if (elem.isFloat) {
+        if (elem.size == 4)
+          a.cvtss2sd(x86::xmm0, mem);
+        else
+          a.movsd(x86::xmm0, mem);
+        // NaN must be canonicalized, leave it to the slow path.
+        a.ucomisd(x86::xmm0, x86::xmm0);
+        a.jp(sl.target);
+      } else {
+        if (elem.size == 4 && !elem.isSigned)
+          a.mov(xTmp0.r32(), mem);
+        else if (elem.size == 4)
+          a.movsxd(xTmp0, mem);
+        else if (elem.isSigned)
+          a.movsx(xTmp0, mem);
+        else
+          a.movzx(xTmp0.r32(), mem);
+        a.cvtsi2sd(x86::xmm0, xTmp0);
+      }
+      a.jmp(loadedLab);
+      continue;
+    }
+
+    // Stores require the value in xmm1 to be a number, since converting other
+    // values may have side effects. All other values are NaNs.
+    if (elem.isFloat) {
+      a.ucomisd(x86::xmm1, x86::xmm1);
+      a.jp(sl.target);
+      if (elem.size == 4) {
+        a.cvtsd2ss(x86::xmm0, x86::xmm1);
+        a.movss(mem, x86::xmm0);
+      } else {
+        a.movsd(mem, x86::xmm1);
+      }
+      a.jmp(sl.contLab);
+      continue;
+    }
+    // Integers are truncated modulo 2^n, which is what the low bits of the
+    // 64-bit conversion contain. NaN and out of range values convert to
+    // INT64_MIN, the only value that overflows when decremented.
+    if (elem.kind == CellKind::Uint8ClampedArrayKind) {
+      // Clamped values are rounded to nearest, ties to even.
+      a.cvtsd2si(xTmp0, x86::xmm1);
+      a.cmp(xTmp0, 1);
+      a.jo(sl.target);
+      a.xor_(xTmp2.r32(), xTmp2.r32());
+      a.test(xTmp0, xTmp0);
+      a.cmovs(xTmp0, xTmp2);
+      a.mov(xTmp2.r32(), 255);
+      a.cmp(xTmp0, 255);
+      a.cmovg(xTmp0, xTmp2);
+    } else {
+      a.cvttsd2si(xTmp0, x86::xmm1);
+      a.cmp(xTmp0, 1);
+      a.jo(sl.target);
+    }
+    switch (elem.size) {
+      case 1:
+        a.mov(mem, xTmp0.r8());
+        break;
+      case 2:
+        a.mov(mem, xTmp0.r16());
+        break;
+      default:
+        a.mov(mem, xTmp0.r32());
+        break;
+    }
+    a.jmp(sl.contLab);
+  }
+
+  if (!store) {
+    a.bind(loadedLab);
+    a.movsd(frMem(sl.frRes), x86::xmm0);
+    a.jmp(sl.contLab);
+  }
+}
+
+void Emitter::getByIndex(FR frRes, FR frSource, uint32_t key) {
+  comment("// getByIdx r%u, r%u, %u", frRes.index(), frSource.index(), key);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frSource);
+  a.mov(xArg2.r32(), key);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, uint32_t),
+      _sh_ljs_get_by_index_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::putByIdImpl(
+    FR frTarget,
+    SHSymbolID symID,
+    FR frValue,
+    uint8_t cacheIdx,
+    const char *name,
+    void (*shImpl)(
+        SHRuntime *shr,
+        SHLegacyValue *target,
+        SHSymbolID symID,
+        SHLegacyValue *value,
+        SHWritePropertyCacheEntry *propCacheEntry),
+    const char *shImplName) {
+  comment(
+      "// %s r%u, r%u, cache %u, symID %u",
+      name,
+      frTarget.index(),
+      frValue.index(),
+      cacheIdx,
+      symID);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadSymbolID(xArg2, symID);
+  loadFrameAddr(xArg3, frValue);
+  loadWriteCacheEntry(xArg4, cacheIdx);
+  callWithSavedIP((void *)shImpl, shImplName);
+}
+
+asmjit::Label Emitter::newPrefLabel(const char *pref, size_t index) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%s%lu", pref, index);
+  // Continuation labels of instructions that didn't need a slow path don't
+  // advance the index, so the name may already be taken.
+  if (code.labelIdByName(buf) != asmjit::Globals::kInvalidId)
+    snprintf(buf, sizeof(buf), "%s%lu_%u", pref, index, code.labelCount());
+  return a.newNamedLabel(buf);
+}
+
+void Emitter::defineOwnById(
+    FR frTarget,
+    SHSymbolID symID,
+    FR frValue,
+    uint8_t cacheIdx) {
+  comment(
+      "// defineOwnById r%u, r%u, cache %u, symID %u",
+      frTarget.index(),
+      frValue.index(),
+      cacheIdx,
+      symID);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadSymbolID(xArg2, symID);
+  loadFrameAddr(xArg3, frValue);
+  loadWriteCacheEntry(xArg4, cacheIdx);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(
+          SHRuntime *shr,
+          SHLegacyValue *target,
+          SHSymbolID key,
+          SHLegacyValue *value,
+          SHWritePropertyCacheEntry *cacheEntrySHRuntime),
+      _sh_ljs_define_own_by_id);
+}
+
+void Emitter::defineOwnByIndex(FR frTarget, FR frValue, uint32_t key) {
+  comment(
+      "// putOwnByIdx r%u, r%u, %u", frTarget.index(), frValue.index(), key);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  a.mov(xArg2.r32(), key);
+  loadFrameAddr(xArg3, frValue);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(SHRuntime *, SHLegacyValue *, uint32_t, SHLegacyValue *),
+      _sh_ljs_define_own_by_index);
+}
+
+void Emitter::defineOwnByVal(
+    FR frTarget,
+    FR frValue,
+    FR frKey,
+    bool enumerable) {
+  comment(
+      "// DefineOwnByVal r%u, r%u, r%u",
+      frTarget.index(),
+      frValue.index(),
+      frKey.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadFrameAddr(xArg2, frKey);
+  loadFrameAddr(xArg3, frValue);
+  if (enumerable) {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(
+            SHRuntime *, SHLegacyValue *, SHLegacyValue *, SHLegacyValue *),
+        _sh_ljs_define_own_by_val);
+  } else {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(
+            SHRuntime *, SHLegacyValue *, SHLegacyValue *, SHLegacyValue *),
+        _sh_ljs_define_own_ne_by_val);
+  }
+}
+
+void Emitter::defineOwnGetterSetterByVal(
+    FR frTarget,
+    FR frKey,
+    FR frGetter,
+    FR frSetter,
+    bool enumerable) {
+  comment(
+      "// DefineOwnGetterSetterByVal r%u, r%u, r%u, r%u, %d",
+      frTarget.index(),
+      frKey.index(),
+      frGetter.index(),
+      frSetter.index(),
+      enumerable);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  loadFrameAddr(xArg2, frKey);
+  loadFrameAddr(xArg3, frGetter);
+  loadFrameAddr(xArg4, frSetter);
+  a.mov(xArg5.r32(), (uint32_t)enumerable);
+  EMIT_RUNTIME_CALL(
+      *this,
+      void (*)(
+          SHRuntime *shr,
+          SHLegacyValue *target,
+          SHLegacyValue *key,
+          SHLegacyValue *getter,
+          SHLegacyValue *setter,
+          bool enumerable),
+      _sh_ljs_define_own_getter_setter_by_val);
+}
+
+void Emitter::getOwnBySlotIdx(FR frRes, FR frTarget, uint32_t slotIdx) {
+  comment(
+      "// GetOwnBySlotIdx r%u, r%u, %u",
+      frRes.index(),
+      frTarget.index(),
+      slotIdx);
+
+#if !defined(HERMESVM_BOXED_DOUBLES) && !defined(HERMESVM_COMPRESSED_POINTERS)
+  size_t ofs;
+  a.mov(xTmp0, frMem(frTarget));
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  if (slotIdx < JSObject::DIRECT_PROPERTY_SLOTS) {
+    // If the slot is in the direct property slots, load it directly.
+    ofs = offsetof(SHJSObjectAndDirectProps, directProps) +
+        slotIdx * sizeof(SHGCSmallHermesValue);
+  } else {
+    // If the slot is in indirect storage, retrieve the pointer to that storage.
+    emit_load_cp(
+        a, xTmp0, x86::ptr(xTmp0, offsetof(SHJSObject, propStorage)));
+    emit_sh_cp_decode_non_null(a, xTmp0);
+    auto storageSlot = slotIdx - JSObject::DIRECT_PROPERTY_SLOTS;
+    ofs = offsetof(SHArrayStorageSmall, storage) +
+        storageSlot * sizeof(SHGCSmallHermesValue);
+  }
+  a.mov(xTmp0, x86::qword_ptr(xTmp0, (int32_t)ofs));
+  a.mov(frMem(frRes), xTmp0);
+#else
+  // Decoding a SmallHermesValue requires boxing doubles, leave it to the
+  // runtime.
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, frMem(frTarget));
+  if (slotIdx < JSObject::DIRECT_PROPERTY_SLOTS) {
+    a.mov(xArg2.r32(), slotIdx);
+    EMIT_RUNTIME_CALL(
+        *this,
+        SHLegacyValue(*)(SHRuntime *, SHLegacyValue, uint32_t),
+        _sh_prload_direct);
+  } else {
+    a.mov(xArg2.r32(), slotIdx - JSObject::DIRECT_PROPERTY_SLOTS);
+    EMIT_RUNTIME_CALL(
+        *this,
+        SHLegacyValue(*)(SHRuntime *, SHLegacyValue, uint32_t),
+        _sh_prload_indirect);
+  }
+  movFRFromRet(frRes);
+#endif
+}
+
+void Emitter::putOwnBySlotIdx(FR frTarget, FR frValue, uint32_t slotIdx) {
+  comment(
+      "// PutOwnBySlotIdx r%u, r%u, %u",
+      frTarget.index(),
+      frValue.index(),
+      slotIdx);
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frTarget);
+  // For indirect stores, 0 is the first indirect index.
+  a.mov(
+      xArg2.r32(),
+      slotIdx < JSObject::DIRECT_PROPERTY_SLOTS
+          ? slotIdx
+          : slotIdx - JSObject::DIRECT_PROPERTY_SLOTS);
+  loadFrameAddr(xArg3, frValue);
+  if (slotIdx < JSObject::DIRECT_PROPERTY_SLOTS) {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(SHRuntime *, SHLegacyValue *, uint32_t, SHLegacyValue *),
+        _sh_prstore_direct);
+  } else {
+    EMIT_RUNTIME_CALL(
+        *this,
+        void (*)(SHRuntime *, SHLegacyValue *, uint32_t, SHLegacyValue *),
+        _sh_prstore_indirect);
+  }
+}
+
+void Emitter::instanceOf(FR frRes, FR frLeft, FR frRight) {
+  comment(
+      "// InstanceOf r%u, r%u, r%u",
+      frRes.index(),
+      frLeft.index(),
+      frRight.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frLeft);
+  loadFrameAddr(xArg2, frRight);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+      _sh_ljs_instance_of_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::isIn(FR frRes, FR frLeft, FR frRight) {
+  comment(
+      "// isIn r%u, r%u, r%u", frRes.index(), frLeft.index(), frRight.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frLeft);
+  loadFrameAddr(xArg2, frRight);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+      _sh_ljs_is_in_rjs);
+  movFRFromRet(frRes);
+}
+
+int32_t Emitter::reserveData(
+    int32_t dsize,
+    size_t align,
+    asmjit::TypeId typeId,
+    int32_t itemCount,
+    const char *comment) {
+  // Align the new data.
+  size_t oldSize = roData_.size();
+  size_t dataOfs = (roData_.size() + align - 1) & ~(align - 1);
+  if (dataOfs >= INT32_MAX)
+    hermes::hermes_fatal("JIT RO data overflow");
+  // Grow to include the data.
+  roData_.resize(dataOfs + dsize);
+
+  // If logging is enabled, generate data descriptors.
+  if (hasLogger()) {
+    // Optional padding descriptor.
+    if (dataOfs != oldSize) {
+      int32_t gap = (int32_t)(dataOfs - oldSize);
+      roDataDesc_.push_back(
+          {.size = gap, .typeId = asmjit::TypeId::kUInt8, .itemCount = gap});
+    }
+
+    roDataDesc_.push_back(
+        {.size = dsize,
+         .typeId = typeId,
+         .itemCount = itemCount,
+         .comment = comment});
+  }
+
+  return (int32_t)dataOfs;
+}
+
+/// Register a 64-bit constant in RO DATA and return its offset.
+int32_t Emitter::uint64Const(uint64_t bits, const char *comment) {
+  auto [it, inserted] = fp64ConstMap_.try_emplace(bits, 0);
+  if (inserted) {
+    int32_t dataOfs = reserveData(
+        sizeof(double), sizeof(double), asmjit::TypeId::kFloat64, 1, comment);
+    memcpy(roData_.data() + dataOfs, &bits, sizeof(double));
+    it->second = dataOfs;
+  }
+  return it->second;
+}
+
+int32_t Emitter::relocatableConst(
+    uint64_t bits,
+    JITRelocKind kind,
+    const char *comment) {
+  // Not shared with uint64Const(), since the slot is patched.
+  int32_t dataOfs = reserveData(
+      sizeof(bits), sizeof(bits), asmjit::TypeId::kUInt64, 1, comment);
+  memcpy(roData_.data() + dataOfs, &bits, sizeof(bits));
+  roDataRelocs_.push_back({(uint32_t)dataOfs, sizeof(bits), kind, 0});
+  return dataOfs;
+}
+
+int32_t Emitter::registerCallTarget(void *fn, const char *name) {
+  auto [it, inserted] = callTargetMap_.try_emplace(fn, 0);
+  // Is this a new call target?
+  if (inserted) {
+    int32_t dataOfs =
+        reserveData(sizeof(fn), sizeof(fn), asmjit::TypeId::kUInt64, 1, name);
+    memcpy(roData_.data() + dataOfs, &fn, sizeof(fn));
+    roDataRelocs_.push_back(
+        {(uint32_t)dataOfs,
+         sizeof(fn),
+         JITRelocKind::FunctionPtr,
+         (uint64_t)fn});
+    it->second = dataOfs;
+  }
+  return it->second;
+}
+
+void Emitter::emitOSREntry(llvh::ArrayRef<OSRTarget> osrTargets) {
+  if (osrTargets.empty())
+    return;
+
+  osrEntryLabel_ = a.newNamedLabel("OSR_ENTRY");
+  a.bind(osrEntryLabel_);
+  comment("// OSR entry");
+
+  // The frame has already been allocated and populated by the interpreter, so
+  // only the native part of the frame needs to be set up.
+  saveRegistersAndCheckStack();
+  comment("// xFrame");
+  a.mov(xFrame, x86::qword_ptr(xRuntime, RuntimeOffsets::currentFrame));
+  enterTryAndLogEntry();
+
+  // The interpreter stores the IP of the loop header in runtime.currentIP.
+  comment("// dispatch to loop header");
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::currentIP));
+  for (const OSRTarget &target : osrTargets) {
+    loadRelocatable(
+        xTmp1,
+        (uint64_t)target.ip,
+        JITRelocKind::BytecodeIP,
+        (const uint8_t *)target.ip - codeBlock_->begin(),
+        "IP");
+    a.cmp(xTmp0, xTmp1);
+    a.je(*target.label);
+  }
+  EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(*this, void (*)(), _sh_unreachable);
+}
+
+JITCompiledFunctionPtr Emitter::getOSREntry(JITCompiledFunctionPtr fn) {
+  if (!osrEntryLabel_.isValid())
+    return nullptr;
+  return reinterpret_cast<JITCompiledFunctionPtr>(
+      reinterpret_cast<uintptr_t>(fn) +
+      code.labelOffsetFromBase(osrEntryLabel_));
+}
+
+bool Emitter::getCodeImage(JITCompiledFunctionPtr fn, JITCodeImage &image) {
+  const uint8_t *start = (const uint8_t *)fn;
+  image.code.assign(start, start + code.codeSize());
+  image.relocs = relocs_;
+  uint64_t roDataStart = code.labelOffsetFromBase(roDataLabel_);
+  for (JITReloc reloc : roDataRelocs_) {
+    reloc.offset += roDataStart;
+    if (reloc.kind == JITRelocKind::FunctionPtr &&
+        !JITCodeCache::functionPayload(
+            (const void *)reloc.payload, reloc.payload)) {
+      return false;
+    }
+    image.relocs.push_back(reloc);
+  }
+  image.osrEntryOffset = osrEntryLabel_.isValid()
+      ? code.labelOffsetFromBase(osrEntryLabel_)
+      : JITCodeImage::kNoOSREntry;
+  return true;
+}
+
+void Emitter::emitCatchTable(
+    llvh::ArrayRef<const asmjit::Label *> exceptionHandlers) {
+  // No trys in the function, nothing to do here.
+  if (!catchTableLabel_.isValid())
+    return;
+
+  a.bind(catchTableLabel_);
+
+  asmjit::Label addressTableLab = a.newLabel();
+
+  // Find the catch target for the exception. longjmp() has restored the
+  // callee-saved registers and the stack pointer, so the frame is intact.
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)codeBlock_,
+      JITRelocKind::CodeBlock,
+      0,
+      "CodeBlock");
+  a.mov(xArg2, xFrame);
+  a.lea(xArg3, x86::ptr(x86::rsp, getJmpBufOffset()));
+  a.mov(xArg4, x86::qword_ptr(x86::rsp, getSavedSHLocalsOffset()));
+  a.lea(xArg5, x86::ptr(addressTableLab));
+  EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+      *this,
+      void *(*)(SHRuntime *,
+                SHCodeBlock *,
+                SHLegacyValue *,
+                SHJmpBuf *,
+                SHLocals *,
+                int32_t *),
+      _jit_find_catch_target);
+
+  // The address to jump to was returned here.
+  a.jmp(x86::rax);
+
+  // Table of offsets from addressTableLab to jump to.
+  a.align(asmjit::AlignMode::kData, 4);
+  a.bind(addressTableLab);
+  for (const asmjit::Label *handler : exceptionHandlers) {
+    a.embedLabelDelta(*handler, addressTableLab, /* size */ 4);
+  }
+}
+
+asmjit::Label Emitter::newDeoptPath() {
+  asmjit::Label deoptLab = newPrefLabel("DEOPT_", slowPaths_.size());
+  slowPaths_.push_back(
+      {.slowPathLab = deoptLab,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment("// Deoptimize");
+         em.a.bind(sl.slowPathLab);
+         if (em.catchTableLabel_.isValid()) {
+           // The interpreter handles the exceptions of the frame from now on,
+           // and exceptions that escape it must not be caught here.
+           // shr->shCurJmpBuf = buf->prev
+           em.a.mov(
+               xTmp0,
+               x86::qword_ptr(
+                   x86::rsp,
+                   em.getJmpBufOffset() + offsetof(SHJmpBuf, prev)));
+           em.a.mov(
+               x86::qword_ptr(xRuntime, offsetof(SHRuntime, shCurJmpBuf)),
+               xTmp0);
+         }
+         em.a.mov(xArg0, xRuntime);
+         em.loadRelocatable(
+             xArg1,
+             (uint64_t)em.codeBlock_,
+             JITRelocKind::CodeBlock,
+             0,
+             "CodeBlock");
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHCodeBlock *),
+             _jit_deoptimize);
+         // The frame has been popped by the interpreter, popping it again in
+         // the epilogue is harmless.
+         em.a.mov(xRetVal, x86::rax);
+         em.a.jmp(em.returnLabel_);
+       }});
+  return deoptLab;
+}
+
+void Emitter::emitSlowPaths() {
+  while (!slowPaths_.empty()) {
+    SlowPath &sp = slowPaths_.front();
+    emittingIP = sp.emittingIP;
+    sp.emit(*this, sp);
+    slowPaths_.pop_front();
+  }
+  emittingIP = nullptr;
+}
+
+void Emitter::emitROData() {
+  // Keep the doubles and pointers naturally aligned.
+  a.align(asmjit::AlignMode::kData, 16);
+  a.bind(roDataLabel_);
+  if (!hasLogger()) {
+    a.embed(roData_.data(), roData_.size());
+  } else {
+    int32_t ofs = 0;
+    for (const auto &desc : roDataDesc_) {
+      if (desc.comment)
+        comment("// %s", desc.comment);
+      a.embedDataArray(desc.typeId, roData_.data() + ofs, desc.itemCount);
+      ofs += desc.size;
+    }
+  }
+}
+
+void Emitter::callImpl(FR frRes, FR frCallee) {
+  uint32_t nRegs = numFrameRegs_;
+
+  FR calleeFrameArg{nRegs + hbc::StackFrameLayout::CalleeClosureOrCB};
+  // Store the callee to the right location in the frame, if it isn't already
+  // there.
+  if (frCallee != calleeFrameArg) {
+    a.mov(xTmp0, frMem(frCallee));
+    a.mov(frMem(calleeFrameArg), xTmp0);
+  }
+
+  static_assert(
+      HERMESVALUE_VERSION == 2,
+      "Native pointers must be encoded without modification");
+
+  FR previousFrameArg{nRegs + hbc::StackFrameLayout::PreviousFrame};
+  a.mov(frMem(previousFrameArg), xFrame);
+
+  // Save the current IP in both the SavedIP slot and the runtime.
+  FR savedIPArg{nRegs + hbc::StackFrameLayout::SavedIP};
+  getBytecodeIP(xTmp0);
+  a.mov(frMem(savedIPArg), xTmp0);
+  a.mov(x86::qword_ptr(xRuntime, RuntimeOffsets::currentIP), xTmp0);
+
+  FR savedCodeBlockArg{nRegs + hbc::StackFrameLayout::SavedCodeBlock};
+  a.mov(frMem(savedCodeBlockArg), 0);
+  FR shLocalsArg{nRegs + hbc::StackFrameLayout::SHLocals};
+  a.mov(frMem(shLocalsArg), 0);
+
+  auto slowPathLab = newSlowPathLabel();
+  auto contLab = newContLabel();
+
+  // Check if the callee is a JSFunction we have already JITted.
+  a.mov(xTmp0, frMem(calleeFrameArg));
+  emit_sh_ljs_is_object(a, xTmp1, xTmp0);
+  a.jne(slowPathLab);
+  emit_sh_ljs_get_pointer(a, xTmp0);
+  emit_gccell_get_kind(a, xTmp1, xTmp0);
+
+  // Check if it is a JSFunction.
+  emit_cellkind_in_range(
+      a,
+      xTmp1,
+      CellKind::CodeBlockFunctionKind_first,
+      CellKind::CodeBlockFunctionKind_last);
+  a.ja(slowPathLab);
+
+  // Check if the JSFunction has already been JIT compiled.
+  a.mov(xTmp1, x86::qword_ptr(xTmp0, RuntimeOffsets::jsFunctionCodeBlock));
+  a.mov(xTmp1, x86::qword_ptr(xTmp1, RuntimeOffsets::codeBlockJitPtr));
+  a.test(xTmp1, xTmp1);
+  a.jz(slowPathLab);
+
+  // We have a JIT compiled function, call it.
+  a.mov(xArg0, xRuntime);
+  a.call(xTmp1);
+  a.bind(contLab);
+  // NOTE: this does the move for both the slow and fast paths.
+  movFRFromRet(frRes);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frCallee,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: CallImpl r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(
+             xArg1,
+             FR(em.numFrameRegs_ + hbc::StackFrameLayout::CalleeClosureOrCB));
+         EMIT_RUNTIME_CALL_WITHOUT_SAVED_IP(
+             em,
+             SHLegacyValue(*)(SHRuntime *, SHLegacyValue *),
+             _jit_dispatch_call);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::call(FR frRes, FR frCallee, uint32_t argc) {
+  comment("// Call r%u, r%u, %u", frRes.index(), frCallee.index(), argc);
+  uint32_t nRegs = numFrameRegs_;
+
+  // Store undefined as the new target.
+  FR ntFrameArg{nRegs + hbc::StackFrameLayout::NewTarget};
+  storeBits64(frMem(ntFrameArg), _sh_ljs_undefined().raw, xTmp0);
+
+  FR argcFrameArg{nRegs + hbc::StackFrameLayout::ArgCount};
+  static_assert(HERMESVALUE_VERSION == 2, "Native u32 must not need encoding");
+  // The bytecode arg count includes "this", but the frame one does not, so
+  // subtract 1.
+  a.mov(frMem(argcFrameArg), argc - 1);
+
+  callImpl(frRes, frCallee);
+}
+
+void Emitter::callN(FR frRes, FR frCallee, llvh::ArrayRef<FR> args) {
+  comment(
+      "// Call%zu r%u, r%u, ...args",
+      args.size(),
+      frRes.index(),
+      frCallee.index());
+  uint32_t nRegs = numFrameRegs_;
+
+  for (uint32_t i = 0; i < args.size(); ++i) {
+    auto argLoc = FR{nRegs + hbc::StackFrameLayout::ThisArg - i};
+    if (args[i] != argLoc) {
+      a.mov(xTmp0, frMem(args[i]));
+      a.mov(frMem(argLoc), xTmp0);
+    }
+  }
+
+  // Store undefined as the new target.
+  FR ntFrameArg{nRegs + hbc::StackFrameLayout::NewTarget};
+  storeBits64(frMem(ntFrameArg), _sh_ljs_undefined().raw, xTmp0);
+
+  FR argcFrameArg{nRegs + hbc::StackFrameLayout::ArgCount};
+  static_assert(HERMESVALUE_VERSION == 2, "Native u32 must not need encoding");
+  // The bytecode arg count includes "this", but the frame one does not, so
+  // subtract 1.
+  a.mov(frMem(argcFrameArg), (uint32_t)args.size() - 1);
+
+  callImpl(frRes, frCallee);
+}
+
+void Emitter::callBuiltin(FR frRes, uint32_t builtinIndex, uint32_t argc) {
+  comment(
+      "// CallBuiltin r%u, %s, %u",
+      frRes.index(),
+      getBuiltinMethodName(builtinIndex),
+      argc);
+  // CallBuiltin internally sets "this".
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1, xFrame);
+  // The bytecode arg count includes "this", but the SH one does not, so
+  // subtract 1.
+  a.mov(xArg2.r32(), argc - 1);
+  a.mov(xArg3.r32(), builtinIndex);
+  // NOTE: _sh_ljs_call_builtin does not itself populate the SavedIP field, but
+  // it will be populated by NativeFunction::_nativeCall.
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, uint32_t, uint32_t),
+      _sh_ljs_call_builtin);
+  movFRFromRet(frRes);
+}
+
+void Emitter::callWithNewTarget(
+    FR frRes,
+    FR frCallee,
+    FR frNewTarget,
+    uint32_t argc) {
+  comment(
+      "// CallWithNewTarget r%u, r%u, r%u, %u",
+      frRes.index(),
+      frCallee.index(),
+      frNewTarget.index(),
+      argc);
+  uint32_t nRegs = numFrameRegs_;
+
+  FR ntFrameArg{nRegs + hbc::StackFrameLayout::NewTarget};
+  // Store the new target to the right location in the frame.
+  if (ntFrameArg != frNewTarget) {
+    a.mov(xTmp0, frMem(frNewTarget));
+    a.mov(frMem(ntFrameArg), xTmp0);
+  }
+
+  FR argcFrameArg{nRegs + hbc::StackFrameLayout::ArgCount};
+  static_assert(HERMESVALUE_VERSION == 2, "Native u32 must not need encoding");
+  // The bytecode arg count includes "this", but the frame one does not, so
+  // subtract 1.
+  a.mov(frMem(argcFrameArg), argc - 1);
+
+  callImpl(frRes, frCallee);
+}
+
+void Emitter::callWithNewTargetLong(
+    FR frRes,
+    FR frCallee,
+    FR frNewTarget,
+    FR frArgc) {
+  comment(
+      "// CallWithNewTarget r%u, r%u, r%u, r%u",
+      frRes.index(),
+      frCallee.index(),
+      frNewTarget.index(),
+      frArgc.index());
+  uint32_t nRegs = numFrameRegs_;
+
+  FR ntFrameArg{nRegs + hbc::StackFrameLayout::NewTarget};
+  // Store the new target to the right location in the frame.
+  if (ntFrameArg != frNewTarget) {
+    a.mov(xTmp0, frMem(frNewTarget));
+    a.mov(frMem(ntFrameArg), xTmp0);
+  }
+
+  FR argcFrameArg{nRegs + hbc::StackFrameLayout::ArgCount};
+  static_assert(HERMESVALUE_VERSION == 2, "Native u32 must not need encoding");
+  // The argument count is a number, convert it to an integer.
+  a.cvttsd2si(xTmp0, frMem(frArgc));
+  // The bytecode arg count includes "this", but the frame one does not, so
+  // subtract 1.
+  a.sub(xTmp0, 1);
+  a.mov(frMem(argcFrameArg), xTmp0);
+
+  callImpl(frRes, frCallee);
+}
+
+void Emitter::callRequire(FR frRes, FR frRequireFunc, uint32_t modIndex) {
+  comment(
+      "// CallRequire r%u, r%u, %u",
+      frRes.index(),
+      frRequireFunc.index(),
+      modIndex);
+  a.mov(xArg0, xRuntime);
+  loadRelocatable(
+      xArg1,
+      (uint64_t)codeBlock_->getRuntimeModule() +
+          RuntimeOffsets::runtimeModuleModuleCache,
+      JITRelocKind::RuntimeModule,
+      RuntimeOffsets::runtimeModuleModuleCache,
+      "cacheData");
+  loadFrameAddr(xArg2, frRequireFunc);
+  a.mov(xArg3.r32(), modIndex);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *, SHArrayStorage **, SHLegacyValue *, uint32_t),
+      _sh_ljs_callRequire);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getBuiltinClosure(FR frRes, uint32_t builtinIndex) {
+  comment(
+      "// GetBuiltinClosure r%u, %s",
+      frRes.index(),
+      getBuiltinMethodName(builtinIndex));
+  a.mov(xArg0, xRuntime);
+  a.mov(xArg1.r32(), builtinIndex);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, uint32_t),
+      _sh_ljs_get_builtin_closure);
+  movFRFromRet(frRes);
+}
+
+void Emitter::arithUnop(
+    FR frRes,
+    FR frInput,
+    const char *name,
+    double addend,
+    void *slowCall,
+    const char *slowCallName) {
+  comment("// %s r%u, r%u", name, frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab;
+  asmjit::Label contLab;
+
+  a.movsd(x86::xmm0, frMem(frInput));
+  if (!isKnownNumber(frInput)) {
+    // Since HermesValue is NaN-boxed we know that all non-number values will
+    // be NaN. So we can conveniently test for non-number values by checking
+    // for NaN (which is unordered with itself).
+    static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+    a.ucomisd(x86::xmm0, x86::xmm0);
+    if (speculateNumbers) {
+      a.jp(newDeoptPath());
+      setKnownNumber(frInput);
+    } else {
+      slowPathLab = newSlowPathLabel();
+      contLab = newContLabel();
+      a.jp(slowPathLab);
+    }
+  }
+  a.addsd(
+      x86::xmm0,
+      roData(uint64Const(llvh::DoubleToBits(addend), addend > 0 ? "1" : "-1")));
+  a.movsd(frMem(frRes), x86::xmm0);
+
+  if (!slowPathLab.isValid()) {
+    setKnownNumber(frRes);
+    return;
+  }
+
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .slowCall = slowCall,
+       .slowCallName = slowCallName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: %s r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::negate(FR frRes, FR frInput) {
+  comment("// neg r%u, r%u", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  a.mov(xTmp0, frMem(frInput));
+  a.movq(x86::xmm0, xTmp0);
+  static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+  a.ucomisd(x86::xmm0, x86::xmm0);
+  a.jp(slowPathLab);
+  // Flip the sign bit.
+  a.btc(xTmp0, 63);
+  a.mov(frMem(frRes), xTmp0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: neg r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_minus_rjs);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::booleanNot(FR frRes, FR frInput) {
+  comment("// Not r%u, r%u", frRes.index(), frInput.index());
+
+  a.mov(xArg0, frMem(frInput));
+  EMIT_RUNTIME_CALL(*this, bool (*)(SHLegacyValue), _sh_ljs_to_boolean);
+  // Only the low byte of a bool result is defined. Negate it.
+  a.movzx(xTmp0.r32(), x86::al);
+  a.xor_(xTmp0.r32(), 1);
+  // Add the bool tag.
+  emit_sh_ljs_bool(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+}
+
+void Emitter::bitNot(FR frRes, FR frInput) {
+  comment("// BitNot r%u, r%u", frRes.index(), frInput.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  a.movsd(x86::xmm0, frMem(frInput));
+  emit_double_is_int32(a, xTmp0, x86::xmm1, x86::xmm0);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+
+  // Perform the negation and write it to the result.
+  a.not_(xTmp0.r32());
+  a.cvtsi2sd(x86::xmm0, xTmp0.r32());
+  a.movsd(frMem(frRes), x86::xmm0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frInput,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: bitNot r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+             _sh_ljs_bit_not_rjs);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::typeOf(FR frRes, FR frInput) {
+  comment("// TypeOf r%u, r%u", frRes.index(), frInput.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frInput);
+  EMIT_RUNTIME_CALL(
+      *this, SHLegacyValue(*)(SHRuntime *, SHLegacyValue *), _sh_ljs_typeof);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getPNameList(FR frRes, FR frObj, FR frIdx, FR frSize) {
+  comment(
+      "// GetPNameList r%u, r%u, r%u, r%u",
+      frRes.index(),
+      frObj.index(),
+      frIdx.index(),
+      frSize.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frObj);
+  loadFrameAddr(xArg2, frIdx);
+  loadFrameAddr(xArg3, frSize);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *, SHLegacyValue *, SHLegacyValue *, SHLegacyValue *),
+      _sh_ljs_get_pname_list_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::getNextPName(
+    FR frRes,
+    FR frProps,
+    FR frObj,
+    FR frIdx,
+    FR frSize) {
+  comment(
+      "// GetNextPName r%u, r%u, r%u, r%u, r%u",
+      frRes.index(),
+      frProps.index(),
+      frObj.index(),
+      frIdx.index(),
+      frSize.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frProps);
+  loadFrameAddr(xArg2, frObj);
+  loadFrameAddr(xArg3, frIdx);
+  loadFrameAddr(xArg4, frSize);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(
+          SHRuntime *,
+          SHLegacyValue *,
+          SHLegacyValue *,
+          SHLegacyValue *,
+          SHLegacyValue *),
+      _sh_ljs_get_next_pname_rjs);
+  movFRFromRet(frRes);
+}
+
+void Emitter::toPropertyKey(FR frRes, FR frVal) {
+  comment("// ToPropertyKey r%u, r%u", frRes.index(), frVal.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frVal);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, const SHLegacyValue *),
+      _sh_ljs_to_property_key);
+  movFRFromRet(frRes);
+}
+
+void Emitter::addS(FR frRes, FR frLeft, FR frRight) {
+  comment(
+      "// AddS r%u, r%u, r%u", frRes.index(), frLeft.index(), frRight.index());
+  a.mov(xArg0, xRuntime);
+  loadFrameAddr(xArg1, frLeft);
+  loadFrameAddr(xArg2, frRight);
+  EMIT_RUNTIME_CALL(
+      *this,
+      SHLegacyValue(*)(SHRuntime *, SHLegacyValue *, SHLegacyValue *),
+      _sh_ljs_string_add);
+  movFRFromRet(frRes);
+}
+
+void Emitter::mod(bool forceNumber, FR frRes, FR frLeft, FR frRight) {
+  comment(
+      "// %s%s r%u, r%u, r%u",
+      "mod",
+      forceNumber ? "N" : "",
+      frRes.index(),
+      frLeft.index(),
+      frRight.index());
+  asmjit::Label slowPathLab;
+  asmjit::Label contLab;
+
+  a.movsd(x86::xmm0, frMem(frLeft));
+  a.movsd(x86::xmm1, frMem(frRight));
+  if (!forceNumber) {
+    slowPathLab = newSlowPathLabel();
+    contLab = newContLabel();
+    // Since HermesValue is NaN-boxed we know that all non-number values will be
+    // NaN. ucomisd sets PF if either operand is NaN.
+    static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+    a.ucomisd(x86::xmm0, x86::xmm1);
+    a.jp(slowPathLab);
+  }
+
+  EMIT_RUNTIME_CALL(*this, double (*)(double, double), _sh_mod_double);
+  a.movsd(frMem(frRes), x86::xmm0);
+
+  if (forceNumber)
+    return;
+
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .frRes = frRes,
+       .frInput1 = frLeft,
+       .frInput2 = frRight,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// mod r%u, r%u, r%u",
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         em.loadFrameAddr(xArg2, sl.frInput2);
+         EMIT_RUNTIME_CALL(
+             em,
+             SHLegacyValue(*)(
+                 SHRuntime *, const SHLegacyValue *, const SHLegacyValue *),
+             _sh_ljs_mod_rjs);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::arithBinOp(
+    bool forceNumber,
+    FR frRes,
+    FR frLeft,
+    FR frRight,
+    const char *name,
+    void (*fast)(x86::Assembler &a, const x86::Xmm &dl, const x86::Xmm &dr),
+    void *slowCall,
+    const char *slowCallName) {
+  comment(
+      "// %s r%u, r%u, r%u",
+      name,
+      frRes.index(),
+      frLeft.index(),
+      frRight.index());
+  asmjit::Label slowPathLab;
+  asmjit::Label contLab;
+
+  a.movsd(x86::xmm0, frMem(frLeft));
+  a.movsd(x86::xmm1, frMem(frRight));
+  if (!forceNumber && !(isKnownNumber(frLeft) && isKnownNumber(frRight))) {
+    // Since HermesValue is NaN-boxed we know that all non-number values will be
+    // NaN. ucomisd sets PF if either operand is NaN.
+    static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+    a.ucomisd(x86::xmm0, x86::xmm1);
+    if (speculateNumbers) {
+      a.jp(newDeoptPath());
+      setKnownNumber(frLeft);
+      setKnownNumber(frRight);
+    } else {
+      slowPathLab = newSlowPathLabel();
+      contLab = newContLabel();
+      a.jp(slowPathLab);
+    }
+  }
+
+  fast(a, x86::xmm0, x86::xmm1);
+  a.movsd(frMem(frRes), x86::xmm0);
+
+  if (!slowPathLab.isValid()) {
+    setKnownNumber(frRes);
+    return;
+  }
+
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frRes,
+       .frInput1 = frLeft,
+       .frInput2 = frRight,
+       .slowCall = slowCall,
+       .slowCallName = slowCallName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// %s r%u, r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         em.loadFrameAddr(xArg2, sl.frInput2);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::bitBinOp(
+    FR frRes,
+    FR frLeft,
+    FR frRight,
+    bool unsignedRes,
+    const char *name,
+    SHLegacyValue (*slowCall)(
+        SHRuntime *shr,
+        const SHLegacyValue *a,
+        const SHLegacyValue *b),
+    const char *slowCallName,
+    void (*fast)(x86::Assembler &a, const x86::Gpd &dl, const x86::Gpd &dr)) {
+  comment(
+      "// %s r%u, r%u, r%u",
+      name,
+      frRes.index(),
+      frLeft.index(),
+      frRight.index());
+
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  // The left operand goes in eax and the right one in ecx, so shifts can use
+  // cl for the count.
+  a.movsd(x86::xmm0, frMem(frLeft));
+  emit_double_is_int32(a, xTmp0, x86::xmm2, x86::xmm0);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+  a.movsd(x86::xmm1, frMem(frRight));
+  emit_double_is_int32(a, xTmp1, x86::xmm2, x86::xmm1);
+  a.jp(slowPathLab);
+  a.jne(slowPathLab);
+
+  // Invoke the fast path, and convert the 32-bit integer result back.
+  fast(a, xTmp0.r32(), xTmp1.r32());
+  if (unsignedRes) {
+    // 32-bit operations zero the upper half, so the 64-bit register holds the
+    // unsigned value.
+    a.cvtsi2sd(x86::xmm0, xTmp0);
+  } else {
+    a.cvtsi2sd(x86::xmm0, xTmp0.r32());
+  }
+  a.movsd(frMem(frRes), x86::xmm0);
+  a.bind(contLab);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frRes,
+       .frInput1 = frLeft,
+       .frInput2 = frRight,
+       .slowCall = (void *)slowCall,
+       .slowCallName = slowCallName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// %s r%u, r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.a.mov(xArg0, xRuntime);
+         em.loadFrameAddr(xArg1, sl.frInput1);
+         em.loadFrameAddr(xArg2, sl.frInput2);
+         em.callWithSavedIP(sl.slowCall, sl.slowCallName);
+         em.movFRFromRet(sl.frRes);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::jmpTrueFalse(
+    bool onTrue,
+    const asmjit::Label &target,
+    FR frInput) {
+  comment("// Jmp%s r%u", onTrue ? "True" : "False", frInput.index());
+
+  asmjit::Label callLab = a.newLabel();
+  asmjit::Label doneLab = a.newLabel();
+
+  // Booleans are by far the most common input, handle them inline.
+  a.mov(xArg0, frMem(frInput));
+  emit_sh_ljs_is_bool(a, xTmp0, xArg0);
+  a.jne(callLab);
+  static_assert(
+      HERMESVALUE_VERSION == 2, "bool is encoded as a bit at kHV_BoolBitIdx");
+  a.bt(xArg0, kHV_BoolBitIdx);
+  a.j(onTrue ? x86::CondCode::kC : x86::CondCode::kNC, target);
+  a.jmp(doneLab);
+
+  a.bind(callLab);
+  EMIT_RUNTIME_CALL(*this, bool (*)(SHLegacyValue), _sh_ljs_to_boolean);
+  a.test(x86::al, x86::al);
+  if (onTrue)
+    a.jnz(target);
+  else
+    a.jz(target);
+  a.bind(doneLab);
+}
+
+void Emitter::jmp(const asmjit::Label &target) {
+  comment("// Jmp Lx");
+  a.jmp(target);
+}
+
+void Emitter::jmpUndefined(const asmjit::Label &target, FR frInput) {
+  comment("// JmpUndefined r%u", frInput.index());
+  a.mov(xTmp0, frMem(frInput));
+  emit_sh_ljs_is_undefined(a, xTmp0, xTmp0);
+  a.je(target);
+}
+
+void Emitter::jmpBuiltinIs(
+    bool invert,
+    const asmjit::Label &target,
+    uint8_t builtinIndex,
+    FR frInput) {
+  comment(
+      "// JmpBuiltinIs%s r%u, %u",
+      invert ? "Not" : "",
+      frInput.index(),
+      builtinIndex);
+
+  // Load builtin pointer.
+  static_assert(
+      std::is_same_v<
+          TransparentOwningPtr<Callable *, llvh::FreeDeleter>,
+          decltype(Runtime::builtins_)>,
+      "builtins_ is a list of Callable *");
+  static_assert(
+      offsetof(TransparentOwningPtr<Callable *>, ptr) == 0,
+      "TransparentOwningPtr must be transparent");
+  a.mov(xTmp0, x86::qword_ptr(xRuntime, RuntimeOffsets::builtins));
+  a.mov(xTmp0, x86::qword_ptr(xTmp0, builtinIndex * sizeof(Callable *)));
+
+  // Encode an object HermesValue.
+  emit_sh_ljs_object(a, xTmp0, xTmp1);
+
+  // Compare the builtin pointer with the input, branch.
+  a.cmp(xTmp0, frMem(frInput));
+  if (!invert)
+    a.je(target);
+  else
+    a.jne(target);
+}
+
+void Emitter::jCond(
+    bool forceNumber,
+    bool invert,
+    bool passArgsByVal,
+    const asmjit::Label &target,
+    FR frLeft,
+    FR frRight,
+    const char *name,
+    bool swap,
+    x86::CondCode condCode,
+    void *slowCall,
+    const char *slowCallName) {
+  comment(
+      "// j_%s_%s Lx, r%u, r%u",
+      invert ? "not" : "",
+      name,
+      frLeft.index(),
+      frRight.index());
+  asmjit::Label slowPathLab;
+  asmjit::Label contLab = newContLabel();
+
+  a.movsd(x86::xmm0, frMem(swap ? frRight : frLeft));
+  a.ucomisd(x86::xmm0, frMem(swap ? frLeft : frRight));
+
+  // ucomisd reports an unordered result (PF set) if either operand is NaN,
+  // which includes all non-number values since HermesValue is NaN-boxed.
+  static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+  if (forceNumber || (isKnownNumber(frLeft) && isKnownNumber(frRight))) {
+    // Comparisons with a NaN are always false.
+    a.jp(invert ? target : contLab);
+  } else if (speculateNumbers) {
+    a.jp(newDeoptPath());
+  } else {
+    slowPathLab = newSlowPathLabel();
+    a.jp(slowPathLab);
+  }
+  a.j(invert ? x86::negateCond(condCode) : condCode, target);
+  a.bind(contLab);
+
+  if (!slowPathLab.isValid())
+    return;
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .target = target,
+       .name = name,
+       .frInput1 = frLeft,
+       .frInput2 = frRight,
+       .invert = invert,
+       .passArgsByVal = passArgsByVal,
+       .slowCall = slowCall,
+       .slowCallName = slowCallName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: j_%s%s Lx, r%u, r%u",
+             sl.invert ? "not_" : "",
+             sl.name,
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.emitCompareSlowCall(
+             sl.frInput1,
+             sl.frInput2,
+             sl.passArgsByVal,
+             sl.slowCall,
+             sl.slowCallName);
+         em.a.test(x86::al, x86::al);
+         if (!sl.invert)
+           em.a.jnz(sl.target);
+         else
+           em.a.jz(sl.target);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::emitCompareSlowCall(
+    FR frLeft,
+    FR frRight,
+    bool passArgsByVal,
+    void *slowCall,
+    const char *slowCallName) {
+  if (passArgsByVal) {
+    a.mov(xArg0, frMem(frLeft));
+    a.mov(xArg1, frMem(frRight));
+  } else {
+    a.mov(xArg0, xRuntime);
+    loadFrameAddr(xArg1, frLeft);
+    loadFrameAddr(xArg2, frRight);
+  }
+  callWithSavedIP(slowCall, slowCallName);
+}
+
+void Emitter::compareImpl(
+    FR frRes,
+    FR frLeft,
+    FR frRight,
+    const char *name,
+    bool swap,
+    x86::CondCode condCode,
+    void *slowCall,
+    const char *slowCallName,
+    bool invSlow,
+    bool passArgsByVal) {
+  comment(
+      "// %s r%u, r%u, r%u",
+      name,
+      frRes.index(),
+      frLeft.index(),
+      frRight.index());
+  asmjit::Label slowPathLab = newSlowPathLabel();
+  asmjit::Label contLab = newContLabel();
+
+  a.movsd(x86::xmm0, frMem(swap ? frRight : frLeft));
+  a.ucomisd(x86::xmm0, frMem(swap ? frLeft : frRight));
+  // Since HermesValue is NaN-boxed we know that all non-number values will be
+  // NaN. ucomisd sets PF if either operand is NaN.
+  static_assert(HERMESVALUE_VERSION == 2, "Non-numbers must be NaN");
+  a.jp(slowPathLab);
+
+  // Store the result of the comparison in al.
+  a.set(condCode, x86::al);
+  a.bind(contLab);
+
+  // Encode bool.
+  a.movzx(xTmp0.r32(), x86::al);
+  emit_sh_ljs_bool(a, xTmp0, xTmp1);
+  a.mov(frMem(frRes), xTmp0);
+
+  slowPaths_.push_back(
+      {.slowPathLab = slowPathLab,
+       .contLab = contLab,
+       .name = name,
+       .frRes = frRes,
+       .frInput1 = frLeft,
+       .frInput2 = frRight,
+       .invert = invSlow,
+       .passArgsByVal = passArgsByVal,
+       .slowCall = slowCall,
+       .slowCallName = slowCallName,
+       .emittingIP = emittingIP,
+       .emit = [](Emitter &em, SlowPath &sl) {
+         em.comment(
+             "// Slow path: %s r%u, r%u, r%u",
+             sl.name,
+             sl.frRes.index(),
+             sl.frInput1.index(),
+             sl.frInput2.index());
+         em.a.bind(sl.slowPathLab);
+         em.emitCompareSlowCall(
+             sl.frInput1,
+             sl.frInput2,
+             sl.passArgsByVal,
+             sl.slowCall,
+             sl.slowCallName);
+         // Invert the slow path result if needed.
+         if (sl.invert)
+           em.a.xor_(x86::al, 1);
+         em.a.jmp(sl.contLab);
+       }});
+}
+
+void Emitter::jmpTypeOfIs(
+    const asmjit::Label &target,
+    FR frInput,
+    TypeOfIsTypes origTypes) {
+  comment("// jTypeOfIs r%u, %u", frInput.index(), origTypes.getRaw());
+
+  TypeOfIsTypes invertedTypes = origTypes.invert();
+
+  const auto &xInput = xTmp0;
+  const auto &xTemp = xTmp1;
+  a.mov(xInput, frMem(frInput));
+
+  // Try and see if inverting will result in fewer checks.
+  // If so, flip it and set invert=true.
+  bool invert = false;
+  TypeOfIsTypes typesToCheck = origTypes;
+  if (invertedTypes.count() < origTypes.count()) {
+    invert = true;
+    typesToCheck = invertedTypes;
+  }
+
+  // doneLab goes at the end of the instruction if there's multiple bits to
+  // check, allowing short-circuiting the remaining checks if one of the
+  // TypeOfIsTypes bits matches the kind of the input.
+  // Use numRemainingTypes to track how many bits are left to check.
+  asmjit::Label doneLab = a.newLabel();
+  size_t numRemainingTypes = typesToCheck.count();
+
+  // Checks are done as follows:
+  // * If not inverted, just go to the target if the tag matches the bit,
+  //   else fallthrough to the next case (if any).
+  // * If inverted and there's multiple bits remaining,
+  //   if the tag matches the bit, short circuit to doneLab and we've
+  //   finished executing the instruction (no need to check the other bits).
+  // * If inverted and there's only one bit remaining,
+  //   then if the tag does NOT match the bit, go to the target
+  //   immediately.
+
+  /// Emit the simple check for a match.
+  /// \param cond the condition code, which if true, indicates a tag match.
+  auto emitCondCheck = [this, invert, &numRemainingTypes, &target, &doneLab](
+                           x86::CondCode cond) {
+    if (!invert)
+      a.j(cond, target);
+    else if (numRemainingTypes > 0)
+      a.j(cond, doneLab);
+    else
+      a.j(x86::negateCond(cond), target);
+  };
+
+  if (typesToCheck.hasUndefined()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_undefined(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasSymbol()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_symbol(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasString()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_string(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasBoolean()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_bool(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasNull()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_null(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasBigint()) {
+    --numRemainingTypes;
+    emit_sh_ljs_is_bigint(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasNumber()) {
+    --numRemainingTypes;
+    static_assert(
+        HERMESVALUE_VERSION == 2,
+        "HVTag_First must be the first after double limit");
+    loadBits64InGp(
+        xTemp, ((uint64_t)HVTag_First << kHV_NumDataBits), "doubleLim");
+    a.cmp(xInput, xTemp);
+    emitCondCheck(x86::CondCode::kB);
+  }
+  if (typesToCheck.hasObject()) {
+    --numRemainingTypes;
+    asmjit::Label objectDoneLab = a.newLabel();
+    emit_sh_ljs_is_object(a, xTemp, xInput);
+    if (!invert || numRemainingTypes > 0)
+      a.jne(objectDoneLab);
+    else
+      a.jne(target);
+    a.mov(xTemp, xInput);
+    emit_sh_ljs_get_pointer(a, xTemp);
+    emit_gccell_get_kind(a, xTemp, xTemp);
+    emit_cellkind_in_range(
+        a,
+        xTemp,
+        CellKind::CallableKind_first,
+        CellKind::CallableKind_last);
+    emitCondCheck(x86::CondCode::kA);
+    a.bind(objectDoneLab);
+  }
+  if (typesToCheck.hasFunction()) {
+    --numRemainingTypes;
+    asmjit::Label functionDoneLab = a.newLabel();
+    emit_sh_ljs_is_object(a, xTemp, xInput);
+    if (!invert || numRemainingTypes > 0)
+      a.jne(functionDoneLab);
+    else
+      a.jne(target);
+    a.mov(xTemp, xInput);
+    emit_sh_ljs_get_pointer(a, xTemp);
+    emit_gccell_get_kind(a, xTemp, xTemp);
+    emit_cellkind_in_range(
+        a,
+        xTemp,
+        CellKind::CallableKind_first,
+        CellKind::CallableKind_last);
+    emitCondCheck(x86::CondCode::kBE);
+    a.bind(functionDoneLab);
+  }
+
+  assert(numRemainingTypes == 0 && "missed a type");
+
+  // Put doneLab after, so we skip the branch if we directly branch to doneLab
+  // from above.
+  a.bind(doneLab);
+}
+
+void Emitter::typeOfIs(FR frRes, FR frInput, TypeOfIsTypes origTypes) {
+  comment(
+      "// typeOfIs r%u, r%u, %u",
+      frRes.index(),
+      frInput.index(),
+      origTypes.getRaw());
+
+  const auto &xInput = xTmp0;
+  const auto &xTemp = xTmp1;
+  const auto &xRes = xTmp2;
+  a.mov(xInput, frMem(frInput));
+
+  TypeOfIsTypes invertedTypes = origTypes.invert();
+
+  // Try and see if inverting will result in fewer checks.
+  // If so, flip it and set invert=true.
+  bool invert = false;
+  TypeOfIsTypes typesToCheck = origTypes;
+  if (invertedTypes.count() < origTypes.count()) {
+    invert = true;
+    typesToCheck = invertedTypes;
+  }
+
+  // matchLab goes directly to the end of the instruction if there are multiple
+  // bits to check, allowing short-circuiting the remaining checks if one of the
+  // TypeOfIsTypes bits matches the kind of the input.
+  asmjit::Label matchLab{};
+  if (typesToCheck.count() > 1)
+    matchLab = a.newLabel();
+
+  // Initialize xRes:
+  // * If there are multiple bits set, to the value we would produce on a
+  //   match. This is false if inverted and true otherwise.
+  // * If there's only one bit set, to 0, so that setcc on the low byte
+  //   produces the full result.
+  a.mov(xRes.r32(), matchLab.isValid() && !invert ? 1 : 0);
+
+  /// Emit the simple check for a match.
+  /// If there's multiple bits to check, this will branch based on \p cond
+  /// to matchLab if the tag matches.
+  /// If there's only one bit to check, this will emit a setcc with the
+  /// appropriate condition code (and we're done).
+  /// \param cond the condition code, which if true, indicates a tag match.
+  auto emitCondCheck = [this, invert, &xRes, &matchLab](x86::CondCode cond) {
+    if (matchLab.isValid())
+      a.j(cond, matchLab);
+    else
+      a.set(!invert ? cond : x86::negateCond(cond), xRes.r8());
+  };
+
+  if (typesToCheck.hasUndefined()) {
+    emit_sh_ljs_is_undefined(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasSymbol()) {
+    emit_sh_ljs_is_symbol(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasString()) {
+    emit_sh_ljs_is_string(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasBoolean()) {
+    emit_sh_ljs_is_bool(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasBigint()) {
+    emit_sh_ljs_is_bigint(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasNull()) {
+    emit_sh_ljs_is_null(a, xTemp, xInput);
+    emitCondCheck(x86::CondCode::kE);
+  }
+  if (typesToCheck.hasNumber()) {
+    static_assert(
+        HERMESVALUE_VERSION == 2,
+        "HVTag_First must be the first after double limit");
+    loadBits64InGp(
+        xTemp, ((uint64_t)HVTag_First << kHV_NumDataBits), "doubleLim");
+    a.cmp(xInput, xTemp);
+    emitCondCheck(x86::CondCode::kB);
+  }
+  if (typesToCheck.hasObject()) {
+    asmjit::Label objectDoneLab = a.newLabel();
+    emit_sh_ljs_is_object(a, xTemp, xInput);
+    if (!matchLab.isValid()) {
+      // No more tags to check. Decide the result here and go to the end.
+      // mov does not modify the flags.
+      a.mov(xRes.r32(), invert ? 1 : 0);
+    }
+    a.jne(objectDoneLab);
+    a.mov(xTemp, xInput);
+    emit_sh_ljs_get_pointer(a, xTemp);
+    emit_gccell_get_kind(a, xTemp, xTemp);
+    emit_cellkind_in_range(
+        a,
+        xTemp,
+        CellKind::CallableKind_first,
+        CellKind::CallableKind_last);
+    emitCondCheck(x86::CondCode::kA);
+    a.bind(objectDoneLab);
+  }
+  if (typesToCheck.hasFunction()) {
+    asmjit::Label functionDoneLab = a.newLabel();
+    emit_sh_ljs_is_object(a, xTemp, xInput);
+    if (!matchLab.isValid()) {
+      // No more tags to check. Decide the result here and go to the end.
+      // mov does not modify the flags.
+      a.mov(xRes.r32(), invert ? 1 : 0);
+    }
+    a.jne(functionDoneLab);
+    a.mov(xTemp, xInput);
+    emit_sh_ljs_get_pointer(a, xTemp);
+    emit_gccell_get_kind(a, xTemp, xTemp);
+    emit_cellkind_in_range(
+        a,
+        xTemp,
+        CellKind::CallableKind_first,
+        CellKind::CallableKind_last);
+    emitCondCheck(x86::CondCode::kBE);
+    a.bind(functionDoneLab);
+  }
+
+  if (matchLab.isValid()) {
+    // We failed to match, so flip the result
+    a.xor_(xRes.r32(), 1);
+    // We initialize xRes to the "match value", so there is nothing to do on a
+    // match.
+    a.bind(matchLab);
+  }
+
+  // xRes contains either 0 or 1 at this point, turn it into a bool HermesValue.
+  emit_sh_ljs_bool(a, xRes, xTemp);
+  a.mov(frMem(frRes), xRes);
+}
+
+void Emitter::switchImm(
+    FR frInput,
+    const asmjit::Label &defaultLabel,
+    llvh::ArrayRef<const asmjit::Label *> labels,
+    uint32_t minVal,
+    uint32_t maxVal) {
+  comment("// switchImm r%u, min %u, max %u", frInput.index(), minVal, maxVal);
+
+  // Convert the input to an integer and back to double,
+  // and check if the value remained the same.
+  // If it didn't, jump to the default label.
+  a.movsd(x86::xmm0, frMem(frInput));
+  emit_double_is_uint32(a, xTmp0, x86::xmm1, x86::xmm0);
+  a.jp(defaultLabel);
+  a.jne(defaultLabel);
+
+  // Check if the integer value is in range.
+  a.cmp(xTmp0.r32(), minVal);
+  a.jb(defaultLabel);
+  a.cmp(xTmp0.r32(), maxVal);
+  a.ja(defaultLabel);
+
+  // Offset by the minVal if necessary.
+  if (minVal != 0)
+    a.sub(xTmp0.r32(), minVal);
+
+  // Label for the start of the jump table, which holds 32-bit offsets of the
+  // targets relative to the table itself.
+  asmjit::Label tableLab = a.newLabel();
+  a.lea(xTmp1, x86::ptr(tableLab));
+  a.movsxd(xTmp0, x86::dword_ptr(xTmp1, xTmp0, 2));
+  a.add(xTmp0, xTmp1);
+  a.jmp(xTmp0);
+
+  // Emit the jump table.
+  a.align(asmjit::AlignMode::kData, 4);
+  a.bind(tableLab);
+  for (const asmjit::Label *label : labels) {
+    a.embedLabelDelta(*label, tableLab, /* size */ 4);
+  }
+}
+
+} // namespace hermes::vm::x86_64
+#endif // HERMESVM_JIT
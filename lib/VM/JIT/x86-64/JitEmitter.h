@@ -0,0 +1,1001 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "asmjit/x86.h"
+
+#include "hermes/ADT/DenseUInt64.h"
+#include "hermes/BCGen/HBC/StackFrameLayout.h"
+#include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/JIT/CodeCache.h"
+#include "hermes/VM/static_h.h"
+
+#include "llvh/ADT/BitVector.h"
+#include "llvh/ADT/DenseMap.h"
+
+#include <deque>
+
+namespace hermes::vm::x86_64 {
+
+namespace x86 = asmjit::x86;
+
+/// A HermesVM frame register
+class FR {
+  uint32_t index_;
+
+ public:
+  static constexpr uint32_t kInvalid = UINT32_MAX;
+
+  FR() : index_(kInvalid) {}
+  constexpr explicit FR(uint32_t index) : index_(index) {}
+
+  constexpr bool isValid() const {
+    return index_ != kInvalid;
+  }
+
+  constexpr uint32_t index() const {
+    return index_;
+  }
+  bool operator==(const FR &fr) const {
+    return fr.index_ == index_;
+  }
+  bool operator!=(const FR &fr) const {
+    return fr.index_ != index_;
+  }
+};
+
+/// The runtime pointer. Callee-saved.
+static constexpr auto xRuntime = x86::rbx;
+/// Pointer to the first register of the current frame. Callee-saved.
+static constexpr auto xFrame = x86::r12;
+/// The return value is kept here between ret() and the epilogue.
+/// Callee-saved.
+static constexpr auto xRetVal = x86::r13;
+
+/// Unlike the arm64 backend, this emitter does not allocate hardware registers
+/// for frame registers. Every frame register lives in its slot in the register
+/// stack, and every instruction loads its operands into scratch registers,
+/// operates on them and stores the result back. The only values kept in
+/// hardware registers across instructions are the runtime and frame pointers.
+///
+/// This keeps the emitter simple, makes every instruction boundary a valid
+/// point for calling into the runtime or unwinding via longjmp(), and still
+/// removes the interpreter dispatch overhead and the operand decoding. Number
+/// arithmetic, comparisons and conditional branches are emitted inline, with
+/// calls into the runtime on slow paths.
+class Emitter {
+  /// Level of dumping JIT code. Bit 0 indicates code printing on or off.
+  unsigned const dumpJitCode_;
+  /// Whether to emit asserts in the JIT'ed code.
+  bool const emitAsserts_;
+
+#ifndef ASMJIT_NO_LOGGING
+  std::unique_ptr<asmjit::Logger> logger_{};
+#endif
+
+  std::unique_ptr<asmjit::ErrorHandler> errorHandler_;
+  asmjit::Error expectedError_ = asmjit::kErrorOk;
+
+  /// Number of frame registers in the current function.
+  uint32_t const numFrameRegs_;
+
+  /// Keep enough information to generate a slow path at the end of the
+  /// function.
+  struct SlowPath {
+    /// Label of the slow path.
+    asmjit::Label slowPathLab;
+    /// Label to jump to after the slow path.
+    asmjit::Label contLab;
+    /// Target if this is a branch.
+    asmjit::Label target;
+
+    /// Name of the slow path.
+    const char *name;
+    /// Frame register indexes;
+    FR frRes, frInput1, frInput2;
+    /// Whether to invert a condition.
+    bool invert;
+    /// Whether to pass arguments by value to the slow path.
+    bool passArgsByVal;
+
+    /// Pointer to the slow path function that must be called.
+    void *slowCall;
+    /// The name of the slow path function.
+    const char *slowCallName;
+    /// Symbol and property cache index, for property access slow paths.
+    SHSymbolID symID;
+    uint8_t cacheIdx;
+
+    /// Bytecode IP of the instruction that this is a slow path for.
+    const inst::Inst *emittingIP;
+
+    /// Callback to actually emit.
+    void (*emit)(Emitter &em, SlowPath &sl);
+  };
+  /// Queue of slow paths.
+  std::deque<SlowPath> slowPaths_{};
+
+  /// Descriptor for a single RO data entry.
+  struct DataDesc {
+    /// Size in bytes.
+    int32_t size;
+    asmjit::TypeId typeId;
+    int32_t itemCount;
+    /// Optional comment.
+    const char *comment;
+  };
+  /// Used for pretty printing when logging data.
+  std::vector<DataDesc> roDataDesc_{};
+  std::vector<uint8_t> roData_{};
+  asmjit::Label roDataLabel_{};
+
+  /// Map from a runtime function to the offset in RO DATA of the pointer to
+  /// it. Calls are emitted as RIP-relative indirect calls through the pointer.
+  llvh::DenseMap<void *, int32_t> callTargetMap_{};
+
+  /// Map from the bit pattern of a double value to offset in constant pool.
+  llvh::DenseMap<hermes::DenseUInt64, int32_t> fp64ConstMap_{};
+
+  /// Label to branch to when returning from a function. Return value will be
+  /// in xRetVal.
+  asmjit::Label returnLabel_{};
+
+  /// Label to branch to when catching an exception with setjmp.
+  /// Invalid if there's no try/catch in the function.
+  asmjit::Label catchTableLabel_{};
+
+  /// Entry point used for on-stack replacement of an interpreter frame.
+  /// Invalid if the function has no loop headers.
+  asmjit::Label osrEntryLabel_{};
+
+  /// The bytecode codeblock.
+  CodeBlock *const codeBlock_;
+
+  /// Optionally, the offset of the string name, used for debug printing.
+  int32_t roOfsDebugFunctionName_ = -1;
+
+  /// Frame registers known to contain a number at the current point of the
+  /// basic block being emitted.
+  llvh::BitVector knownNumbers_;
+
+  /// Offset in RODATA of the pointer to the start of the read property
+  /// cache.
+  int32_t roOfsReadPropertyCachePtr_;
+  /// Offset in RODATA of the pointer to the start of the write property
+  /// cache.
+  int32_t roOfsWritePropertyCachePtr_;
+
+  /// Process-specific values embedded in the code, which must be patched when
+  /// it is loaded from the code cache. The payload of SymbolID relocations is
+  /// the SymbolID itself.
+  std::vector<JITReloc> relocs_{};
+  /// Like relocs_, but the offsets are relative to RO DATA, and the payload of
+  /// FunctionPtr relocations is the address of the function.
+  std::vector<JITReloc> roDataRelocs_{};
+
+ public:
+  asmjit::CodeHolder code{};
+  x86::Assembler a{};
+  /// The IP of the instruction being emitted.
+  const inst::Inst *emittingIP{nullptr};
+  /// Whether the instruction being emitted may assume that its operands are
+  /// numbers, deoptimizing to the interpreter if they are not, instead of
+  /// calling a generic slow path.
+  bool speculateNumbers{false};
+
+  /// Create an Emitter, but do not emit any actual code.
+  /// Use \c enter to set up the stack frame before emitting the actual code.
+  explicit Emitter(
+      asmjit::JitRuntime &jitRT,
+      unsigned dumpJitCode,
+      bool emitAsserts,
+      CodeBlock *codeBlock,
+      ReadPropertyCacheEntry *readPropertyCache,
+      WritePropertyCacheEntry *writePropertyCache,
+      uint32_t numFrameRegs,
+      const std::function<void(std::string &&message)> &longjmpError);
+
+  /// A loop header where an interpreter frame can be transferred into the
+  /// native code.
+  struct OSRTarget {
+    /// The bytecode instruction starting the loop header.
+    const inst::Inst *ip;
+    /// The label of the corresponding basic block.
+    const asmjit::Label *label;
+  };
+
+  /// Add the jitted function to the JIT runtime and return a pointer to it.
+  JITCompiledFunctionPtr addToRuntime(asmjit::JitRuntime &jr);
+
+  /// \return the on-stack replacement entry of the function \p fn returned by
+  ///   addToRuntime(), or nullptr if no OSR entry was emitted.
+  JITCompiledFunctionPtr getOSREntry(JITCompiledFunctionPtr fn);
+
+  /// Copy the code of the function \p fn returned by addToRuntime() and its
+  /// relocations into \p image. The payload of SymbolID relocations is the
+  /// SymbolID, which the caller must replace with a string ID.
+  /// \return false if the code can't be loaded by another process.
+  bool getCodeImage(JITCompiledFunctionPtr fn, JITCodeImage &image);
+
+  /// Frame registers are never cached in hardware registers, so there is
+  /// nothing to check between instructions.
+  void assertPostInstructionInvariants() {}
+
+  /// Register \p fr is about to be written with a value of unknown type.
+  void forgetNumber(FR fr) {
+    if (fr.index() < knownNumbers_.size())
+      knownNumbers_.reset(fr.index());
+  }
+  /// The instruction about to be emitted may write any register.
+  void forgetAllNumbers() {
+    knownNumbers_.reset();
+  }
+
+  /// Set up the stack frame. Must be called before emitting any real code.
+  /// \param numCount the first numCount registers are "number" registers.
+  /// \param npCount the first npCount registers after the number registers are
+  ///   non-pointer registers.
+  void enter(uint32_t numCount, uint32_t npCount);
+
+  /// Log a comment.
+  /// Annotated with printf-style format.
+  void comment(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  /// Emit the function epilogue, the OSR entry, the catch table, the slow
+  /// paths and the RO data.
+  /// \param osrTargets the loop headers where execution can be transferred
+  ///   from the interpreter. No OSR entry is emitted if it is empty.
+  void leave(
+      llvh::ArrayRef<const asmjit::Label *> exceptionHandlers,
+      llvh::ArrayRef<OSRTarget> osrTargets);
+  void newBasicBlock(const asmjit::Label &label);
+
+  /// Call _sh_unreachable.
+  void unreachable();
+
+  /// Call _interpreter_register_bb_execution if HERMESVM_PROFILER_BB is set.
+  void profilePoint(uint16_t point);
+
+  void call(FR frRes, FR frCallee, uint32_t argc);
+  void callN(FR frRes, FR frCallee, llvh::ArrayRef<FR> args);
+  void callBuiltin(FR frRes, uint32_t builtinIndex, uint32_t argc);
+  void callWithNewTarget(FR frRes, FR frCallee, FR frNewTarget, uint32_t argc);
+  void callWithNewTargetLong(FR frRes, FR frCallee, FR frNewTarget, FR frArgc);
+  /// Call the require function with the given \p modIndex in the runtime
+  /// module's module cache.
+  void callRequire(FR frRes, FR frRequireFunc, uint32_t modIndex);
+
+  void getBuiltinClosure(FR frRes, uint32_t builtinIndex);
+
+  void catchInst(FR frRes);
+
+  /// Return the value in \p frValue.
+  void ret(FR frValue);
+  void mov(FR frRes, FR frInput, bool logComment = true);
+  void loadParam(FR frRes, uint32_t paramIndex);
+  void loadConstDouble(FR frRes, double val, const char *name);
+  void loadConstBits64(FR frRes, uint64_t val, const char *name);
+  void
+  loadConstString(FR frRes, RuntimeModule *runtimeModule, uint32_t stringID);
+  void
+  loadConstBigInt(FR frRes, RuntimeModule *runtimeModule, uint32_t bigIntID);
+  void toNumber(FR frRes, FR frInput);
+  void toNumeric(FR frRes, FR frInput);
+  void toInt32(FR frRes, FR frInput);
+  void addEmptyString(FR frRes, FR frInput);
+
+  void addS(FR frRes, FR frLeft, FR frRight);
+  void mod(bool forceNumber, FR frRes, FR frLeft, FR frRight);
+
+#define DECL_BINOP(methodName, forceNum, commentStr, slowCall, x86body) \
+  void methodName(FR rRes, FR rLeft, FR rRight) {                       \
+    arithBinOp(                                                         \
+        forceNum,                                                       \
+        rRes,                                                           \
+        rLeft,                                                          \
+        rRight,                                                         \
+        commentStr,                                                     \
+        [](x86::Assembler & as, const x86::Xmm &dl, const x86::Xmm &dr) \
+            x86body,                                                    \
+        (void *)slowCall,                                               \
+        #slowCall);                                                     \
+  }
+
+  DECL_BINOP(mul, false, "mul", _sh_ljs_mul_rjs, { as.mulsd(dl, dr); })
+  DECL_BINOP(add, false, "add", _sh_ljs_add_rjs, { as.addsd(dl, dr); })
+  DECL_BINOP(sub, false, "sub", _sh_ljs_sub_rjs, { as.subsd(dl, dr); })
+  DECL_BINOP(div, false, "div", _sh_ljs_div_rjs, { as.divsd(dl, dr); })
+  DECL_BINOP(mulN, true, "mulN", _sh_ljs_mul_rjs, { as.mulsd(dl, dr); })
+  DECL_BINOP(addN, true, "addN", _sh_ljs_add_rjs, { as.addsd(dl, dr); })
+  DECL_BINOP(subN, true, "subN", _sh_ljs_sub_rjs, { as.subsd(dl, dr); })
+  DECL_BINOP(divN, true, "divN", _sh_ljs_div_rjs, { as.divsd(dl, dr); })
+#undef DECL_BINOP
+
+#define DECL_BIT_BINOP(methodName, unsignedRes, commentStr, slowCall, x86body) \
+  void methodName(FR rRes, FR rLeft, FR rRight) {                              \
+    bitBinOp(                                                                  \
+        rRes,                                                                  \
+        rLeft,                                                                 \
+        rRight,                                                                \
+        unsignedRes,                                                           \
+        commentStr,                                                            \
+        slowCall,                                                              \
+        #slowCall,                                                             \
+        [](x86::Assembler & a, const x86::Gpd &dl, const x86::Gpd &dr)         \
+            x86body);                                                          \
+  }
+
+  DECL_BIT_BINOP(bitAnd, false, "bit_and", _sh_ljs_bit_and_rjs, {
+    a.and_(dl, dr);
+  })
+  DECL_BIT_BINOP(bitOr, false, "bit_or", _sh_ljs_bit_or_rjs, { a.or_(dl, dr); })
+  DECL_BIT_BINOP(bitXor, false, "bit_xor", _sh_ljs_bit_xor_rjs, {
+    a.xor_(dl, dr);
+  })
+  // The shift count must be in cl. x86 masks it to 5 bits for 32-bit
+  // operands, which matches the JS semantics.
+  DECL_BIT_BINOP(lShift, false, "lshift", _sh_ljs_left_shift_rjs, {
+    a.shl(dl, x86::cl);
+  })
+  DECL_BIT_BINOP(rShift, false, "rshift", _sh_ljs_right_shift_rjs, {
+    a.sar(dl, x86::cl);
+  })
+  DECL_BIT_BINOP(urShift, true, "rshiftu", _sh_ljs_unsigned_right_shift_rjs, {
+    a.shr(dl, x86::cl);
+  })
+
+#undef DECL_BIT_BINOP
+
+  void inc(FR frRes, FR frInput) {
+    arithUnop(frRes, frInput, "inc", 1.0, (void *)_sh_ljs_inc_rjs, "inc");
+  }
+  void dec(FR frRes, FR frInput) {
+    arithUnop(frRes, frInput, "dec", -1.0, (void *)_sh_ljs_dec_rjs, "dec");
+  }
+  void negate(FR frRes, FR frInput);
+
+  void jmpTrueFalse(bool onTrue, const asmjit::Label &target, FR frInput);
+  void jmpUndefined(const asmjit::Label &target, FR frInput);
+  void jmp(const asmjit::Label &target);
+  void jmpBuiltinIs(
+      bool invert,
+      const asmjit::Label &target,
+      uint8_t builtinIndex,
+      FR frInput);
+
+  void booleanNot(FR frRes, FR frInput);
+  void bitNot(FR frRes, FR frInput);
+  void typeOf(FR frRes, FR frInput);
+
+  void getPNameList(FR frRes, FR frObj, FR frIdx, FR frSize);
+  void getNextPName(FR frRes, FR frProps, FR frObj, FR frIdx, FR frSize);
+
+  void toPropertyKey(FR frRes, FR frVal);
+
+  /// The condition codes below assume that ucomisd has been executed with the
+  /// operands in the order specified by \c swap, and that NaNs have already
+  /// been excluded.
+#define DECL_COMPARE(                                                       \
+    methodName, commentStr, slowCall, swap, condCode, invSlow, passByVal)   \
+  void methodName(FR rRes, FR rLeft, FR rRight) {                           \
+    compareImpl(                                                            \
+        rRes,                                                               \
+        rLeft,                                                              \
+        rRight,                                                             \
+        commentStr,                                                         \
+        swap,                                                               \
+        x86::CondCode::condCode,                                            \
+        (void *)slowCall,                                                   \
+        #slowCall,                                                          \
+        invSlow,                                                            \
+        passByVal);                                                         \
+  }
+  DECL_COMPARE(greater, "greater", _sh_ljs_greater_rjs, false, kA, false, false)
+  DECL_COMPARE(
+      greaterEqual,
+      "greater_equal",
+      _sh_ljs_greater_equal_rjs,
+      false,
+      kAE,
+      false,
+      false)
+  DECL_COMPARE(less, "less", _sh_ljs_less_rjs, true, kA, false, false)
+  DECL_COMPARE(
+      lessEqual,
+      "less_equal",
+      _sh_ljs_less_equal_rjs,
+      true,
+      kAE,
+      false,
+      false)
+  DECL_COMPARE(equal, "Eq", _sh_ljs_equal_rjs, false, kE, false, false)
+  DECL_COMPARE(
+      strictEqual,
+      "StrictEq",
+      _sh_ljs_strict_equal,
+      false,
+      kE,
+      false,
+      true)
+  DECL_COMPARE(notEqual, "Neq", _sh_ljs_equal_rjs, false, kNE, true, false)
+  DECL_COMPARE(
+      strictNotEqual,
+      "StrictNeq",
+      _sh_ljs_strict_equal,
+      false,
+      kNE,
+      true,
+      true)
+#undef DECL_COMPARE
+
+#define DECL_JCOND(                                                          \
+    methodName, forceNum, passArgsByVal, commentStr, slowCall, swap, cc)     \
+  void methodName(                                                           \
+      bool invert, const asmjit::Label &target, FR rLeft, FR rRight) {       \
+    jCond(                                                                   \
+        forceNum,                                                            \
+        invert,                                                              \
+        passArgsByVal,                                                       \
+        target,                                                              \
+        rLeft,                                                               \
+        rRight,                                                              \
+        commentStr,                                                          \
+        swap,                                                                \
+        x86::CondCode::cc,                                                   \
+        (void *)slowCall,                                                    \
+        #slowCall);                                                          \
+  }
+  DECL_JCOND(jGreater, false, false, "greater", _sh_ljs_greater_rjs, false, kA)
+  DECL_JCOND(
+      jGreaterEqual,
+      false,
+      false,
+      "greater_equal",
+      _sh_ljs_greater_equal_rjs,
+      false,
+      kAE)
+  DECL_JCOND(jLess, false, false, "less", _sh_ljs_less_rjs, true, kA)
+  DECL_JCOND(
+      jLessEqual,
+      false,
+      false,
+      "less_equal",
+      _sh_ljs_less_equal_rjs,
+      true,
+      kAE)
+  DECL_JCOND(jLessN, true, false, "less_n", _sh_ljs_less_rjs, true, kA)
+  DECL_JCOND(
+      jLessEqualN,
+      true,
+      false,
+      "less_equal_n",
+      _sh_ljs_less_equal_rjs,
+      true,
+      kAE)
+  DECL_JCOND(jEqual, false, false, "eq", _sh_ljs_equal_rjs, false, kE)
+  DECL_JCOND(
+      jStrictEqual,
+      false,
+      true,
+      "strict_eq",
+      _sh_ljs_strict_equal,
+      false,
+      kE)
+#undef DECL_JCOND
+
+  void
+  jmpTypeOfIs(const asmjit::Label &target, FR frInput, TypeOfIsTypes types);
+
+  void typeOfIs(FR frRes, FR frInput, TypeOfIsTypes types);
+
+  void switchImm(
+      FR frInput,
+      const asmjit::Label &defaultLabel,
+      llvh::ArrayRef<const asmjit::Label *> labels,
+      uint32_t minVal,
+      uint32_t maxVal);
+
+  void getByVal(FR frRes, FR frSource, FR frKey);
+  void getByIndex(FR frRes, FR frSource, uint32_t key);
+
+#define DECL_PUT_BY_VAL(methodName, commentStr, shFn)                \
+  void methodName(FR frTarget, FR frKey, FR frValue) {               \
+    putByValImpl(frTarget, frKey, frValue, commentStr, shFn, #shFn); \
+  }
+
+  DECL_PUT_BY_VAL(putByValLoose, "putByValLoose", _sh_ljs_put_by_val_loose_rjs);
+  DECL_PUT_BY_VAL(
+      putByValStrict,
+      "putByValStrict",
+      _sh_ljs_put_by_val_strict_rjs);
+
+#undef DECL_PUT_BY_VAL
+
+  void putByValWithReceiver(
+      FR frTarget,
+      FR frKey,
+      FR frValue,
+      FR frReceiver,
+      bool isStrict);
+
+#define DECL_GET_BY_ID(methodName, commentStr, shFn)                           \
+  void methodName(FR frRes, SHSymbolID symID, FR frSource, uint8_t cacheIdx) { \
+    getByIdImpl(frRes, symID, frSource, cacheIdx, commentStr, shFn, #shFn);    \
+  }
+
+  DECL_GET_BY_ID(getById, "getById", _sh_ljs_get_by_id_rjs)
+  DECL_GET_BY_ID(tryGetById, "tryGetById", _sh_ljs_try_get_by_id_rjs)
+
+#undef DECL_GET_BY_ID
+
+  void getByIdWithReceiver(
+      FR frRes,
+      SHSymbolID symID,
+      FR frSource,
+      FR frReceiver,
+      uint8_t cacheIdx);
+  void getByValWithReceiver(FR frRes, FR frSource, FR frKey, FR frReceiver);
+
+#define DECL_PUT_BY_ID(methodName, commentStr, shFn)                          \
+  void methodName(                                                            \
+      FR frTarget, SHSymbolID symID, FR frValue, uint8_t cacheIdx) {          \
+    putByIdImpl(frTarget, symID, frValue, cacheIdx, commentStr, shFn, #shFn); \
+  }
+
+  DECL_PUT_BY_ID(putByIdLoose, "putByIdLoose", _sh_ljs_put_by_id_loose_rjs);
+  DECL_PUT_BY_ID(putByIdStrict, "putByIdStrict", _sh_ljs_put_by_id_strict_rjs);
+  DECL_PUT_BY_ID(
+      tryPutByIdLoose,
+      "tryPutByIdLoose",
+      _sh_ljs_try_put_by_id_loose_rjs);
+  DECL_PUT_BY_ID(
+      tryPutByIdStrict,
+      "tryPutByIdStrict",
+      _sh_ljs_try_put_by_id_strict_rjs);
+
+#undef DECL_PUT_BY_ID
+
+  void
+  defineOwnById(FR frTarget, SHSymbolID symID, FR frValue, uint8_t cacheIdx);
+  void defineOwnByIndex(FR frTarget, FR frValue, uint32_t key);
+  void defineOwnByVal(FR frTarget, FR frValue, FR frKey, bool enumerable);
+  void defineOwnGetterSetterByVal(
+      FR frTarget,
+      FR frKey,
+      FR frGetter,
+      FR frSetter,
+      bool enumerable);
+
+  void getOwnBySlotIdx(FR frRes, FR frTarget, uint32_t slotIdx);
+  void putOwnBySlotIdx(FR frTarget, FR frValue, uint32_t slotIdx);
+
+  void delByVal(FR frRes, FR frTarget, FR frKey, bool strict);
+
+  void instanceOf(FR frRes, FR frLeft, FR frRight);
+  void isIn(FR frRes, FR frLeft, FR frRight);
+
+  asmjit::Label newPrefLabel(const char *pref, size_t index);
+
+  void newObject(FR frRes);
+  void newObjectWithParent(FR frRes, FR frParent);
+  void newObjectWithBuffer(
+      FR frRes,
+      uint32_t shapeTableIndex,
+      uint32_t valBufferOffset);
+  void newArray(FR frRes, uint32_t size);
+  void newArrayWithBuffer(
+      FR frRes,
+      uint32_t numElements,
+      uint32_t numLiterals,
+      uint32_t bufferIndex);
+
+  void newFastArray(FR frRes, uint32_t size);
+  void fastArrayLength(FR frRes, FR arr);
+  void fastArrayLoad(FR frRes, FR arr, FR idx);
+  void fastArrayStore(FR arr, FR idx, FR val);
+  void fastArrayPush(FR arr, FR val);
+  void fastArrayAppend(FR arr, FR other);
+
+  void getGlobalObject(FR frRes);
+  void declareGlobalVar(SHSymbolID symID);
+  void createTopLevelEnvironment(FR frRes, uint32_t size);
+  void createFunctionEnvironment(FR frRes, uint32_t size);
+  void createEnvironment(FR frRes, FR frParent, uint32_t size);
+  void getParentEnvironment(FR frRes, uint32_t level);
+  void getEnvironment(FR frRes, FR frSource, uint32_t level);
+  void getClosureEnvironment(FR frRes, FR frClosure);
+  void loadFromEnvironment(FR frRes, FR frEnv, uint32_t slot);
+  void storeToEnvironment(bool np, FR frEnv, uint32_t slot, FR frValue);
+
+  void createClosure(
+      FR frRes,
+      FR frEnv,
+      RuntimeModule *runtimeModule,
+      uint32_t functionID);
+  void createBaseClass(FR frRes, FR frPrototypeOut, FR frEnv);
+  void
+  createDerivedClass(FR frRes, FR frPrototypeOut, FR frEnv, FR frSuperClass);
+  void createGenerator(
+      FR frRes,
+      FR frEnv,
+      RuntimeModule *runtimeModule,
+      uint32_t functionID);
+
+#define DECL_GET_ARGUMENTS_PROP_BY_VAL(methodName, commentStr, shFn) \
+  void methodName(FR frRes, FR frIndex, FR frLazyReg) {              \
+    getArgumentsPropByValImpl(                                       \
+        frRes, frIndex, frLazyReg, commentStr, shFn, #shFn);         \
+  }
+
+  DECL_GET_ARGUMENTS_PROP_BY_VAL(
+      getArgumentsPropByValLoose,
+      "GetArgumentsPropByValLoose",
+      _sh_ljs_get_arguments_prop_by_val_loose);
+  DECL_GET_ARGUMENTS_PROP_BY_VAL(
+      getArgumentsPropByValStrict,
+      "GetArgumentsPropByValStrict",
+      _sh_ljs_get_arguments_prop_by_val_strict);
+
+#undef DECL_GET_ARGUMENTS_PROP_BY_VAL
+
+  void reifyArgumentsLoose(FR frLazyReg) {
+    reifyArgumentsImpl(frLazyReg, false, "ReifyArgumentsLoose");
+  }
+  void reifyArgumentsStrict(FR frLazyReg) {
+    reifyArgumentsImpl(frLazyReg, true, "ReifyArgumentsStrict");
+  }
+
+  void getArgumentsLength(FR frRes, FR frLazyReg);
+
+  void createThis(FR frRes, FR frCallee, FR frNewTarget, uint8_t cacheIdx);
+  void selectObject(FR frRes, FR frThis, FR frConstructed);
+  void loadThisNS(FR frRes);
+  void coerceThisNS(FR frRes, FR frThis);
+  void getNewTarget(FR frRes);
+
+  void iteratorBegin(FR frRes, FR frSource);
+  void iteratorNext(FR frRes, FR frIteratorOrIdx, FR frSourceOrNext);
+  void iteratorClose(FR frIteratorOrIdx, bool ignoreExceptions);
+
+  void debugger();
+  void throwInst(FR frInput);
+  void throwIfEmpty(FR frRes, FR frInput) {
+    throwIfEmptyUndefinedImpl(frRes, frInput, true);
+  }
+  void throwIfUndefined(FR frRes, FR frInput) {
+    throwIfEmptyUndefinedImpl(frRes, frInput, false);
+  }
+  void throwIfThisInitialized(FR frInput);
+
+  void createRegExp(
+      FR frRes,
+      SHSymbolID patternID,
+      SHSymbolID flagsID,
+      uint32_t regexpID);
+
+  void loadParentNoTraps(FR frRes, FR frObj);
+  void typedLoadParent(FR frRes, FR frObj);
+  void typedStoreParent(FR frStoredValue, FR frObj);
+
+ private:
+  /// \return whether a logger is attached to the assembler.
+  bool hasLogger() const {
+#ifndef ASMJIT_NO_LOGGING
+    return logger_ != nullptr;
+#else
+    return false;
+#endif
+  }
+
+  /// \return the memory operand of frame register \p fr.
+  static x86::Mem frMem(FR fr) {
+    return x86::qword_ptr(
+        xFrame,
+        (int32_t)((fr.index() + hbc::StackFrameLayout::FirstLocal) *
+                  sizeof(SHLegacyValue)));
+  }
+
+  /// \return the memory operand of the frame slot at the given
+  ///   StackFrameLayout offset \p ofs relative to the current frame.
+  static x86::Mem frameSlot(int32_t ofs) {
+    return x86::qword_ptr(xFrame, ofs * (int32_t)sizeof(SHLegacyValue));
+  }
+
+  /// \return the memory operand of the RO DATA entry at \p ofs.
+  x86::Mem roData(int32_t ofs) const {
+    return x86::qword_ptr(roDataLabel_, ofs);
+  }
+
+  /// Load the address of frame register \p fr into \p dst.
+  void loadFrameAddr(const x86::Gp &dst, FR fr) {
+    a.lea(dst, frMem(fr));
+  }
+
+  /// Load the 64-bit value \p bits into \p dst using the shortest encoding.
+  void loadBits64InGp(const x86::Gp &dst, uint64_t bits, const char *constName);
+
+  /// Load the process-specific value \p bits, described by \p kind and
+  /// \p payload, into \p dst with an encoding that can be patched when the
+  /// code is loaded from the code cache.
+  void loadRelocatable(
+      const x86::Gp &dst,
+      uint64_t bits,
+      JITRelocKind kind,
+      uint64_t payload,
+      const char *constName);
+
+  /// Load the symbol \p symID into the low 32 bits of \p dst.
+  void loadSymbolID(const x86::Gp &dst, SHSymbolID symID);
+
+  /// Store the 64-bit value \p bits into \p mem, using \p tmp if the value
+  /// does not fit in a sign-extended 32-bit immediate.
+  void storeBits64(const x86::Mem &mem, uint64_t bits, const x86::Gp &tmp);
+
+  /// Store the return value of a runtime call (rax) into \p frRes.
+  void movFRFromRet(FR frRes) {
+    a.mov(frMem(frRes), x86::rax);
+  }
+
+  /// Load pointer to the read property cache entry \p cacheIdx in \p dst, or
+  /// nullptr if caching is disabled.
+  void loadReadCacheEntry(const x86::Gp &dst, uint8_t cacheIdx);
+  /// Load pointer to the write property cache entry \p cacheIdx in \p dst, or
+  /// nullptr if caching is disabled.
+  void loadWriteCacheEntry(const x86::Gp &dst, uint8_t cacheIdx);
+
+  /// Get the current bytecode IP in \p dst.
+  void getBytecodeIP(const x86::Gp &dst);
+
+  /// Allocate or return the offset in RO DATA of the current function's debug
+  /// name, in the format ID(name).
+  int32_t getDebugFunctionName();
+
+  /// \return the size of the area below the callee-saved registers: it holds
+  /// the SHJmpBuf and the saved SHLocals pointer if the function has a try.
+  uint32_t getLocalAreaSize() const {
+    return catchTableLabel_.isValid() ? llvh::alignTo(sizeof(SHJmpBuf) + 8, 16)
+                                      : 0;
+  }
+
+  /// \return the offset of the SHJmpBuf in the stack frame.
+  uint32_t getJmpBufOffset() const {
+    assert(catchTableLabel_.isValid() && "no SHJmpBuf on stack");
+    return 0;
+  }
+
+  /// \return the offset of the saved SHLocals pointer in the stack frame.
+  uint32_t getSavedSHLocalsOffset() const {
+    assert(catchTableLabel_.isValid() && "no saved SHLocals * on stack");
+    return sizeof(SHJmpBuf);
+  }
+
+  void frameSetup(unsigned numFrameRegs);
+  /// Save the callee-saved registers, initialize xRuntime and check for native
+  /// stack overflow. Shared by the regular and the OSR entry.
+  void saveRegistersAndCheckStack();
+  /// Set up the try block for the function's catch table, if any, and log
+  /// the entry. Shared by the regular and the OSR entry.
+  void enterTryAndLogEntry();
+  /// Emit the entry used to transfer an interpreter frame into the native code
+  /// at one of \p osrTargets, selected by runtime.currentIP.
+  void emitOSREntry(llvh::ArrayRef<OSRTarget> osrTargets);
+
+  /// \return whether register \p fr is known to contain a number.
+  bool isKnownNumber(FR fr) const {
+    return fr.index() < knownNumbers_.size() && knownNumbers_.test(fr.index());
+  }
+  /// Record that register \p fr contains a number.
+  void setKnownNumber(FR fr) {
+    if (fr.index() < knownNumbers_.size())
+      knownNumbers_.set(fr.index());
+  }
+
+  /// \return a label that deoptimizes the current instruction: the native
+  /// code is discarded and the rest of the function runs in the interpreter,
+  /// starting from emittingIP. Must be reached before the instruction has had
+  /// any side effects.
+  asmjit::Label newDeoptPath();
+
+  asmjit::Label newSlowPathLabel() {
+    return newPrefLabel("SLOW_", slowPaths_.size());
+  }
+  asmjit::Label newContLabel() {
+    return newPrefLabel("CONT_", slowPaths_.size());
+  }
+
+  int32_t reserveData(
+      int32_t dsize,
+      size_t align,
+      asmjit::TypeId typeId,
+      int32_t itemCount,
+      const char *comment = nullptr);
+  /// Register a 64-bit constant in RO DATA and return its offset.
+  int32_t uint64Const(uint64_t bits, const char *comment);
+  /// Reserve a slot in RO DATA for the process-specific pointer \p bits,
+  /// described by \p kind, and return its offset.
+  int32_t relocatableConst(
+      uint64_t bits,
+      JITRelocKind kind,
+      const char *comment);
+
+  /// Register \p fn as a call target and return the offset of the pointer to
+  /// it in RO DATA.
+  /// \param name is an optional name used for logging.
+  int32_t registerCallTarget(void *fn, const char *name = nullptr);
+
+  /// Emit an indirect call through the RO DATA pointer to \p fn. Note that
+  /// most calls into runtime functions should use \c callWithSavedIP below.
+  void callIndirect(void *fn, const char *name);
+
+  /// Emit a call to \p fn, saving the bytecode IP to Runtime::currentIP before
+  /// making the call. This should be used for all calls that may observe the
+  /// IP, such as calls that may throw exceptions, or perform allocations.
+  void callWithSavedIP(void *fn, const char *name);
+
+  /// Emit the code that runs when this function is longjmped to.
+  /// Performs the catch table lookup and jumps to the appropriate catch block,
+  /// and if no catch block is found, pops the SHJmpBuf and rethrows the
+  /// exception.
+  void emitCatchTable(llvh::ArrayRef<const asmjit::Label *> exceptionHandlers);
+  void emitSlowPaths();
+  void emitROData();
+
+  /// Set up the call frame and perform the call. The caller should have already
+  /// populated the arg count and new target registers.
+  /// \param frRes is the frame register that will contain the result.
+  /// \param frCallee is a frame register containing the callee.
+  void callImpl(FR frRes, FR frCallee);
+
+  /// Emit a call to \p slowCall with the runtime and the addresses of the
+  /// specified frame registers, and store the result in \p frRes.
+  void callWithFrameArgs(
+      FR frRes,
+      llvh::ArrayRef<FR> args,
+      void *slowCall,
+      const char *slowCallName);
+
+  void arithUnop(
+      FR frRes,
+      FR frInput,
+      const char *name,
+      double addend,
+      void *slowCall,
+      const char *slowCallName);
+
+  void arithBinOp(
+      bool forceNumber,
+      FR frRes,
+      FR frLeft,
+      FR frRight,
+      const char *name,
+      void (*fast)(x86::Assembler &a, const x86::Xmm &dl, const x86::Xmm &dr),
+      void *slowCall,
+      const char *slowCallName);
+
+  void bitBinOp(
+      FR frRes,
+      FR frLeft,
+      FR frRight,
+      bool unsignedRes,
+      const char *name,
+      SHLegacyValue (*slowCall)(
+          SHRuntime *shr,
+          const SHLegacyValue *a,
+          const SHLegacyValue *b),
+      const char *slowCallName,
+      void (*fast)(x86::Assembler &a, const x86::Gpd &dl, const x86::Gpd &dr));
+
+  void compareImpl(
+      FR frRes,
+      FR frLeft,
+      FR frRight,
+      const char *name,
+      bool swap,
+      x86::CondCode condCode,
+      void *slowCall,
+      const char *slowCallName,
+      bool invSlow,
+      bool passArgsByVal);
+
+  void jCond(
+      bool forceNumber,
+      bool invert,
+      bool passArgsByVal,
+      const asmjit::Label &target,
+      FR frLeft,
+      FR frRight,
+      const char *name,
+      bool swap,
+      x86::CondCode condCode,
+      void *slowCall,
+      const char *slowCallName);
+
+  /// Emit the call to a comparison slow path, leaving its bool result in al.
+  void emitCompareSlowCall(
+      FR frLeft,
+      FR frRight,
+      bool passArgsByVal,
+      void *slowCall,
+      const char *slowCallName);
+
+  /// Emit the checks shared by element accesses: \p frKey must be a uint32
+  /// number, which is loaded in xTmp1, and \p frObj an object, whose pointer
+  /// is loaded in xTmp0 and CellKind in xTmp2. Jump to \p slowPathLab
+  /// otherwise.
+  void elementAccessChecks(FR frObj, FR frKey, const asmjit::Label &slowPathLab);
+
+  /// With xTmp0 pointing to a JSArray and xTmp1 containing an index, load the
+  /// address of the element in the indexed storage in xTmp0, clobbering xTmp2
+  /// and xTmp3. Jump to \p slowPathLab if the index is out of range or the
+  /// element may be elsewhere, or if \p store and the array is frozen.
+  void arrayElementAddr(const asmjit::Label &slowPathLab, bool store);
+
+  /// Emit the out of line access to the element of a typed array described by
+  /// the slow path \p sl, with the registers set by elementAccessChecks().
+  /// Loads store the element in sl.frRes, and stores read the value from
+  /// sl.frInput1. Jump to sl.target for anything but a number in range, and to
+  /// sl.contLab when done.
+  void typedArrayElementAccess(const SlowPath &sl, bool store);
+
+  void putByValImpl(
+      FR frTarget,
+      FR frKey,
+      FR frValue,
+      const char *name,
+      void (*shImpl)(
+          SHRuntime *shr,
+          SHLegacyValue *target,
+          SHLegacyValue *key,
+          SHLegacyValue *value),
+      const char *shImplName);
+
+  void getByIdImpl(
+      FR frRes,
+      SHSymbolID symID,
+      FR frSource,
+      uint8_t cacheIdx,
+      const char *name,
+      SHLegacyValue (*shImpl)(
+          SHRuntime *shr,
+          const SHLegacyValue *source,
+          SHSymbolID symID,
+          SHReadPropertyCacheEntry *propCacheEntry),
+      const char *shImplName);
+
+  void putByIdImpl(
+      FR frTarget,
+      SHSymbolID symID,
+      FR frValue,
+      uint8_t cacheIdx,
+      const char *name,
+      void (*shImpl)(
+          SHRuntime *shr,
+          SHLegacyValue *target,
+          SHSymbolID symID,
+          SHLegacyValue *value,
+          SHWritePropertyCacheEntry *propCacheEntry),
+      const char *shImplName);
+
+  void getArgumentsPropByValImpl(
+      FR frRes,
+      FR frIndex,
+      FR frLazyReg,
+      const char *name,
+      SHLegacyValue (*shImpl)(
+          SHRuntime *shr,
+          SHLegacyValue *frame,
+          SHLegacyValue *idx,
+          SHLegacyValue *lazyReg),
+      const char *shImplName);
+
+  void reifyArgumentsImpl(FR frLazyReg, bool strict, const char *name);
+
+  void throwIfEmptyUndefinedImpl(FR frRes, FR frInput, bool empty);
+}; // class Emitter
+
+} // namespace hermes::vm::x86_64
@@ -204,7 +204,7 @@ CallResult<bool> ArrayImpl::_setOwnIndexedImpl(
     const auto shv = SmallHermesValue::encodeHermesValue(*value, runtime);
     Handle<ArrayImpl>::vmcast(selfHandle)
         ->getIndexedStorage(runtime)
-        ->set(runtime, index - beginIndex, shv);
+        ->setWithBarrierIfNeeded(runtime, index - beginIndex, shv);
     return true;
   }
 
@@ -554,7 +554,8 @@ CallResult<PseudoHandle<JSArray>> JSArray::createNoAllocPropStorage(
     Handle<JSObject> prototypeHandle,
     Handle<HiddenClass> classHandle,
     size_type capacity,
-    size_type length) {
+    size_type length,
+    LongLived longLived) {
   assert(length <= capacity && "length must be <= capacity");
 
   assert(
@@ -566,16 +567,33 @@ CallResult<PseudoHandle<JSArray>> JSArray::createNoAllocPropStorage(
   } lv;
   LocalsRAII lraii{runtime, &lv};
 
-  lv.self = JSObjectInit::initToPointer(
-      runtime,
-      runtime.makeAFixed<JSArray>(
-          runtime, prototypeHandle, classHandle, GCPointerBase::NoBarriers()));
+  if (LLVM_UNLIKELY(longLived == LongLived::Yes)) {
+    // The array may start out in the old generation, so its constructor has
+    // to use write barriers.
+    lv.self = JSObjectInit::initToPointer(
+        runtime,
+        runtime.makeAFixed<JSArray, HasFinalizer::No, LongLived::Yes>(
+            runtime,
+            prototypeHandle,
+            classHandle,
+            GCPointerBase::YesBarriers()));
+  } else {
+    lv.self = JSObjectInit::initToPointer(
+        runtime,
+        runtime.makeAFixed<JSArray>(
+            runtime,
+            prototypeHandle,
+            classHandle,
+            GCPointerBase::NoBarriers()));
+  }
 
   // Only allocate the storage if capacity is not zero.
   if (capacity) {
     if (LLVM_UNLIKELY(capacity > StorageType::maxElements()))
       return runtime.raiseRangeError("Out of memory for array elements");
-    auto arrRes = StorageType::create(runtime, capacity);
+    auto arrRes = longLived == LongLived::Yes
+        ? StorageType::createLongLived(runtime, capacity)
+        : StorageType::create(runtime, capacity);
     if (arrRes == ExecutionStatus::EXCEPTION) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -613,14 +631,18 @@ CallResult<PseudoHandle<JSArray>> JSArray::createAndAllocPropStorage(
   return PseudoHandle<JSArray>::create(*lv.arr);
 }
 
-CallResult<PseudoHandle<JSArray>>
-JSArray::create(Runtime &runtime, size_type capacity, size_type length) {
+CallResult<PseudoHandle<JSArray>> JSArray::create(
+    Runtime &runtime,
+    size_type capacity,
+    size_type length,
+    LongLived longLived) {
   return JSArray::createNoAllocPropStorage(
       runtime,
       Handle<JSObject>::vmcast(&runtime.arrayPrototype),
       Handle<HiddenClass>::vmcast(&runtime.arrayClass),
       capacity,
-      length);
+      length,
+      longLived);
 }
 
 CallResult<bool> JSArray::setLength(
@@ -2278,6 +2278,30 @@ arrayPrototypeSlice(void *, Runtime &runtime, NativeArgs args) {
   }
   lv.A = std::move(*arrRes);
 
+  // Fast path: O is an array whose elements can be read directly from its
+  // storage. Holes stay empty in A, which is what the slow path produces when
+  // no prototype has indexed properties.
+  if (LLVM_LIKELY(vmisa<JSArray>(*lv.O)) &&
+      LLVM_LIKELY(arrayFastPathCheck(
+          runtime, vmcast<JSArray>(*lv.O), nullptr, (uint32_t)len))) {
+    uint32_t start = k;
+    uint32_t fastCount = count;
+    if (LLVM_UNLIKELY(
+            JSArray::setStorageEndIndex(lv.A, runtime, fastCount) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    NoAllocScope noAlloc(runtime);
+    JSArray::StorageType *aStorage = lv.A->getIndexedStorage(runtime);
+    JSArray::StorageType *oStorage =
+        vmcast<JSArray>(*lv.O)->getIndexedStorage(runtime);
+    for (uint32_t j = 0; j < fastCount; ++j) {
+      aStorage->setWithBarrierIfNeeded(
+          runtime, j, oStorage->at(runtime, start + j));
+    }
+    return lv.A.getHermesValue();
+  }
+
   // Next index in A to write to.
   uint32_t n = 0;
 
@@ -2286,7 +2310,6 @@ arrayPrototypeSlice(void *, Runtime &runtime, NativeArgs args) {
   auto marker = gcScope.createMarker();
 
   // Copy the elements between the actual start and end indices into A.
-  // TODO: Implement a fast path for actual arrays.
   while (k < fin) {
     lv.k = HermesValue::encodeTrustedNumberValue(k);
     ComputedPropertyDescriptor desc;
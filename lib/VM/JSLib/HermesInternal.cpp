@@ -147,6 +147,16 @@ hermesInternalGetInstrumentedStats(void *, Runtime &runtime, NativeArgs args) {
   ADD_PROP("js_vaSize", info.va);
   ADD_PROP("js_externalBytes", info.externalBytes);
   ADD_PROP("js_markStackOverflows", info.numMarkStackOverflows);
+
+  JITCompileQueueStats jitStats =
+      runtime.getJITContext().getCompileQueueStats();
+  ADD_PROP("js_jitQueueDepth", jitStats.queueDepth);
+  ADD_PROP("js_jitMaxQueueDepth", jitStats.maxQueueDepth);
+  ADD_PROP("js_jitNumCompiled", jitStats.numCompiled);
+  ADD_PROP("js_jitCompileTime", jitStats.compileTime);
+  ADD_PROP("js_jitMaxCompileTime", jitStats.maxCompileTime);
+  ADD_PROP("js_jitQueueWaitTime", jitStats.waitTime);
+  ADD_PROP("js_jitNumOSREntries", runtime.getJITContext().getNumOSREntries());
 #undef ADD_PROP
 
   return resultHandle.getHermesValue();
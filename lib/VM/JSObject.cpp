@@ -74,7 +74,19 @@ void JSObjectBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
 
 PseudoHandle<JSObject> JSObject::create(
     Runtime &runtime,
-    Handle<JSObject> parentHandle) {
+    Handle<JSObject> parentHandle,
+    LongLived longLived) {
+  if (LLVM_UNLIKELY(longLived == LongLived::Yes)) {
+    // The object may start out in the old generation, so its constructor has
+    // to use write barriers.
+    auto *cell = runtime.makeAFixed<JSObject, HasFinalizer::No, LongLived::Yes>(
+        runtime,
+        parentHandle,
+        runtime.getHiddenClassForPrototype(
+            *parentHandle, numOverlapSlots<JSObject>()),
+        GCPointerBase::YesBarriers());
+    return JSObjectInit::initToPseudoHandle(runtime, cell);
+  }
   auto *cell = runtime.makeAFixed<JSObject>(
       runtime,
       parentHandle,
@@ -84,14 +96,18 @@ PseudoHandle<JSObject> JSObject::create(
   return JSObjectInit::initToPseudoHandle(runtime, cell);
 }
 
-PseudoHandle<JSObject> JSObject::create(Runtime &runtime) {
-  return create(runtime, Handle<JSObject>::vmcast(&runtime.objectPrototype));
+PseudoHandle<JSObject> JSObject::create(
+    Runtime &runtime,
+    LongLived longLived) {
+  return create(
+      runtime, Handle<JSObject>::vmcast(&runtime.objectPrototype), longLived);
 }
 
 PseudoHandle<JSObject> JSObject::create(
     Runtime &runtime,
-    unsigned propertyCount) {
-  auto self = create(runtime);
+    unsigned propertyCount,
+    LongLived longLived) {
+  auto self = create(runtime, longLived);
 
   return runtime.ignoreAllocationFailure(
       JSObject::allocatePropStorage(std::move(self), runtime, propertyCount));
@@ -99,8 +115,9 @@ PseudoHandle<JSObject> JSObject::create(
 
 PseudoHandle<JSObject> JSObject::create(
     Runtime &runtime,
-    Handle<HiddenClass> clazz) {
-  auto obj = JSObject::create(runtime, clazz->getNumProperties());
+    Handle<HiddenClass> clazz,
+    LongLived longLived) {
+  auto obj = JSObject::create(runtime, clazz->getNumProperties(), longLived);
   obj->clazz_.setNonNull(runtime, *clazz, runtime.getHeap());
   // If the hidden class has index like property, we need to clear the fast path
   // flag.
@@ -1104,8 +1121,6 @@ CallResult<PseudoHandle<>> JSObject::getNamedWithReceiver_RJS(
 
     // Populate the cache if requested.
     if (cacheEntry && !propObj->getClass(runtime)->isDictionaryNoCache()) {
-      cacheEntry->clazz = propObj->getClassGCPtr();
-      cacheEntry->slot = desc.slot;
       if (selfHandle->getParent(runtime) == propObj &&
           !selfHandle->getClass(runtime)->isDictionary()) {
         // Property found on an object in the prototype chain.  The proto
@@ -1120,9 +1135,10 @@ CallResult<PseudoHandle<>> JSObject::getNamedWithReceiver_RJS(
         // dictionaries, since adding a property could mean that that a
         // subsequent execution should get the value from the object rather than
         // the prototype.
-        cacheEntry->negMatchClazz = selfHandle->getClassGCPtr();
+        cacheEntry->setProto(
+            propObj->getClassGCPtr(), selfHandle->getClassGCPtr(), desc.slot);
       } else {
-        cacheEntry->negMatchClazz = CompressedPointer(nullptr);
+        cacheEntry->setOwn(propObj->getClassGCPtr(), desc.slot);
       }
     }
     return createPseudoHandle(
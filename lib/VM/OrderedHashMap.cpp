@@ -100,11 +100,12 @@ template <typename BucketType, typename Derived>
 std::pair<BucketType *, uint32_t>
 OrderedHashMapBase<BucketType, Derived>::lookupInBucket(
     Runtime &runtime,
-    uint32_t bucket,
+    uint32_t hash,
     HermesValue key) {
   assert(
       hashTable_.getNonNull(runtime)->size(runtime) == capacity_ &&
       "Inconsistent capacity");
+  uint32_t bucket = hashToBucket(capacity_, hash);
   [[maybe_unused]] const uint32_t firstBucket = bucket;
 
   NoAllocScope noAlloc{runtime};
@@ -124,7 +125,8 @@ OrderedHashMapBase<BucketType, Derived>::lookupInBucket(
     if (!isDeleted(shv)) {
       assert(shv.isObject());
       auto *entry = vmcast<BucketType>(shv.getObject(runtime));
-      if (isSameValueZero(entry->key.unboxToHV(runtime), key)) {
+      if (entry->hash == hash &&
+          isSameValueZero(entry->key.unboxToHV(runtime), key)) {
         return {entry, bucket};
       }
     }
@@ -160,23 +162,19 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::rehash(
     return ExecutionStatus::EXCEPTION;
   }
 
-  // Now re-add all entries to the hash table.
+  // Now re-add all entries to the hash table, using the hashes stored in
+  // them.
   NoAllocScope noAlloc{runtime};
-  auto newHashTableHandle =
-      runtime.makeHandle<SegmentedArraySmall>(std::move(*arrRes));
-  MutableHandle<> keyHandle{runtime};
-
   NoHandleScope noHandle{runtime};
 
-  // We can deref the handles because we are in NoAllocScope.
-  SegmentedArraySmall *newHashTable = newHashTableHandle.get();
+  // We can deref in NoAllocScope.
+  SegmentedArraySmall *newHashTable = arrRes->get();
   OrderedHashMapBase<BucketType, Derived> *rawSelf = *self;
   const uint32_t mask = rawSelf->capacity_ - 1;
   auto entry = rawSelf->firstIterationEntry_.get(runtime);
   while (entry) {
     if (!entry->isDeleted()) {
-      keyHandle = entry->key.unboxToHV(runtime);
-      uint32_t bucket = hashToBucket(rawSelf->capacity_, runtime, keyHandle);
+      uint32_t bucket = hashToBucket(rawSelf->capacity_, entry->hash);
       [[maybe_unused]] const uint32_t firstBucket = bucket;
       while (!newHashTable->at(runtime, bucket).isEmpty()) {
         // Find another bucket if it is not empty.
@@ -205,8 +203,8 @@ bool OrderedHashMapBase<BucketType, Derived>::has(
     Runtime &runtime,
     Handle<> key) {
   self->assertInitialized();
-  auto bucket = hashToBucket(self->capacity_, runtime, key);
-  return self->lookupInBucket(runtime, bucket, key.getHermesValue()).first;
+  uint32_t hash = hashKey(runtime, key);
+  return self->lookupInBucket(runtime, hash, key.getHermesValue()).first;
 }
 
 template <typename BucketType, typename Derived>
@@ -215,9 +213,8 @@ SmallHermesValue OrderedHashMapBase<BucketType, Derived>::get(
     Runtime &runtime,
     Handle<> key) {
   self->assertInitialized();
-  auto bucket = hashToBucket(self->capacity_, runtime, key);
-  auto *entry =
-      self->lookupInBucket(runtime, bucket, key.getHermesValue()).first;
+  uint32_t hash = hashKey(runtime, key);
+  auto *entry = self->lookupInBucket(runtime, hash, key.getHermesValue()).first;
   if (!entry) {
     return SmallHermesValue::encodeUndefinedValue();
   }
@@ -232,7 +229,8 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::insert(
     Handle<> key,
     Handle<> value) {
   self->assertInitialized();
-  uint32_t bucket = hashToBucket(self->capacity_, runtime, key);
+  uint32_t hash = hashKey(runtime, key);
+  uint32_t bucket;
 
   // Find the bucket for this key. It the entry already exists, update the value
   // and return.
@@ -243,7 +241,7 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::insert(
         SmallHermesValue::encodeHermesValue(value.getHermesValue(), runtime);
     BucketType *entry = nullptr;
     std::tie(entry, bucket) =
-        self->lookupInBucket(runtime, bucket, key.getHermesValue());
+        self->lookupInBucket(runtime, hash, key.getHermesValue());
     if (entry) {
       // Element for the key already exists, update value and return.
       entry->value.set(shv, runtime.getHeap());
@@ -251,7 +249,7 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::insert(
     }
   }
 
-  return doInsert(self, runtime, bucket, key, value);
+  return doInsert(self, runtime, hash, bucket, key, value);
 }
 
 template <typename BucketType, typename Derived>
@@ -261,26 +259,28 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::insert(
     Runtime &runtime,
     Handle<> key) {
   self->assertInitialized();
-  uint32_t bucket = hashToBucket(self->capacity_, runtime, key);
+  uint32_t hash = hashKey(runtime, key);
+  uint32_t bucket;
 
   // Find the bucket for this key. It the entry already exists, then return.
   {
     BucketType *entry = nullptr;
     std::tie(entry, bucket) =
-        self->lookupInBucket(runtime, bucket, key.getHermesValue());
+        self->lookupInBucket(runtime, hash, key.getHermesValue());
     if (entry) {
       return ExecutionStatus::RETURNED;
     }
   }
 
   return doInsert(
-      self, runtime, bucket, key, HandleRootOwner::getUndefinedValue());
+      self, runtime, hash, bucket, key, HandleRootOwner::getUndefinedValue());
 }
 
 template <typename BucketType, typename Derived>
 ExecutionStatus OrderedHashMapBase<BucketType, Derived>::doInsert(
     Handle<Derived> self,
     Runtime &runtime,
+    uint32_t hash,
     uint32_t bucket,
     Handle<> key,
     Handle<> value) {
@@ -292,10 +292,9 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::doInsert(
     }
 
     // Find a new empty bucket after rehash.
-    bucket = hashToBucket(self->capacity_, runtime, key);
     BucketType *entry = nullptr;
     std::tie(entry, bucket) =
-        self->lookupInBucket(runtime, bucket, key.getHermesValue());
+        self->lookupInBucket(runtime, hash, key.getHermesValue());
     assert(!entry && "After rehash, we must be able to find an empty bucket");
   }
 
@@ -314,6 +313,7 @@ ExecutionStatus OrderedHashMapBase<BucketType, Derived>::doInsert(
   auto newMapEntry = runtime.makeHandle(std::move(*crtRes));
   auto k = SmallHermesValue::encodeHermesValue(key.getHermesValue(), runtime);
   newMapEntry->key.set(k, runtime.getHeap());
+  newMapEntry->hash = hash;
   if constexpr (std::is_same_v<BucketType, HashMapEntry>) {
     auto v =
         SmallHermesValue::encodeHermesValue(value.getHermesValue(), runtime);
@@ -365,10 +365,11 @@ bool OrderedHashMapBase<BucketType, Derived>::erase(
     Runtime &runtime,
     Handle<> key) {
   self->assertInitialized();
-  uint32_t bucket = hashToBucket(self->capacity_, runtime, key);
+  uint32_t hash = hashKey(runtime, key);
   BucketType *entry = nullptr;
+  uint32_t bucket;
   std::tie(entry, bucket) =
-      self->lookupInBucket(runtime, bucket, key.getHermesValue());
+      self->lookupInBucket(runtime, hash, key.getHermesValue());
   if (!entry) {
     // Element does not exist.
     return false;
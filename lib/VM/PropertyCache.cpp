@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#define DEBUG_TYPE "vm"
+#include "hermes/VM/PropertyCache.h"
+
+#include "hermes/Support/Statistic.h"
+#include "hermes/VM/SlotAcceptor.h"
+
+STATISTIC(
+    NumPropCacheMegamorphic,
+    "NumPropCacheMegamorphic: Number of property cache entries gone megamorphic");
+
+namespace hermes {
+namespace vm {
+
+bool PolyPropertyCache::add(CompressedPointer clazzPtr, SlotIndex slot) {
+  for (Entry &entry : entries) {
+    if (!entry.clazz || entry.clazz == clazzPtr) {
+      entry.clazz = clazzPtr;
+      entry.slot = slot;
+      return true;
+    }
+  }
+  return false;
+}
+
+void PolyPropertyCache::setMegamorphic() {
+  if (!megamorphic) {
+    megamorphic = true;
+    ++NumPropCacheMegamorphic;
+  }
+}
+
+void PolyPropertyCache::markWeakRoots(WeakRootAcceptor &acceptor) {
+  for (Entry &entry : entries) {
+    if (entry.clazz)
+      acceptor.acceptWeak(entry.clazz);
+  }
+}
+
+void WritePropertyCacheEntry::set(
+    CompressedPointer clazzPtr,
+    SlotIndex newSlot) {
+  if (!clazz || clazz == clazzPtr || poly.megamorphic) {
+    clazz = clazzPtr;
+    slot = newSlot;
+    return;
+  }
+  if (!poly.add(clazzPtr, newSlot)) {
+    // Out of room: keep the older classes and let the new one thrash the
+    // primary entry, as a monomorphic cache would.
+    poly.setMegamorphic();
+    clazz = clazzPtr;
+    slot = newSlot;
+  }
+}
+
+void WritePropertyCacheEntry::markWeakRoots(WeakRootAcceptor &acceptor) {
+  if (clazz)
+    acceptor.acceptWeak(clazz);
+  poly.markWeakRoots(acceptor);
+}
+
+void ReadPropertyCacheEntry::setOwn(
+    CompressedPointer clazzPtr,
+    SlotIndex newSlot) {
+  if (!clazz || clazz == clazzPtr || poly.megamorphic) {
+    clazz = clazzPtr;
+    negMatchClazz = CompressedPointer(nullptr);
+    slot = newSlot;
+    return;
+  }
+  if (!poly.add(clazzPtr, newSlot)) {
+    poly.setMegamorphic();
+    clazz = clazzPtr;
+    negMatchClazz = CompressedPointer(nullptr);
+    slot = newSlot;
+  }
+}
+
+void ReadPropertyCacheEntry::setProto(
+    CompressedPointer protoClazzPtr,
+    CompressedPointer objClazzPtr,
+    SlotIndex newSlot) {
+  // Keep an own property that was in the primary class, if possible.
+  if (clazz && !negMatchClazz && !poly.megamorphic &&
+      !poly.add(clazz.getNoBarrierUnsafe(), slot)) {
+    poly.setMegamorphic();
+  }
+  clazz = protoClazzPtr;
+  negMatchClazz = objClazzPtr;
+  slot = newSlot;
+}
+
+void ReadPropertyCacheEntry::markWeakRoots(WeakRootAcceptor &acceptor) {
+  if (clazz)
+    acceptor.acceptWeak(clazz);
+  if (negMatchClazz)
+    acceptor.acceptWeak(negMatchClazz);
+  poly.markWeakRoots(acceptor);
+}
+
+} // namespace vm
+} // namespace hermes
+
+#undef DEBUG_TYPE
@@ -66,6 +66,36 @@ void Runtime::dumpOpcodeStats(llvh::raw_ostream &os) const {
            << inst::getOpCodeString(static_cast<inst::OpCode>(op)).data()
            << std::setw(22) << t[op] << std::setw(11) << f[op] << "\n";
   }
+
+  // Get all non-zero occurrence opcode pairs.
+  std::vector<std::pair<size_t, size_t>> pairs;
+  for (size_t i = 0; i < static_cast<uint32_t>(inst::OpCode::_last); ++i) {
+    for (size_t j = 0; j < static_cast<uint32_t>(inst::OpCode::_last); ++j) {
+      if (opcodePairFrequency[i][j])
+        pairs.emplace_back(i, j);
+    }
+  }
+
+  // sort pairs based on frequency, only the most frequent ones are printed.
+  const auto &pf = opcodePairFrequency;
+  sort(pairs.begin(), pairs.end(), [&pf](const auto &p1, const auto &p2) {
+    return pf[p1.first][p1.second] > pf[p2.first][p2.second];
+  });
+  constexpr size_t kMaxPairs = 50;
+  if (pairs.size() > kMaxPairs)
+    pairs.resize(kMaxPairs);
+
+  stream << "\nOpcode pairs sorted by frequency:\n"
+         << std::left << std::setfill(' ') << std::setw(25) << "==Opcode=="
+         << std::setw(25) << "==Next Opcode==" << std::setw(11)
+         << "==Frequency==" << "\n";
+  for (const auto &p : pairs) {
+    stream << std::left << std::setfill(' ') << std::setw(25)
+           << inst::getOpCodeString(static_cast<inst::OpCode>(p.first)).data()
+           << std::setw(25)
+           << inst::getOpCodeString(static_cast<inst::OpCode>(p.second)).data()
+           << std::setw(11) << pf[p.first][p.second] << "\n";
+  }
   os << stream.str();
 }
 #endif
@@ -378,10 +378,14 @@ Runtime::Runtime(
   GCScope scope(*this);
 
   // Explicitly initialize the specialCodeBlockRuntimeModule_ without CJS
-  // modules.
+  // modules. The bytecode is immutable, so it is generated once per process
+  // and shared by every Runtime.
+  static const Buffer *const specialBytecode =
+      generateSpecialRuntimeBytecode().release();
   specialCodeBlockRuntimeModule_->initializeWithoutCJSModulesMayAllocate(
       hbc::BCProviderFromBuffer::createBCProviderFromBuffer(
-          generateSpecialRuntimeBytecode())
+          std::make_unique<Buffer>(
+              specialBytecode->data(), specialBytecode->size()))
           .first);
   emptyCodeBlock_ = specialCodeBlockRuntimeModule_->getCodeBlockMayAllocate(0);
   returnThisCodeBlock_ =
@@ -452,6 +456,9 @@ Runtime::Runtime(
 
   symbolRegistry_.init(*this);
 
+  jitContext_.setPerfMapMode(runtimeConfig.getJITPerfMap());
+  jitContext_.setCodeCacheDir(runtimeConfig.getJITCodeCacheDir());
+
   codeCoverageProfiler_->disable();
   // FIXME: temporarily disable JIT for internal bytecode
   jitContext_.setEnabled(false);
@@ -720,10 +727,10 @@ void Runtime::markWeakRoots(WeakRootAcceptor &acceptor, bool markLongLived) {
   markDomainRefInRuntimeModules(acceptor);
   if (markLongLived) {
     for (auto &entry : fixedWritePropCache_) {
-      acceptor.acceptWeak(entry.clazz);
+      entry.markWeakRoots(acceptor);
     }
     for (auto &entry : fixedReadPropCache_) {
-      acceptor.acceptWeak(entry.clazz);
+      entry.markWeakRoots(acceptor);
     }
     for (auto &rm : runtimeModuleList_)
       rm.markLongLivedWeakRoots(acceptor);
@@ -1574,9 +1581,9 @@ std::unique_ptr<Buffer> Runtime::generateSpecialRuntimeBytecode() {
   return buffer;
 }
 
-void Runtime::initPredefinedStrings() {
-  assert(!getTopGCScope() && "There shouldn't be any handles allocated yet");
-
+/// Register the predefined property names, strings and symbols in \p table,
+/// in the order of their SymbolIDs.
+static void registerPredefinedStrings(IdentifierTable &table) {
   auto buffer = predefStringAndSymbolChars;
   auto propLengths = predefPropertyLengths;
   auto strLengths = predefStringLengths;
@@ -1592,10 +1599,10 @@ void Runtime::initPredefinedStrings() {
   (void)registered;
   const uint32_t strCount = Predefined::NumStrings;
   const uint32_t symCount = Predefined::NumSymbols;
-  identifierTable_.reserve(Predefined::_IPROP_AFTER_LAST + strCount + symCount);
+  table.reserve(Predefined::_IPROP_AFTER_LAST + strCount + symCount);
 
   for (uint32_t idx = 0; idx < Predefined::_IPROP_AFTER_LAST; ++idx) {
-    SymbolID sym = identifierTable_.createNotUniquedLazySymbol(
+    SymbolID sym = table.createNotUniquedLazySymbol(
         ASCIIRef{&buffer[offset], propLengths[idx]});
 
     assert(sym == Predefined::getSymbolID((Predefined::IProp)registered++));
@@ -1608,7 +1615,7 @@ void Runtime::initPredefinedStrings() {
       strCount == sizeof hashes / sizeof hashes[0] &&
       "Arrays should have same length");
   for (uint32_t idx = 0; idx < strCount; idx++) {
-    SymbolID sym = identifierTable_.registerLazyIdentifier(
+    SymbolID sym = table.registerLazyIdentifier(
         ASCIIRef{&buffer[offset], strLengths[idx]}, hashes[idx]);
 
     assert(sym == Predefined::getSymbolID((Predefined::Str)registered++));
@@ -1618,7 +1625,7 @@ void Runtime::initPredefinedStrings() {
   }
 
   for (uint32_t idx = 0; idx < symCount; ++idx) {
-    SymbolID sym = identifierTable_.createNotUniquedLazySymbol(
+    SymbolID sym = table.createNotUniquedLazySymbol(
         ASCIIRef{&buffer[offset], symLengths[idx]});
 
     assert(sym == Predefined::getSymbolID((Predefined::Sym)registered++));
@@ -1626,6 +1633,22 @@ void Runtime::initPredefinedStrings() {
 
     offset += symLengths[idx];
   }
+}
+
+void Runtime::initPredefinedStrings() {
+  assert(!getTopGCScope() && "There shouldn't be any handles allocated yet");
+
+  // The predefined identifiers are lazy and point into static character
+  // arrays, so they are the same in every Runtime. Build them once per
+  // process, and copy the resulting table instead of hashing and inserting
+  // each of them again. The table is never destroyed, since Runtimes may
+  // still be created during static destruction.
+  static const IdentifierTable *const predefinedTable = [] {
+    auto *table = new IdentifierTable();
+    registerPredefinedStrings(*table);
+    return table;
+  }();
+  identifierTable_.copyLazyIdentifiersFrom(*predefinedTable);
 
   assert(
       !getTopGCScope() &&
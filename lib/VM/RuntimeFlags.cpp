@@ -27,6 +27,10 @@ vm::RuntimeConfig buildRuntimeConfig(const RuntimeFlags &flags) {
                         .withShouldReleaseUnused(vm::kReleaseUnusedOld)
                         .withAllocInYoung(flags.GCAllocYoung)
                         .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI)
+                        .withNumMarkThreads(flags.GCMarkThreads)
+                        .withNumEvacuationThreads(flags.GCEvacuationThreads)
+                        .withAllocationSitePretenuring(flags.GCPretenure)
+                        .withTargetMaxPauseMs(flags.GCTargetMaxPause)
                         .build())
       .withMaxNumRegisters(flags.MaxNumRegisters)
       .withEnableEval(flags.EnableEval)
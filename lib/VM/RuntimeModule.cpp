@@ -65,6 +65,11 @@ RuntimeModule::~RuntimeModule() {
     runtime_.getCrashManager().unregisterMemory(bcProvider_.get());
   runtime_.getCrashManager().unregisterMemory(this);
   runtime_.removeRuntimeModule(this);
+  // The CodeBlocks are about to be freed, make sure that the JIT isn't
+  // compiling them in the background and that no allocation site refers to
+  // them.
+  runtime_.getJITContext().cancelCompilation(this);
+  runtime_.getHeap().getAllocationSites().removeSites(this);
 
   for (const auto &block : functionMap_) {
     runtime_.getHeap().getIDTracker().untrackNative(block.get());
@@ -785,10 +785,12 @@ static inline void putById_RJS(
     CompressedPointer clazzPtr{obj->getClassGCPtr()};
     // If we have a cache hit, reuse the cached offset and immediately
     // return the property.
-    if (LLVM_LIKELY(cacheEntry && cacheEntry->clazz == clazzPtr)) {
-      //++NumPutByIdCacheHits;
-      JSObject::setNamedSlotValueUnsafe(obj, runtime, cacheEntry->slot, shv);
-      return;
+    if (LLVM_LIKELY(cacheEntry)) {
+      if (const SlotIndex *slot = cacheEntry->find(clazzPtr)) {
+        //++NumPutByIdCacheHits;
+        JSObject::setNamedSlotValueUnsafe(obj, runtime, *slot, shv);
+        return;
+      }
     }
     NamedPropertyDescriptor desc;
     OptValue<bool> hasOwnProp =
@@ -810,8 +812,7 @@ static inline void putById_RJS(
         //(void)NumPutByIdCacheEvicts;
 #endif
         // Cache the class and property slot.
-        cacheEntry->clazz = clazzPtr;
-        cacheEntry->slot = desc.slot;
+        cacheEntry->set(clazzPtr, desc.slot);
       }
 
       // This must be valid because an own property was already found.
@@ -998,28 +999,39 @@ static inline HermesValue getByIdWithReceiver_RJS(
 
     // If we have a cache hit, reuse the cached offset and immediately
     // return the property.
-    if (LLVM_LIKELY(cacheEntry && cacheEntry->clazz == clazzPtr)) {
-      //++NumGetByIdCacheHits;
-      return JSObject::getNamedSlotValueUnsafe(obj, runtime, cacheEntry->slot)
-          .unboxToHV(runtime);
-    }
+    if (LLVM_LIKELY(cacheEntry)) {
+      if (LLVM_LIKELY(cacheEntry->clazz == clazzPtr)) {
+        //++NumGetByIdCacheHits;
+        return JSObject::getNamedSlotValueUnsafe(
+                   obj, runtime, cacheEntry->slot)
+            .unboxToHV(runtime);
+      }
 
-    // See if it's a proto cache hit.
-    if (LLVM_LIKELY(cacheEntry->negMatchClazz == clazzPtr)) {
-      // Proxy, HostObject and lazy objects have special hidden classes, so they
-      // should never match the cached class.
-      assert(!obj->getFlags().proxyObject);
-      assert(!obj->getFlags().hostObject);
-      assert(!obj->getFlags().lazyObject);
-      const GCPointer<JSObject> &parentGCPtr = obj->getParentGCPtr();
-      if (LLVM_LIKELY(parentGCPtr)) {
-        JSObject *parent = parentGCPtr.getNonNull(runtime);
-        if (LLVM_LIKELY(cacheEntry->clazz == parent->getClassGCPtr())) {
-          return JSObject::getNamedSlotValueUnsafe(
-                     parent, runtime, cacheEntry->slot)
-              .unboxToHV(runtime);
+      // See if it's a proto cache hit.
+      if (LLVM_LIKELY(cacheEntry->negMatchClazz == clazzPtr)) {
+        // Proxy, HostObject and lazy objects have special hidden classes, so
+        // they should never match the cached class.
+        assert(!obj->getFlags().proxyObject);
+        assert(!obj->getFlags().hostObject);
+        assert(!obj->getFlags().lazyObject);
+        const GCPointer<JSObject> &parentGCPtr = obj->getParentGCPtr();
+        if (LLVM_LIKELY(parentGCPtr)) {
+          JSObject *parent = parentGCPtr.getNonNull(runtime);
+          if (LLVM_LIKELY(cacheEntry->clazz == parent->getClassGCPtr())) {
+            return JSObject::getNamedSlotValueUnsafe(
+                       parent, runtime, cacheEntry->slot)
+                .unboxToHV(runtime);
+          }
         }
       }
+
+      // See if one of the polymorphic entries matches.
+      if (const PolyPropertyCache::Entry *polyEntry =
+              cacheEntry->poly.find(clazzPtr)) {
+        return JSObject::getNamedSlotValueUnsafe(
+                   obj, runtime, polyEntry->slot)
+            .unboxToHV(runtime);
+      }
     }
 
     NamedPropertyDescriptor desc;
@@ -1041,8 +1053,7 @@ static inline HermesValue getByIdWithReceiver_RJS(
         //(void)NumGetByIdCacheEvicts;
 #endif
         // Cache the class, id and property slot.
-        cacheEntry->clazz = clazzPtr;
-        cacheEntry->slot = desc.slot;
+        cacheEntry->setOwn(clazzPtr, desc.slot);
       }
 
       assert(
@@ -1281,9 +1292,11 @@ extern "C" void _sh_ljs_define_own_by_id(
   CompressedPointer clazzPtr{obj->getClassGCPtr()};
   // If we have a cache hit, reuse the cached offset and immediately write to
   // the property.
-  if (LLVM_LIKELY(cacheEntry && cacheEntry->clazz == clazzPtr)) {
-    JSObject::setNamedSlotValueUnsafe(obj, runtime, cacheEntry->slot, shv);
-    return;
+  if (LLVM_LIKELY(cacheEntry)) {
+    if (const SlotIndex *slot = cacheEntry->find(clazzPtr)) {
+      JSObject::setNamedSlotValueUnsafe(obj, runtime, *slot, shv);
+      return;
+    }
   }
   NamedPropertyDescriptor desc;
   OptValue<bool> hasOwnProp =
@@ -1296,8 +1309,7 @@ extern "C" void _sh_ljs_define_own_by_id(
     HiddenClass *clazz = vmcast<HiddenClass>(clazzPtr.getNonNull(runtime));
     if (LLVM_LIKELY(!clazz->isDictionaryNoCache()) && LLVM_LIKELY(cacheEntry)) {
       // Cache the class and property slot.
-      cacheEntry->clazz = clazzPtr;
-      cacheEntry->slot = desc.slot;
+      cacheEntry->set(clazzPtr, desc.slot);
     }
 
     // This must be valid because an own property was already found.
@@ -2067,6 +2079,21 @@ extern "C" void _sh_prstore_indirect(
       vmcast<JSObject>(*toPHV(target)), runtime, propIndex, shv);
 }
 
+extern "C" void _sh_prstore_indirect_np(
+    SHRuntime *shr,
+    SHLegacyValue *target,
+    uint32_t propIndex,
+    SHLegacyValue *value) {
+  Runtime &runtime = getRuntime(shr);
+  SmallHermesValue shv =
+      SmallHermesValue::encodeHermesValue(*toPHV(value), runtime);
+  JSObject::setNamedSlotValueNonPtrUnsafe(
+      vmcast<JSObject>(*toPHV(target)),
+      runtime,
+      propIndex + JSObject::DIRECT_PROPERTY_SLOTS,
+      shv);
+}
+
 extern "C" void _sh_typed_store_parent(
     SHRuntime *shr,
     const SHLegacyValue *storedValue,
@@ -2116,7 +2143,7 @@ extern "C" void _sh_fastarray_store(
   if (LLVM_UNLIKELY(intIndex >= storage->size() || intIndex != index))
     _sh_throw_array_oob(shr);
 
-  return storage->set(intIndex, shv, runtime.getHeap());
+  return storage->setWithBarrierIfNeeded(intIndex, shv, runtime.getHeap());
 }
 
 extern "C" void _sh_fastarray_push(
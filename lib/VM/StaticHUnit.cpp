@@ -237,18 +237,12 @@ void hermes::vm::sh_unit_mark_long_lived_weak_roots(
   for (auto &prop : llvh::makeMutableArrayRef(
            reinterpret_cast<ReadPropertyCacheEntry *>(unit->read_prop_cache),
            unit->num_read_prop_cache_entries)) {
-    if (prop.clazz)
-      acceptor.acceptWeak(prop.clazz);
-    if (prop.negMatchClazz) {
-      acceptor.acceptWeak(prop.negMatchClazz);
-    }
+    prop.markWeakRoots(acceptor);
   }
   for (auto &prop : llvh::makeMutableArrayRef(
            reinterpret_cast<WritePropertyCacheEntry *>(unit->write_prop_cache),
            unit->num_write_prop_cache_entries)) {
-    if (prop.clazz) {
-      acceptor.acceptWeak(prop.clazz);
-    }
+    prop.markWeakRoots(acceptor);
   }
 
   for (auto &entry : llvh::makeMutableArrayRef(
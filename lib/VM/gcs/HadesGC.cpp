@@ -20,7 +20,6 @@
 
 #include <array>
 #include <functional>
-#include <stack>
 
 namespace hermes {
 namespace vm {
@@ -29,9 +28,13 @@ static const char *kGCName =
     kConcurrentGC ? "hades (concurrent)" : "hades (incremental)";
 
 static const char *kCompacteeNameForCrashMgr = "COMPACT";
+static const char *kIdleCause = "idle";
+static const char *kMemoryPressureCause = "memory-pressure";
 
-// We have a target max pause time of 50ms.
-static constexpr size_t kTargetMaxPauseMs = 50;
+/// Memory pressure levels at which setMemoryPressure releases empty segments,
+/// and compacts the heap.
+static constexpr double kModerateMemoryPressure = 0.5;
+static constexpr double kCriticalMemoryPressure = 0.9;
 
 // Assert that it is always safe to construct a cell that is as large as the
 // entire segment. This lets us always assume that contiguous regions in a
@@ -50,8 +53,10 @@ void FreelistBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
 GCCell *HadesGC::OldGen::finishAlloc(GCCell *cell, uint32_t sz) {
   // Track the number of allocated bytes in a segment.
   incrementAllocatedBytes(sz);
-  // Write a mark bit so this entry doesn't get free'd by the sweeper.
-  AlignedHeapSegment::setCellMarkBit(cell);
+  // Write a mark bit so this entry doesn't get free'd by the sweeper. This is
+  // atomic since threads evacuating the YG in parallel may be setting bits in
+  // the same word.
+  AlignedHeapSegment::atomicTestAndSetCellMarkBit(cell);
   // Could overwrite the VTable, but the allocator will write a new one in
   // anyway.
   return cell;
@@ -286,9 +291,8 @@ class HadesGC::CollectionStats final {
     endTime_ = Clock::now();
   }
 
-  std::chrono::milliseconds getElapsedTime() {
-    return std::chrono::duration_cast<std::chrono::milliseconds>(
-        Clock::now() - beginTime_);
+  std::chrono::duration<double, std::milli> getElapsedTime() {
+    return Clock::now() - beginTime_;
   }
 
   /// Record this amount of CPU time was taken.
@@ -304,6 +308,10 @@ class HadesGC::CollectionStats final {
     cpuDuration_ += oscompat::thread_cpu_time() - cpuTimeSectionStart_;
     cpuTimeSectionStart_ = {};
   }
+  /// Record CPU time that was measured by another thread.
+  void addCPUTime(Duration duration) {
+    cpuDuration_ += duration;
+  }
 
   uint64_t beforeAllocatedBytes() const {
     return allocatedBefore_;
@@ -392,6 +400,125 @@ template <>
   return CompressedPointer::encodeNonNull(a, base);
 }
 
+/// State shared by the threads evacuating the YG during one collection.
+struct HadesGC::ParallelEvacState {
+  /// The number of threads evacuating.
+  const unsigned numThreads;
+  /// The number of threads that haven't run out of work. Evacuation is
+  /// complete when this drops to zero.
+  std::atomic<unsigned> numActive;
+  /// Guards allocation in the OG.
+  std::mutex allocMutex;
+  /// Guards sharedCopyLists.
+  std::mutex shareMutex;
+  /// Copy lists split off by threads with work, for idle threads to take.
+  std::vector<CopyListCell *> sharedCopyLists;
+  /// The size of sharedCopyLists, which can be read without shareMutex.
+  std::atomic<size_t> numSharedCopyLists{0};
+  /// The number of bytes evacuated by the helper threads.
+  std::atomic<uint64_t> helperEvacuatedBytes{0};
+  /// The CPU time spent by the helper threads, in microseconds.
+  std::atomic<uint64_t> helperCPUTime{0};
+
+  explicit ParallelEvacState(unsigned numThreads)
+      : numThreads{numThreads}, numActive{numThreads} {}
+};
+
+/// A range of the OG that a thread evacuating the YG bump-allocates promoted
+/// cells into. Carving each cell out of a free cell would mean splitting it,
+/// and often moving what is left to a smaller bucket, for every promotion.
+/// In a parallel evacuation, the thread also only needs to take the
+/// allocation lock to refill its buffer.
+class HadesGC::PromotionBuffer {
+ public:
+  /// The number of bytes taken from the OG at a time.
+  static constexpr uint32_t kSize = 8 * 1024;
+  /// Larger cells are allocated directly in the OG, so that at most a quarter
+  /// of each buffer is left unused.
+  static constexpr uint32_t kMaxBufferedAllocSize = kSize / 4;
+  /// The most that can be left unused at the end of a buffer: a cell that
+  /// doesn't fit, or space too small for a cell after the last one that did.
+  static constexpr uint32_t kMaxUnusedSize =
+      kMaxBufferedAllocSize + GCBase::minAllocationSize();
+
+  /// \param allocMutex guards allocation in the OG when several threads
+  ///   are evacuating, or null if this thread is the only one.
+  PromotionBuffer(HadesGC &gc, std::mutex *allocMutex)
+      : gc_{gc}, allocMutex_{allocMutex} {}
+  ~PromotionBuffer() {
+    retire();
+  }
+
+  /// Allocate \p sz bytes in the OG for a cell being promoted. The memory is
+  /// marked and has its cell head set, like memory from OldGen::alloc.
+  GCCell *alloc(uint32_t sz) {
+    if (sz > kMaxBufferedAllocSize || exhausted_)
+      return allocInOldGen(sz, /* mayGrow */ true);
+    const size_t available = end_ - level_;
+    // Only leave behind space that can hold a cell, so the segment stays
+    // parseable.
+    if (sz > available ||
+        (sz < available && available - sz < minAllocationSize())) {
+      retire();
+      // Only take a buffer from free space. Adding a segment for it would
+      // grow the heap even if the free lists could hold the cells themselves,
+      // so allocate them one at a time from now on.
+      level_ = reinterpret_cast<char *>(
+          allocInOldGen(kSize, /* mayGrow */ false));
+      if (!level_) {
+        exhausted_ = true;
+        return allocInOldGen(sz, /* mayGrow */ true);
+      }
+      end_ = level_ + kSize;
+    }
+    GCCell *const cell = reinterpret_cast<GCCell *>(level_);
+    level_ += sz;
+    FixedSizeHeapSegment::setCellHead(cell, sz);
+    // Other threads may be setting mark bits in the same word.
+    AlignedHeapSegment::atomicTestAndSetCellMarkBit(cell);
+    return cell;
+  }
+
+  /// Give back the memory of \p sz bytes at \p cell, returned by alloc but
+  /// left unused.
+  void discard(GCCell *cell, uint32_t sz) {
+    char *const start = reinterpret_cast<char *>(cell);
+    if (start + sz == level_) {
+      level_ = start;
+      return;
+    }
+    // Leave a dead cell for the sweeper to free.
+    constructCell<FillerCell>(cell, sz);
+  }
+
+  /// Fill the unused rest of the buffer with a dead cell, which keeps the
+  /// segment parseable until the sweeper frees it.
+  void retire() {
+    if (level_ != end_) {
+      GCCell *const cell = reinterpret_cast<GCCell *>(level_);
+      const uint32_t sz = end_ - level_;
+      FixedSizeHeapSegment::setCellHead(cell, sz);
+      constructCell<FillerCell>(cell, sz);
+    }
+    level_ = end_ = nullptr;
+  }
+
+ private:
+  GCCell *allocInOldGen(uint32_t sz, bool mayGrow) {
+    if (!allocMutex_)
+      return gc_.oldGen_.allocForEvacuation(sz, mayGrow);
+    std::lock_guard<std::mutex> lk{*allocMutex_};
+    return gc_.oldGen_.allocForEvacuation(sz, mayGrow);
+  }
+
+  HadesGC &gc_;
+  std::mutex *const allocMutex_;
+  char *level_{nullptr};
+  char *end_{nullptr};
+  /// Set once the OG had no free space for a whole buffer.
+  bool exhausted_{false};
+};
+
 template <bool CompactionEnabled>
 class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
                                     public WeakRootAcceptor {
@@ -459,6 +586,8 @@ class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
     assert(
         AlignedHeapSegment::getCellMarkBit(cell) &&
         "Cannot forward unmarked object");
+    if (parallel_)
+      return forwardCellParallel<T>(cell);
     if (cell->hasMarkedForwardingPointer()) {
       // Get the forwarding pointer from the header of the object.
       CompressedPointer forwardedCell = cell->getMarkedForwardingPointer();
@@ -470,7 +599,9 @@ class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
     assert(cell->isValid() && "Encountered an invalid cell");
     const auto cellSize = cell->getAllocatedSize();
     // Newly discovered cell, first forward into the old gen.
-    GCCell *const newCell = gc.oldGen_.alloc(cellSize);
+    GCCell *const newCell = promotionBuffer_
+        ? promotionBuffer_->alloc(cellSize)
+        : gc.oldGen_.alloc(cellSize);
     HERMES_SLOW_ASSERT(
         gc.inOldGen(newCell) && "Evacuated cell not in the old gen");
     assert(
@@ -492,6 +623,38 @@ class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
     return convertPtr<T>(pointerBase_, newCell);
   }
 
+  /// Variant of forwardCell for when other threads may be forwarding the same
+  /// cells. The thread that installs the forwarding pointer copies the cell
+  /// and visits it.
+  template <typename T>
+  LLVM_NODISCARD T forwardCellParallel(GCCell *const cell) {
+    assert(!isTrackingIDs_ && "Cannot track IDs from several threads");
+    KindAndSize kindAndSize;
+    if (CompressedPointer forwardedCell =
+            cell->loadMarkedForwardingPointer(kindAndSize)) {
+      // The copy may still be in progress, so don't look at it.
+      return convertPtr<T>(pointerBase_, forwardedCell);
+    }
+    const uint32_t cellSize = kindAndSize.getSize();
+    GCCell *const newCell = promotionBuffer_->alloc(cellSize);
+    if (!cell->tryInstallMarkedForwardingPointer(
+            kindAndSize,
+            CompressedPointer::encodeNonNull(newCell, pointerBase_))) {
+      promotionBuffer_->discard(newCell, cellSize);
+      const CompressedPointer forwardedCell =
+          cell->loadMarkedForwardingPointer(kindAndSize);
+      assert(forwardedCell && "Another thread should have forwarded the cell");
+      return convertPtr<T>(pointerBase_, forwardedCell);
+    }
+    // The header now holds the forwarding pointer, so restore it in the copy.
+    std::memcpy(newCell, cell, cellSize);
+    newCell->setKindAndSize(kindAndSize);
+    assert(newCell->isValid() && "Cell was copied incorrectly");
+    evacuatedBytes_ += cellSize;
+    push(static_cast<CopyListCell *>(cell));
+    return convertPtr<T>(pointerBase_, newCell);
+  }
+
   void accept(GCCell *&ptr) override {
     ptr = acceptRoot(ptr);
   }
@@ -555,6 +718,51 @@ class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
     return evacuatedBytes_;
   }
 
+  void addEvacuatedBytes(uint64_t bytes) {
+    evacuatedBytes_ += bytes;
+  }
+
+  /// Forward cells into \p promotionBuffer. Null goes back to allocating in
+  /// the OG directly. If \p parallel is true, other threads may be forwarding
+  /// the same cells at the same time.
+  void setPromotionBuffer(PromotionBuffer *promotionBuffer, bool parallel) {
+    assert((promotionBuffer || !parallel) && "Parallel needs a buffer");
+    promotionBuffer_ = promotionBuffer;
+    parallel_ = parallel;
+  }
+
+  PromotionBuffer *promotionBuffer() const {
+    return promotionBuffer_;
+  }
+
+  /// Split up to \p maxCells cells off the copy list, always leaving at least
+  /// one behind.
+  /// \return the head of the list of cells split off, or null if there were
+  ///   too few.
+  CopyListCell *splitCopyList(size_t maxCells) {
+    if (!copyListHead_)
+      return nullptr;
+    CopyListCell *const head =
+        static_cast<CopyListCell *>(copyListHead_.getNonNull(pointerBase_));
+    if (!head->next_)
+      return nullptr;
+    CopyListCell *const first =
+        static_cast<CopyListCell *>(head->next_.getNonNull(pointerBase_));
+    CopyListCell *last = first;
+    for (size_t i = 1; i < maxCells && last->next_; ++i)
+      last = static_cast<CopyListCell *>(last->next_.getNonNull(pointerBase_));
+    head->next_ = last->next_;
+    last->next_ = nullptr;
+    return first;
+  }
+
+  /// Replace the copy list, which must be empty, with the list starting at
+  /// \p head.
+  void setCopyList(CopyListCell *head) {
+    assert(!copyListHead_ && "Copy list must be empty");
+    copyListHead_ = CompressedPointer::encodeNonNull(head, pointerBase_);
+  }
+
   CopyListCell *pop() {
     if (!copyListHead_) {
       return nullptr;
@@ -576,6 +784,10 @@ class HadesGC::EvacAcceptor final : public RootAndSlotAcceptor,
   AssignableCompressedPointer copyListHead_;
   const bool isTrackingIDs_;
   uint64_t evacuatedBytes_{0};
+  /// Where promoted cells are allocated, if not directly in the OG.
+  PromotionBuffer *promotionBuffer_{nullptr};
+  /// Set while evacuating in parallel with other threads.
+  bool parallel_{false};
 
   void push(CopyListCell *cell) {
     cell->next_ = copyListHead_;
@@ -618,12 +830,68 @@ bool HadesGC::MarkWorklist::empty() {
 }
 #endif
 
+GCCell *HadesGC::MarkStack::pop() {
+  if (LLVM_UNLIKELY(cells_.empty()) && !stealInto(*this))
+    return nullptr;
+  GCCell *const cell = cells_.back();
+  cells_.pop_back();
+  return cell;
+}
+
+void HadesGC::MarkStack::share() {
+  if (cells_.size() < 2 || hasSharedWork())
+    return;
+  // Take the cells from the top of the stack, which is cheaper than taking
+  // them from the bottom and makes no difference for wide objects, where most
+  // of the cells come from.
+  const size_t n = std::min(cells_.size() / 2, kMaxBatchSize);
+  std::vector<GCCell *> batch(cells_.end() - n, cells_.end());
+  cells_.resize(cells_.size() - n);
+  std::lock_guard<Mutex> lk{mtx_};
+  batches_.push_back(std::move(batch));
+  numBatches_.store(batches_.size(), std::memory_order_relaxed);
+}
+
+bool HadesGC::MarkStack::stealInto(MarkStack &thief) {
+  if (!hasSharedWork())
+    return false;
+  std::vector<GCCell *> batch;
+  {
+    std::lock_guard<Mutex> lk{mtx_};
+    if (batches_.empty())
+      return false;
+    batch = std::move(batches_.back());
+    batches_.pop_back();
+    numBatches_.store(batches_.size(), std::memory_order_relaxed);
+  }
+  thief.cells_.insert(thief.cells_.end(), batch.begin(), batch.end());
+  return true;
+}
+
 class HadesGC::MarkAcceptor final : public RootAndSlotAcceptor {
   HadesGC &gc;
   PointerBase &pointerBase_;
+  /// The worklist cells are pushed onto once they are marked.
+  MarkStack &worklist_;
+  /// The symbols found by this acceptor.
+  llvh::BitVector &markedSymbols_;
 
  public:
-  MarkAcceptor(HadesGC &gc) : gc{gc}, pointerBase_{gc.getPointerBase()} {}
+  /// Create an acceptor for the thread holding gcMutex_.
+  MarkAcceptor(HadesGC &gc)
+      : MarkAcceptor(
+            gc,
+            gc.markState_->localWorklist,
+            gc.markState_->markedSymbols) {}
+
+  MarkAcceptor(
+      HadesGC &gc,
+      MarkStack &worklist,
+      llvh::BitVector &markedSymbols)
+      : gc{gc},
+        pointerBase_{gc.getPointerBase()},
+        worklist_{worklist},
+        markedSymbols_{markedSymbols} {}
 
   void acceptHeap(GCCell *cell, const void *heapLoc) {
     assert(cell && "Cannot pass null pointer to acceptHeap");
@@ -697,12 +965,12 @@ class HadesGC::MarkAcceptor final : public RootAndSlotAcceptor {
 
   void acceptSym(SymbolID sym) {
     const uint32_t idx = sym.unsafeGetIndex();
-    if (sym.isInvalid() || idx >= gc.markState_->markedSymbols.size()) {
+    if (sym.isInvalid() || idx >= markedSymbols_.size()) {
       // Ignore symbols that aren't valid or are pointing outside of the range
       // when the collection began.
       return;
     }
-    gc.markState_->markedSymbols[idx] = true;
+    markedSymbols_[idx] = true;
   }
 
   void accept(const RootSymbolID &sym) override {
@@ -713,14 +981,14 @@ class HadesGC::MarkAcceptor final : public RootAndSlotAcceptor {
   }
 
   void push(GCCell *cell) {
-    assert(
-        !AlignedHeapSegment::getCellMarkBit(cell) &&
-        "A marked object should never be pushed onto a worklist");
     assert(
         !gc.inYoungGen(cell) &&
         "Shouldn't ever push a YG object onto the worklist");
-    AlignedHeapSegment::setCellMarkBit(cell);
-    gc.markState_->localWorklist.push(cell);
+    // Another marking thread may have marked the cell since its mark bit was
+    // checked, in which case that thread is responsible for visiting it.
+    if (AlignedHeapSegment::atomicTestAndSetCellMarkBit(cell))
+      return;
+    worklist_.push(cell);
   }
 
  private:
@@ -773,30 +1041,207 @@ class HadesGC::MarkAcceptor final : public RootAndSlotAcceptor {
   }
 };
 
+/// A fixed set of threads that run a function in parallel with the thread that
+/// starts them, used to mark and evacuate with more than one thread.
+class HadesGC::HelperThreadPool {
+ public:
+  explicit HelperThreadPool(unsigned numThreads) {
+    for (unsigned i = 0; i < numThreads; ++i)
+      threads_.emplace_back([this, i] { worker(i + 1); });
+  }
+  ~HelperThreadPool() {
+    {
+      std::lock_guard<std::mutex> lk(mtx_);
+      shutdown_ = true;
+      startCV_.notify_all();
+    }
+    for (std::thread &thread : threads_)
+      thread.join();
+  }
+
+  /// \return the number of threads in the pool.
+  unsigned numThreads() const {
+    return threads_.size();
+  }
+
+  /// Call \p fn on every thread of the pool, with the index of the thread
+  /// starting from 1, so that the caller can use index 0. wait() must be
+  /// called before starting again.
+  void start(std::function<void(unsigned)> fn) {
+    std::lock_guard<std::mutex> lk(mtx_);
+    assert(!numRunning_ && "Threads are still running the previous function");
+    fn_ = std::move(fn);
+    numRunning_ = threads_.size();
+    ++generation_;
+    startCV_.notify_all();
+  }
+
+  /// Wait for every thread to return from the function passed to start().
+  void wait() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    doneCV_.wait(lk, [this] { return numRunning_ == 0; });
+    fn_ = nullptr;
+  }
+
+#ifndef NDEBUG
+  /// \return true if the calling thread is one of the threads of the pool.
+  bool calledByPoolThread() const {
+    for (const std::thread &thread : threads_) {
+      if (thread.get_id() == std::this_thread::get_id())
+        return true;
+    }
+    return false;
+  }
+#endif
+
+ private:
+  void worker(unsigned idx) {
+    oscompat::set_thread_name("hades-helper");
+    uint64_t lastGeneration = 0;
+    std::unique_lock<std::mutex> lk(mtx_);
+    while (true) {
+      startCV_.wait(
+          lk, [&] { return generation_ != lastGeneration || shutdown_; });
+      if (shutdown_)
+        return;
+      lastGeneration = generation_;
+      // fn_ is not modified until every thread is done with it.
+      lk.unlock();
+      fn_(idx);
+      lk.lock();
+      if (--numRunning_ == 0)
+        doneCV_.notify_one();
+    }
+  }
+
+  std::mutex mtx_;
+  /// Signalled when a function is started, or the pool shuts down.
+  std::condition_variable startCV_;
+  /// Signalled when every thread has returned from the function.
+  std::condition_variable doneCV_;
+  std::function<void(unsigned)> fn_;
+  /// Incremented every time a function is started.
+  uint64_t generation_{0};
+  /// The number of threads that haven't returned from fn_.
+  unsigned numRunning_{0};
+  bool shutdown_{false};
+  std::vector<std::thread> threads_;
+};
+
+/// State shared by the threads marking during one call to incrementalMark.
+struct HadesGC::ParallelMarkState {
+  /// The number of bytes any one thread may mark.
+  const size_t markLimit;
+  /// The number of threads marking.
+  const unsigned numThreads;
+  /// The number of threads that haven't run out of work. Marking is complete
+  /// when this drops to zero.
+  std::atomic<unsigned> numActive;
+  /// Set when the threads should stop before running out of work.
+  std::atomic<bool> stop{false};
+  /// The number of bytes marked by all the threads.
+  std::atomic<uint64_t> markedBytes{0};
+
+  ParallelMarkState(size_t markLimit, unsigned numThreads)
+      : markLimit{markLimit}, numThreads{numThreads}, numActive{numThreads} {}
+};
+
 bool HadesGC::incrementalMark(size_t markLimit) {
   assert(gcMutex_ && "Must hold the GC lock while accessing mark bits.");
-  MarkAcceptor acceptor(*this);
+  {
+    MarkAcceptor acceptor(*this);
 
-  // Pull any new items off the global worklist.
-  auto cells = markState_->globalWorklist.drain();
-  for (GCCell *cell : cells) {
-    assert(cell->isValid() && "Invalid cell received off the global worklist");
-    assert(
-        !inYoungGen(cell) &&
-        "Shouldn't ever traverse a YG object in this loop");
-    HERMES_SLOW_ASSERT(
-        dbgContains(cell) && "Non-heap cell found in global worklist");
-    if (!AlignedHeapSegment::getCellMarkBit(cell)) {
-      // Cell has not yet been marked.
-      acceptor.push(cell);
+    // Pull any new items off the global worklist.
+    auto cells = markState_->globalWorklist.drain();
+    for (GCCell *cell : cells) {
+      assert(
+          cell->isValid() && "Invalid cell received off the global worklist");
+      assert(
+          !inYoungGen(cell) &&
+          "Shouldn't ever traverse a YG object in this loop");
+      HERMES_SLOW_ASSERT(
+          dbgContains(cell) && "Non-heap cell found in global worklist");
+      if (!AlignedHeapSegment::getCellMarkBit(cell)) {
+        // Cell has not yet been marked.
+        acceptor.push(cell);
+      }
     }
   }
 
-  size_t numMarkedBytes = 0;
   assert(markLimit && "markLimit must be non-zero!");
-  while (!markState_->localWorklist.empty() && numMarkedBytes < markLimit) {
-    GCCell *const cell = markState_->localWorklist.top();
-    markState_->localWorklist.pop();
+  const unsigned numThreads = markState_->helpers.size() + 1;
+  ParallelMarkState state{markLimit, numThreads};
+  // The helpers mark on behalf of this thread, which holds gcMutex_ and waits
+  // for them before returning, so nothing else observes the heap changing.
+  if (numThreads > 1) {
+    helperThreadPool_->start([this, &state](unsigned idx) {
+      if (idx < state.numThreads)
+        markFromWorklist(idx, state);
+    });
+  }
+  markFromWorklist(0, state);
+  if (numThreads > 1)
+    helperThreadPool_->wait();
+  markState_->markedBytes += state.markedBytes.load(std::memory_order_relaxed);
+  return markState_->hasLocalWork();
+}
+
+void HadesGC::markFromWorklist(unsigned idx, ParallelMarkState &state) {
+  MarkStack &worklist = markState_->worklist(idx);
+  MarkAcceptor acceptor{
+      *this,
+      worklist,
+      idx ? markState_->helpers[idx - 1]->markedSymbols
+          : markState_->markedSymbols};
+  const bool parallel = state.numThreads > 1;
+
+  // Move a batch of cells from another thread's worklist to this one.
+  auto steal = [this, idx, &worklist, &state]() {
+    for (unsigned i = 1; i < state.numThreads; ++i) {
+      if (markState_->worklist((idx + i) % state.numThreads)
+              .stealInto(worklist))
+        return true;
+    }
+    return false;
+  };
+  auto anySharedWork = [this, &state]() {
+    for (unsigned i = 0; i < state.numThreads; ++i) {
+      if (markState_->worklist(i).hasSharedWork())
+        return true;
+    }
+    return false;
+  };
+
+  // How often to check whether the mutator is waiting for gcMutex_. This
+  // matches the amount marked at a time by a single background thread.
+  constexpr size_t kPauseCheckInterval = 8192;
+  size_t nextPauseCheck = kPauseCheckInterval;
+  size_t numMarkedBytes = 0;
+  while (!state.stop.load(std::memory_order_relaxed)) {
+    GCCell *const cell = worklist.pop();
+    if (!cell) {
+      if (steal())
+        continue;
+      // Wait for another thread to share some work, until every thread has
+      // run out. A thread only shares work while it is active, and checks
+      // every worklist before becoming inactive, so none can be left behind
+      // once there are no active threads.
+      state.numActive.fetch_sub(1, std::memory_order_acq_rel);
+      bool foundWork = false;
+      while (!state.stop.load(std::memory_order_relaxed) &&
+             state.numActive.load(std::memory_order_acquire)) {
+        if (anySharedWork()) {
+          state.numActive.fetch_add(1, std::memory_order_acq_rel);
+          if ((foundWork = steal()))
+            break;
+          state.numActive.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        std::this_thread::yield();
+      }
+      if (!foundWork)
+        break;
+      continue;
+    }
     assert(cell->isValid() && "Invalid cell in marking");
     assert(
         AlignedHeapSegment::getCellMarkBit(cell) &&
@@ -809,9 +1254,26 @@ bool HadesGC::incrementalMark(size_t markLimit) {
     const auto sz = cell->getAllocatedSize();
     numMarkedBytes += sz;
     markCell(acceptor, cell);
+    if (numMarkedBytes >= state.markLimit) {
+      state.stop.store(true, std::memory_order_relaxed);
+      break;
+    }
+    if (parallel) {
+      // Give threads that ran out of work something to do.
+      if (state.numActive.load(std::memory_order_relaxed) < state.numThreads)
+        worklist.share();
+      // The mutator can't proceed until marking stops, so check regularly
+      // whether it is waiting.
+      if (numMarkedBytes >= nextPauseCheck) {
+        nextPauseCheck = numMarkedBytes + kPauseCheckInterval;
+        if (ogPaused_.load(std::memory_order_relaxed)) {
+          state.stop.store(true, std::memory_order_relaxed);
+          break;
+        }
+      }
+    }
   }
-  markState_->markedBytes += numMarkedBytes;
-  return !markState_->localWorklist.empty();
+  state.markedBytes.fetch_add(numMarkedBytes, std::memory_order_relaxed);
 }
 
 /// Mark weak roots separately from the MarkAcceptor since this is done while
@@ -1042,7 +1504,7 @@ bool HadesGC::OldGen::sweepNext(bool backgroundThread) {
   stats.setSweptExternalBytes(sweepIterator_.sweptExternalBytes);
   const uint64_t targetSizeBytes =
       (stats.afterAllocatedBytes() + stats.afterExternalBytes()) /
-      gc_.occupancyTarget_;
+      gc_.occupancyTarget();
 
   // In a very large heap, use the configured max heap size as a backstop to
   // prevent the target size crossing it (which would delay collection and cause
@@ -1074,6 +1536,9 @@ size_t HadesGC::OldGen::getMemorySize() const {
 // Assume about 30% of the YG will survive initially.
 constexpr double kYGInitialSurvivalRatio = 0.3;
 
+// Assume YG collections initially evacuate about 100MB per second.
+constexpr double kYGInitialEvacuatedBytesPerMs = 100 << 10;
+
 HadesGC::OldGen::OldGen(HadesGC &gc) : gc_(gc) {}
 
 HadesGC::HadesGC(
@@ -1094,9 +1559,21 @@ HadesGC::HadesGC(
           // At least one YG segment and one OG segment.
           2 * FixedSizeHeapSegment::storageSize())},
       provider_(std::move(provider)),
+      targetMaxPauseMs_{std::max(gcConfig.getTargetMaxPauseMs(), 1u)},
       oldGen_{*this},
       backgroundExecutor_{
           kConcurrentGC ? std::make_unique<Executor>() : nullptr},
+      numMarkHelpers_{
+          kConcurrentGC ? std::max(gcConfig.getNumMarkThreads(), 1u) - 1 : 0},
+      numEvacuationHelpers_{
+          kConcurrentGC
+              ? std::max(gcConfig.getNumEvacuationThreads(), 1u) - 1
+              : 0},
+      helperThreadPool_{
+          std::max(numMarkHelpers_, numEvacuationHelpers_)
+              ? std::make_unique<HelperThreadPool>(
+                    std::max(numMarkHelpers_, numEvacuationHelpers_))
+              : nullptr},
       promoteYGToOG_{!gcConfig.getAllocInYoung()},
       revertToYGAtTTI_{gcConfig.getRevertToYGAtTTI()},
       overwriteDeadYGObjects_{gcConfig.getOverwriteDeadYGObjects()},
@@ -1104,7 +1581,10 @@ HadesGC::HadesGC(
       ygAverageSurvivalBytes_{
           /*weight*/ 0.5,
           /*init*/ kYGInitialSizeFactor * FixedSizeHeapSegment::maxSize() *
-              kYGInitialSurvivalRatio} {
+              kYGInitialSurvivalRatio},
+      ygEvacuatedBytesPerMs_{
+          /*weight*/ 0.5,
+          /*init*/ kYGInitialEvacuatedBytesPerMs} {
   (void)vmExperimentFlags;
   std::lock_guard<Mutex> lk(gcMutex_);
   crashMgr_->setCustomData("HermesGC", getKindAsStr().c_str());
@@ -1259,6 +1739,16 @@ void HadesGC::printStats(JSONEmitter &json) {
   json.emitKey("stats");
   json.openDict();
   json.emitKeyValue("Num compactions", numCompactions_);
+  json.emitKeyValue("Target max pause (ms)", targetMaxPauseMs_);
+  json.emitKeyValue("Pauses over target", numPausesOverTarget_);
+  json.emitKey("Pause distribution (ms)");
+  json.openDict();
+  for (size_t i = 0; i + 1 < kNumPauseBuckets; ++i)
+    json.emitKeyValue("<" + std::to_string(1u << i), pauseHistogram_[i]);
+  json.emitKeyValue(
+      ">=" + std::to_string(1u << (kNumPauseBuckets - 2)),
+      pauseHistogram_[kNumPauseBuckets - 1]);
+  json.closeDict();
   json.closeDict();
   json.closeDict();
 }
@@ -1289,6 +1779,153 @@ void HadesGC::collect(std::string cause, bool /*canEffectiveOOM*/) {
   youngGenCollection(std::move(cause), /*forceOldGenCollection*/ false);
 }
 
+void HadesGC::compact(std::string cause, double maxOccupancy) {
+  // Start from a full collection, so that the free lists tell how much of
+  // each segment is in use.
+  collect(cause);
+  std::lock_guard<Mutex> lk{gcMutex_};
+  auto isSparse = [this, maxOccupancy](size_t i) {
+    return oldGen_.allocatedBytesInSegment(i) <
+        maxOccupancy * oldGen_[i].used();
+  };
+  // A compaction only evacuates one segment, so each sparse segment takes
+  // an OG collection. Cells evacuated from one sparse segment may land in
+  // another, so only do as many collections as there were sparse segments
+  // to begin with, to guarantee that this terminates.
+  size_t numSparse = 0;
+  for (size_t i = 0; i < oldGen_.numSegments(); ++i)
+    numSparse += isSparse(i);
+  for (; numSparse; --numSparse) {
+    // A collection started by the previous iteration may have prepared a
+    // compactee of its own. Finish it before picking the next one.
+    while (concurrentPhase_ != Phase::None || compactee_.evacActive()) {
+      waitForCollectionToFinish(cause);
+      if (compactee_.evacActive())
+        youngGenCollection(cause, /*forceOldGenCollection*/ false);
+    }
+    // The compactee is removed from the OG, so at least one other segment
+    // must remain to evacuate it into.
+    if (oldGen_.numSegments() < 2)
+      break;
+    size_t sparsest = 0;
+    for (size_t i = 1; i < oldGen_.numSegments(); ++i) {
+      if (oldGen_.allocatedBytesInSegment(i) <
+          oldGen_.allocatedBytesInSegment(sparsest))
+        sparsest = i;
+    }
+    if (!isSparse(sparsest))
+      break;
+    requestedCompactee_ = &oldGen_[sparsest];
+    // The YG is empty, so this only starts the OG collection, which marks the
+    // compactee. The second YG collection then evacuates it, and its memory is
+    // returned once finalizeCompactee drops the segment.
+    youngGenCollection(cause, /*forceOldGenCollection*/ true);
+    assert(!requestedCompactee_ && "The OG collection should take the request");
+    waitForCollectionToFinish(cause);
+    youngGenCollection(cause, /*forceOldGenCollection*/ false);
+  }
+}
+
+void HadesGC::notifyIdle(std::chrono::milliseconds budget) {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point deadline = Clock::now() + budget;
+  mutatorBusy_ = false;
+  std::lock_guard<Mutex> lk{gcMutex_};
+  // Collect the YG now if it is at least half full, since it is then likely
+  // to fill up before the next idle period, and if an average YG pause fits
+  // in the budget.
+  const size_t ygCapacity = youngGen().effectiveEnd() - youngGen().start();
+  const StatsAccumulator<double> &ygTimes = ygCumulativeStats_.gcWallTime;
+  const std::chrono::duration<double> avgYGPause{
+      ygTimes.count() ? ygTimes.sum() / ygTimes.count() : 0};
+  if (!promoteYGToOG_ && youngGen().used() >= ygCapacity / 2 &&
+      avgYGPause <= budget) {
+    inIdleCollection_ = true;
+    youngGenCollection(kIdleCause, /*forceOldGenCollection*/ false);
+    inIdleCollection_ = false;
+  }
+  if (kConcurrentGC) {
+    // Marking and sweeping run in the background, but the pause that
+    // completes marking is otherwise taken by the next YG collection.
+    if (concurrentPhase_ == Phase::CompleteMarking && Clock::now() < deadline) {
+      incrementalCollect(false);
+      collectOGInBackground();
+    }
+    return;
+  }
+  // In incremental mode, do OG work that would otherwise be done during YG
+  // collections.
+  while (concurrentPhase_ != Phase::None && Clock::now() < deadline)
+    incrementalCollect(false);
+}
+
+void HadesGC::notifyBusy() {
+  mutatorBusy_ = true;
+}
+
+double HadesGC::oldGenCollectionThreshold() const {
+  // While idle, start the collection early, so that marking can make progress
+  // before the embedder is busy again.
+  if (inIdleCollection_)
+    return ogThreshold_ * 0.75;
+  // While busy, wait until the OG is halfway from the threshold to its target
+  // size. Marking may then not finish before the OG reaches its target size,
+  // in which case the OG grows past it.
+  if (mutatorBusy_)
+    return ogThreshold_ + (1 - ogThreshold_) / 2;
+  return ogThreshold_;
+}
+
+void HadesGC::setMemoryPressure(double pressure) {
+  assert(pressure >= 0 && pressure <= 1 && "Memory pressure out of range");
+  // A compaction starts with a full collection, which also makes the target
+  // size below accurate.
+  if (pressure >= kCriticalMemoryPressure)
+    compact(kMemoryPressureCause, /*maxOccupancy*/ 0.5);
+  std::lock_guard<Mutex> lk{gcMutex_};
+  memoryPressure_ = pressure;
+  // Collections start based on the target size, so shrinking it right away
+  // makes the next one start earlier. If the pressure went down instead, the
+  // target grows back as collections finish.
+  oldGen_.shrinkTargetSizeBytes(
+      (oldGen_.allocatedBytes() + oldGen_.externalBytes()) /
+      occupancyTarget());
+  if (pressure < kModerateMemoryPressure)
+    return;
+  // Finish sweeping, so that segments freed by an ongoing collection can be
+  // released.
+  waitForCollectionToFinish(kMemoryPressureCause);
+  releaseEmptySegments();
+}
+
+double HadesGC::occupancyTarget() const {
+  // Aim for an OG that is up to 95% full under critical pressure.
+  constexpr double kMaxOccupancyTarget = 0.95;
+  if (occupancyTarget_ >= kMaxOccupancyTarget)
+    return occupancyTarget_;
+  return occupancyTarget_ +
+      (kMaxOccupancyTarget - occupancyTarget_) * memoryPressure_;
+}
+
+void HadesGC::releaseEmptySegments() {
+  assert(gcMutex_ && "gcMutex_ must be held to release segments");
+  assert(
+      concurrentPhase_ == Phase::None &&
+      "Free lists are not up to date during a collection");
+  // Go backwards, since removeSegment moves the last segment into the place
+  // of the removed one.
+  for (size_t i = oldGen_.numSegments(); i-- > 0;) {
+    if (oldGen_.allocatedBytesInSegment(i))
+      continue;
+    FixedSizeHeapSegment seg = oldGen_.removeSegment(i);
+    const size_t segIdx =
+        AlignedHeapSegment::getSegmentIndexFromStart(seg.lowLim());
+    segmentIndices_.push_back(segIdx);
+    removeSegmentExtentFromCrashManager(std::to_string(segIdx));
+    // The storage is returned to the StorageProvider when seg is destroyed.
+  }
+}
+
 void HadesGC::waitForCollectionToFinish(std::string cause) {
   assert(
       gcMutex_ &&
@@ -1313,7 +1950,9 @@ void HadesGC::waitForCollectionToFinish(std::string cause) {
   if (waitingStats) {
     waitingStats->endCPUTimeSection();
     waitingStats->setEndTime();
-    recordGCStats(std::move(*waitingStats).getEvent(), true);
+    auto event = std::move(*waitingStats).getEvent();
+    recordPause(event.durationSecs);
+    recordGCStats(event, true);
   }
 }
 
@@ -1369,7 +2008,7 @@ void HadesGC::oldGenCollection(std::string cause, bool forceCompaction) {
 
   // Mark phase: discover all pointers that are live.
   // Initialize the marking state.
-  markState_.emplace(gcCallbacks_.getSymbolsEnd());
+  markState_.emplace(gcCallbacks_.getSymbolsEnd(), numMarkHelpers_);
   {
     MarkAcceptor acceptor(*this);
     // Roots are marked before a marking thread is spun up, so that the root
@@ -1481,8 +2120,13 @@ void HadesGC::incrementalCollect(bool backgroundThread) {
       // Drain some work from the mark worklist. If the work has finished
       // completely, move on to CompleteMarking.
       constexpr size_t kConcurrentMarkLimit = 8192;
-      size_t markLimit =
-          kConcurrentGC ? kConcurrentMarkLimit : markState_->byteDrainRate;
+      // Starting and stopping helper threads is comparatively expensive, so
+      // let them do more work at a time. They still stop promptly if the
+      // mutator needs gcMutex_.
+      constexpr size_t kParallelMarkLimit = 64 * kConcurrentMarkLimit;
+      size_t markLimit = !kConcurrentGC ? markState_->byteDrainRate
+          : numMarkHelpers_             ? kParallelMarkLimit
+                                        : kConcurrentMarkLimit;
       if (!incrementalMark(markLimit))
         concurrentPhase_ = Phase::CompleteMarking;
       break;
@@ -1533,12 +2177,25 @@ void HadesGC::prepareCompactee(bool forceCompaction) {
   // the OG.
   uint64_t buffer = std::max<uint64_t>(
       oldGen_.targetSizeBytes() / 20, FixedSizeHeapSegment::maxSize());
+  // Compacting adds the evacuation of the compactee to a YG pause, so when
+  // that would take a large part of the pause budget, compact less readily.
+  buffer = static_cast<uint64_t>(buffer * compactionThresholdFactor());
   uint64_t threshold = oldGen_.targetSizeBytes() + buffer;
   uint64_t totalBytes = oldGen_.size() + oldGen_.externalBytes();
-  if ((forceCompaction || totalBytes > threshold) &&
+  if (requestedCompactee_) {
+    size_t i = 0;
+    while (&oldGen_[i] != requestedCompactee_)
+      ++i;
+    requestedCompactee_ = nullptr;
+    compactee_.segment =
+        std::make_shared<FixedSizeHeapSegment>(oldGen_.removeSegment(i));
+  } else if (
+      (forceCompaction || totalBytes > threshold) &&
       oldGen_.numSegments() > 1) {
     compactee_.segment =
         std::make_shared<FixedSizeHeapSegment>(oldGen_.popSegment());
+  }
+  if (compactee_.segment) {
     addSegmentExtentToCrashManager(
         *compactee_.segment, kCompacteeNameForCrashMgr);
     compactee_.start = compactee_.segment->lowLim();
@@ -1703,6 +2360,8 @@ void HadesGC::completeMarking() {
 
   // Now free symbols and weak refs.
   markState_->markedSymbols |= markState_->writeBarrierMarkedSymbols;
+  for (const auto &helper : markState_->helpers)
+    markState_->markedSymbols |= helper->markedSymbols;
   gcCallbacks_.freeSymbols(markState_->markedSymbols);
 
   // Nothing needs markState_ from this point onward.
@@ -1996,9 +2655,10 @@ void HadesGC::ttiReached() {
 
 bool HadesGC::calledByBackgroundThread() const {
   // If the background thread is active, check if this thread matches the
-  // background thread.
+  // background thread or one of the helper threads.
   return kConcurrentGC &&
-      backgroundExecutor_->getThreadId() == std::this_thread::get_id();
+      (backgroundExecutor_->getThreadId() == std::this_thread::get_id() ||
+       (helperThreadPool_ && helperThreadPool_->calledByPoolThread()));
 }
 
 bool HadesGC::validPointer(const void *p) const {
@@ -2077,6 +2737,15 @@ void *HadesGC::allocLongLived(uint32_t sz) {
       "Call to allocLongLived must use a size aligned to HeapAlign");
   assert(gcMutex_ && "GC mutex must be held when calling allocLongLived");
   totalAllocatedBytes_ += sz;
+  // OG collections are only started after a YG collection, so with
+  // pretenuring, charge the YG for these bytes as if they had been promoted
+  // from it. Otherwise a program that mostly allocates from pretenured sites
+  // would never collect the OG.
+  if (getAllocationSites().isEnabled()) {
+    youngGen_.setEffectiveEnd(
+        youngGen_.effectiveEnd() -
+        std::min<size_t>(sz, youngGen_.available()));
+  }
   // Alloc directly into the old gen.
   return oldGen_.alloc(sz);
 }
@@ -2091,6 +2760,28 @@ GCCell *HadesGC::OldGen::alloc(uint32_t sz) {
   if (GCCell *cell = search(sz)) {
     return cell;
   }
+  // If the OG is being swept, the segments that haven't been swept yet likely
+  // hold enough garbage for this allocation. Sweep them on demand instead of
+  // growing the heap while their free space is still unavailable. This is not
+  // done during a YG collection, since the cells being promoted may not have
+  // been scanned yet.
+  // Sweeping on the mutator is a pause, so stop once half of the pause budget
+  // is spent and grow the heap instead; the background thread sweeps the rest.
+  // If the mutator sweeps the last segment, the background thread still
+  // finishes the collection.
+  if (gc_.concurrentPhase_ == Phase::Sweep && !gc_.inGC() &&
+      sweepSegmentsRemaining()) {
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    const std::chrono::duration<double, std::milli> budget{
+        gc_.targetMaxPauseMs_ / 2.0};
+    gc_.ogCollectionStats_->addCollectionType("lazy sweeping");
+    do {
+      sweepNext(/* backgroundThread */ false);
+      if (GCCell *cell = search(sz))
+        return cell;
+    } while (sweepSegmentsRemaining() && Clock::now() - start < budget);
+  }
   // Before waiting for a collection to finish, check if we're below the max
   // heap size and can simply allocate another segment. This will prevent
   // blocking the YG unnecessarily.
@@ -2128,6 +2819,34 @@ GCCell *HadesGC::OldGen::alloc(uint32_t sz) {
   gc_.oom(seg.getError());
 }
 
+GCCell *HadesGC::OldGen::allocForEvacuation(uint32_t sz, bool mayGrow) {
+  assert(
+      isSizeHeapAligned(sz) &&
+      "Should be aligned before entering this function");
+  assert(sz >= minAllocationSize() && "Allocating too small of an object");
+  assert(sz <= maxAllocationSize() && "Allocating too large of an object");
+  if (GCCell *cell = search(sz)) {
+    return cell;
+  }
+  if (!mayGrow)
+    return nullptr;
+  // canPromoteWithoutCollecting has already checked that there is room for
+  // every cell that can be promoted.
+  llvh::ErrorOr<FixedSizeHeapSegment> seg =
+      gc_.createSegment(/* checkMaxHeapSize */ false);
+  if (!seg)
+    gc_.oom(seg.getError());
+  // New segments have all of their mark bits set, so the cell is already
+  // marked.
+  AllocResult res = seg->alloc(sz);
+  assert(
+      res.success &&
+      "A newly created segment should always be able to allocate");
+  FixedSizeHeapSegment::setCellHead(static_cast<GCCell *>(res.ptr), sz);
+  addSegment(std::move(seg.get()));
+  return static_cast<GCCell *>(res.ptr);
+}
+
 uint32_t HadesGC::OldGen::getFreelistBucket(uint32_t size) {
   // If the size corresponds to the "small" portion of the freelist, then the
   // bucket is just (size) / (heap alignment)
@@ -2237,11 +2956,13 @@ GCCell *HadesGC::OldGen::search(uint32_t sz) {
   return nullptr;
 }
 
-template <typename Acceptor>
-void HadesGC::youngGenEvacuateImpl(Acceptor &acceptor, bool doCompaction) {
+template <bool CompactionEnabled>
+void HadesGC::youngGenEvacuateImpl(
+    EvacAcceptor<CompactionEnabled> &acceptor,
+    bool doCompaction) {
   // Marking each object puts it onto an embedded free list.
   {
-    DroppingAcceptor<Acceptor> nameAcceptor{acceptor};
+    DroppingAcceptor<EvacAcceptor<CompactionEnabled>> nameAcceptor{acceptor};
     markRoots(nameAcceptor, /*markLongLived*/ doCompaction);
 
     // Mark the values in WeakMap entries as roots for the purposes of young gen
@@ -2256,23 +2977,152 @@ void HadesGC::youngGenEvacuateImpl(Acceptor &acceptor, bool doCompaction) {
   // Find old-to-young pointers, as they are considered roots for YG
   // collection.
   scanDirtyCards(acceptor);
+  // Scanning cards walks OG cells, so it can't run while part of a promotion
+  // buffer is unformatted. From now on, promoted cells are bump-allocated
+  // unless the OG may need to be collected to make room for them, since only
+  // OldGen::alloc can wait for that.
+  llvh::Optional<PromotionBuffer> promotionBuffer;
+  if (canPromoteWithoutCollecting(/* numBuffers */ 1)) {
+    promotionBuffer.emplace(*this, /* allocMutex */ nullptr);
+    acceptor.setPromotionBuffer(&*promotionBuffer, /* parallel */ false);
+  }
   // Iterate through the copy list to find new pointers.
-  while (CopyListCell *const copyCell = acceptor.pop()) {
+  if (!evacuateInParallel(acceptor)) {
+    while (CopyListCell *const copyCell = acceptor.pop()) {
+      assert(
+          copyCell->hasMarkedForwardingPointer() &&
+          "Discovered unmarked object");
+      assert(
+          (inYoungGen(copyCell) || compactee_.evacContains(copyCell)) &&
+          "Unexpected object in YG collection");
+      // Update the pointers inside the forwarded object, since the old
+      // object is only there for the forwarding pointer.
+      GCCell *const cell =
+          copyCell->getMarkedForwardingPointer().getNonNull(getPointerBase());
+      markCell(acceptor, cell);
+    }
+  }
+  // Nothing else is promoted, so leave the OG parseable.
+  acceptor.setPromotionBuffer(nullptr, /* parallel */ false);
+  promotionBuffer.reset();
+
+  // Mark weak roots. We only need to update the long lived weak roots if we are
+  // evacuating part of the OG.
+  markWeakRoots(acceptor, /*markLongLived*/ doCompaction);
+}
+
+template <bool CompactionEnabled>
+bool HadesGC::evacuateInParallel(EvacAcceptor<CompactionEnabled> &acceptor) {
+  // Compacting collections dirty cards for pointers into the compactee, and
+  // tracking IDs updates a map for every moved cell, so both are left to this
+  // thread alone.
+  if (!numEvacuationHelpers_ || CompactionEnabled || isTrackingIDs())
+    return false;
+  // The helpers can't wait for an OG collection to free up space, so only use
+  // them if the OG can grow enough to hold everything that may be promoted.
+  // The buffer this thread used so far counts as well.
+  const unsigned numThreads = numEvacuationHelpers_ + 1;
+  if (!acceptor.promotionBuffer() ||
+      !canPromoteWithoutCollecting(numThreads + 1))
+    return false;
+
+  ygCollectionStats_->addCollectionType("parallel evacuation");
+  ParallelEvacState state{numThreads};
+  // The helpers evacuate on behalf of this thread, which holds gcMutex_ and
+  // waits for them before returning.
+  helperThreadPool_->start([this, &state](unsigned idx) {
+    if (idx >= state.numThreads)
+      return;
+    const auto cpuTimeStart = oscompat::thread_cpu_time();
+    EvacAcceptor<CompactionEnabled> helperAcceptor{*this};
+    {
+      PromotionBuffer buffer{*this, &state.allocMutex};
+      helperAcceptor.setPromotionBuffer(&buffer, /* parallel */ true);
+      evacuateFromCopyList(helperAcceptor, state);
+    }
+    state.helperEvacuatedBytes.fetch_add(
+        helperAcceptor.evacuatedBytes(), std::memory_order_relaxed);
+    state.helperCPUTime.fetch_add(
+        (oscompat::thread_cpu_time() - cpuTimeStart).count(),
+        std::memory_order_relaxed);
+  });
+  {
+    // The buffer this thread already has is refilled without the lock, so
+    // set it aside until the helpers are done.
+    PromotionBuffer *const ownBuffer = acceptor.promotionBuffer();
+    PromotionBuffer buffer{*this, &state.allocMutex};
+    acceptor.setPromotionBuffer(&buffer, /* parallel */ true);
+    evacuateFromCopyList(acceptor, state);
+    acceptor.setPromotionBuffer(ownBuffer, /* parallel */ false);
+  }
+  helperThreadPool_->wait();
+  acceptor.addEvacuatedBytes(
+      state.helperEvacuatedBytes.load(std::memory_order_relaxed));
+  // Comparing the CPU time of the collection to its wall time shows how much
+  // the helpers shortened the pause.
+  ygCollectionStats_->addCPUTime(CollectionStats::Duration{
+      state.helperCPUTime.load(std::memory_order_relaxed)});
+  return true;
+}
+
+template <bool CompactionEnabled>
+void HadesGC::evacuateFromCopyList(
+    EvacAcceptor<CompactionEnabled> &acceptor,
+    ParallelEvacState &state) {
+  // The most cells handed to an idle thread at a time.
+  constexpr size_t kShareBatchSize = 64;
+  auto take = [&acceptor, &state]() {
+    std::lock_guard<std::mutex> lk{state.shareMutex};
+    if (state.sharedCopyLists.empty())
+      return false;
+    acceptor.setCopyList(state.sharedCopyLists.back());
+    state.sharedCopyLists.pop_back();
+    state.numSharedCopyLists.store(
+        state.sharedCopyLists.size(), std::memory_order_relaxed);
+    return true;
+  };
+
+  while (true) {
+    CopyListCell *const copyCell = acceptor.pop();
+    if (!copyCell) {
+      if (take())
+        continue;
+      // Wait for another thread to share some cells, until every thread has
+      // run out. A thread only shares cells while it is active, so none can be
+      // left behind once there are no active threads.
+      state.numActive.fetch_sub(1, std::memory_order_acq_rel);
+      bool foundWork = false;
+      while (state.numActive.load(std::memory_order_acquire)) {
+        if (state.numSharedCopyLists.load(std::memory_order_relaxed)) {
+          state.numActive.fetch_add(1, std::memory_order_acq_rel);
+          if ((foundWork = take()))
+            break;
+          state.numActive.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        std::this_thread::yield();
+      }
+      if (!foundWork)
+        break;
+      continue;
+    }
     assert(
         copyCell->hasMarkedForwardingPointer() && "Discovered unmarked object");
-    assert(
-        (inYoungGen(copyCell) || compactee_.evacContains(copyCell)) &&
-        "Unexpected object in YG collection");
-    // Update the pointers inside the forwarded object, since the old
-    // object is only there for the forwarding pointer.
+    assert(inYoungGen(copyCell) && "Unexpected object in YG collection");
     GCCell *const cell =
         copyCell->getMarkedForwardingPointer().getNonNull(getPointerBase());
     markCell(acceptor, cell);
+    // Give threads that ran out of work something to do.
+    if (state.numActive.load(std::memory_order_relaxed) < state.numThreads &&
+        !state.numSharedCopyLists.load(std::memory_order_relaxed)) {
+      if (CopyListCell *const shared =
+              acceptor.splitCopyList(kShareBatchSize)) {
+        std::lock_guard<std::mutex> lk{state.shareMutex};
+        state.sharedCopyLists.push_back(shared);
+        state.numSharedCopyLists.store(
+            state.sharedCopyLists.size(), std::memory_order_relaxed);
+      }
+    }
   }
-
-  // Mark weak roots. We only need to update the long lived weak roots if we are
-  // evacuating part of the OG.
-  markWeakRoots(acceptor, /*markLongLived*/ doCompaction);
 }
 
 void HadesGC::youngGenCollection(
@@ -2316,6 +3166,8 @@ void HadesGC::youngGenCollection(
         heapBytes.before, externalBytes.before, segmentFootprint());
     ygCollectionStats_->addCollectionType("promotion");
     assert(!doCompaction && "Cannot do compactions during YG promotions.");
+    // Nothing was evacuated, so the samples can't tell what survived.
+    getAllocationSites().clearSamples();
   } else {
     auto &yg = youngGen();
 
@@ -2330,6 +3182,11 @@ void HadesGC::youngGenCollection(
       youngGenEvacuateImpl(acceptor, false);
       heapBytes.after = acceptor.evacuatedBytes();
     }
+    // Sampled cells that were evacuated have been replaced by a forwarding
+    // pointer. Cells outside the YG were allocated in the OG to begin with.
+    getAllocationSites().updateSurvivalRates([this](GCCell *cell) {
+      return !inYoungGen(cell) || cell->hasMarkedForwardingPointer();
+    });
     // Inform trackers about objects that died during this YG collection.
     if (isTrackingIDs()) {
       auto trackerCallback = [this](GCCell *cell) {
@@ -2388,8 +3245,15 @@ void HadesGC::youngGenCollection(
     // goals. Exclude compacting collections and the portion of YG time spent on
     // incremental OG collections, since they distort pause times and are
     // unaffected by YG size.
-    if (!doCompaction)
+    if (!doCompaction) {
       updateYoungGenSizeFactor();
+      // Collections that evacuate little are dominated by fixed costs, such
+      // as scanning the roots, which would underestimate the evacuation rate.
+      if (heapBytes.after >= FixedSizeHeapSegment::maxSize() / 16) {
+        ygEvacuatedBytesPerMs_.update(
+            heapBytes.after / ygCollectionStats_->getElapsedTime().count());
+      }
+    }
 
     // The effective end of our YG is no longer accurate for multiple reasons:
     // 1. transferExternalMemoryToOldGen resets the effectiveEnd to be the end.
@@ -2451,7 +3315,7 @@ void HadesGC::youngGenCollection(
           oldGen_.allocatedBytes() + oldGen_.externalBytes();
       const uint64_t totalBytes = oldGen_.targetSizeBytes();
       double allocatedRatio = static_cast<double>(totalAllocated) / totalBytes;
-      if (allocatedRatio >= ogThreshold_) {
+      if (allocatedRatio >= oldGenCollectionThreshold()) {
         oldGenCollection(kNaturalCauseForAnalytics, /*forceCompaction*/ false);
       }
     }
@@ -2463,6 +3327,7 @@ void HadesGC::youngGenCollection(
   ygCollectionStats_->setEndTime();
   ygCollectionStats_->endCPUTimeSection();
   auto statsEvent = std::move(*ygCollectionStats_).getEvent();
+  recordPause(statsEvent.durationSecs);
   recordGCStats(statsEvent, true);
   recordGCStats(statsEvent, &ygCumulativeStats_, true);
   ygCollectionStats_.reset();
@@ -2546,15 +3411,36 @@ void HadesGC::updateYoungGenSizeFactor() {
   const auto ygDuration = ygCollectionStats_->getElapsedTime().count();
   // If the YG collection has taken less than 20% of our budgeted time, increase
   // the size of the YG by 10%.
-  if (ygDuration < kTargetMaxPauseMs * 0.2)
+  if (ygDuration < targetMaxPauseMs_ * 0.2)
     ygSizeFactor_ = std::min(ygSizeFactor_ * 1.1, 1.0);
   // If the YG collection has taken more than 40% of our budgeted time, decrease
   // the size of the YG by 10%. This is meant to leave some time for OG work.
   // However, don't let the YG size drop below 25% of the segment size.
-  else if (ygDuration > kTargetMaxPauseMs * 0.4)
+  else if (ygDuration > targetMaxPauseMs_ * 0.4)
     ygSizeFactor_ = std::max(ygSizeFactor_ * 0.9, 0.25);
 }
 
+void HadesGC::recordPause(double durationSecs) {
+  const double durationMs = durationSecs * 1000;
+  if (durationMs > targetMaxPauseMs_)
+    ++numPausesOverTarget_;
+  size_t bucket = 0;
+  while (bucket + 1 < kNumPauseBuckets && durationMs >= (1u << bucket))
+    ++bucket;
+  ++pauseHistogram_[bucket];
+}
+
+double HadesGC::compactionThresholdFactor() const {
+  // prepareCompactee picks the last segment.
+  if (!oldGen_.numSegments())
+    return 1.0;
+  const double compacteeBytes =
+      oldGen_.allocatedBytesInSegment(oldGen_.numSegments() - 1);
+  const double evacuationMs = compacteeBytes / ygEvacuatedBytesPerMs_;
+  // Cap the factor, so that the OG still gets compacted on a slow device.
+  return std::min(std::max(evacuationMs / (targetMaxPauseMs_ / 2.0), 1.0), 4.0);
+}
+
 template <bool CompactionEnabled>
 void HadesGC::scanDirtyCardsForSegment(
     EvacAcceptor<CompactionEnabled> &acceptor,
@@ -2698,6 +3584,26 @@ uint64_t HadesGC::heapFootprint() const {
   return segmentFootprint() + externalBytes();
 }
 
+bool HadesGC::canPromoteWithoutCollecting(unsigned numBuffers) const {
+  // Handle sanitization ignores the maximum heap size, see createSegment.
+  if (sanitizeRate_)
+    return true;
+  uint64_t maxPromotedBytes = youngGen().used();
+  if (compactee_.evacActive())
+    maxPromotedBytes += compactee_.segment->used();
+  // Every buffer but the last holds at least kSize - kMaxUnusedSize bytes of
+  // promoted cells, so the unused ends of the buffers add at most that
+  // proportion to the promoted bytes. The last buffers are accounted for by
+  // numBuffers. Cells that don't go in a buffer may also need a new segment,
+  // the rest of which is not used.
+  maxPromotedBytes = maxPromotedBytes * PromotionBuffer::kSize /
+          (PromotionBuffer::kSize - PromotionBuffer::kMaxUnusedSize) +
+      FixedSizeHeapSegment::maxSize();
+  return heapFootprint() + maxPromotedBytes +
+      numBuffers * PromotionBuffer::kSize <=
+      maxHeapSize_;
+}
+
 uint64_t HadesGC::OldGen::allocatedBytes() const {
   return allocatedBytes_;
 }
@@ -2780,10 +3686,11 @@ FixedSizeHeapSegment &HadesGC::OldGen::operator[](size_t i) {
   return segments_[i];
 }
 
-llvh::ErrorOr<FixedSizeHeapSegment> HadesGC::createSegment() {
+llvh::ErrorOr<FixedSizeHeapSegment> HadesGC::createSegment(
+    bool checkMaxHeapSize) {
   // No heap size limit when Handle-SAN is on, to allow the heap enough room to
   // keep moving things around.
-  if (!sanitizeRate_ && heapFootprint() >= maxHeapSize_)
+  if (checkMaxHeapSize && !sanitizeRate_ && heapFootprint() >= maxHeapSize_)
     return make_error_code(OOMError::MaxHeapReached);
   auto res = FixedSizeHeapSegment::create(provider_.get(), "hades-segment");
   if (!res) {
@@ -2843,12 +3750,58 @@ FixedSizeHeapSegment HadesGC::OldGen::popSegment() {
   return oldSeg;
 }
 
+FixedSizeHeapSegment HadesGC::OldGen::removeSegment(size_t i) {
+  assert(i < segments_.size() && "Segment index out of range");
+  const size_t last = segments_.size() - 1;
+  if (i != last) {
+    // Swap the segment with the last one. The SegmentBuckets are linked into
+    // the freelists by address, so they stay in place and exchange their
+    // heads instead.
+    for (size_t bucket = 0; bucket < kNumFreelistBuckets; ++bucket) {
+      SegmentBucket &segBucket = segmentBuckets_[i][bucket];
+      SegmentBucket &lastBucket = segmentBuckets_[last][bucket];
+      if (segBucket.head)
+        segBucket.removeFromFreelist();
+      if (lastBucket.head)
+        lastBucket.removeFromFreelist();
+      const CompressedPointer head = segBucket.head;
+      segBucket.head = lastBucket.head;
+      lastBucket.head = head;
+      if (segBucket.head)
+        segBucket.addToFreelist(&buckets_[bucket]);
+      if (lastBucket.head)
+        lastBucket.addToFreelist(&buckets_[bucket]);
+    }
+    std::swap(segments_[i], segments_[last]);
+  }
+  return popSegment();
+}
+
+uint64_t HadesGC::OldGen::allocatedBytesInSegment(size_t i) const {
+  uint64_t freeBytes = 0;
+  for (const SegmentBucket &segBucket : segmentBuckets_[i]) {
+    auto *cell =
+        vmcast_or_null<FreelistCell>(segBucket.head.get(gc_.pointerBase_));
+    while (cell) {
+      freeBytes += cell->getAllocatedSize();
+      cell = vmcast_or_null<FreelistCell>(cell->next_.get(gc_.pointerBase_));
+    }
+  }
+  return segments_[i].used() - freeBytes;
+}
+
 void HadesGC::OldGen::setTargetSizeBytes(size_t targetSizeBytes) {
   assert(gc_.gcMutex_ && "Must hold gcMutex_ when accessing targetSizeBytes_.");
   assert(!targetSizeBytes_ && "Should only initialise targetSizeBytes_ once.");
   targetSizeBytes_ = ExponentialMovingAverage(0.5, targetSizeBytes);
 }
 
+void HadesGC::OldGen::shrinkTargetSizeBytes(size_t targetSizeBytes) {
+  assert(gc_.gcMutex_ && "Must hold gcMutex_ when accessing targetSizeBytes_.");
+  if (targetSizeBytes < targetSizeBytes_)
+    targetSizeBytes_ = ExponentialMovingAverage(0.5, targetSizeBytes);
+}
+
 bool HadesGC::inOldGen(const void *p) const {
   // If it isn't in any OG segment or the compactee, then this pointer is not
   // in the OG.
@@ -2867,16 +3820,17 @@ void HadesGC::yieldToOldGen() {
     if (concurrentPhase_ == Phase::Mark)
       updateDrainRate();
 
-    constexpr uint32_t kYGIncrementalCollectBudget = kTargetMaxPauseMs / 2;
+    const double incrementalCollectBudget = targetMaxPauseMs_ / 2.0;
     const auto initialPhase = concurrentPhase_;
-    // If the phase hasn't changed and we are still under 25ms after the first
-    // iteration, then we can be reasonably sure that the next iteration will
-    // also be <25ms, keeping us within 50ms even in the worst case.
+    // If the phase hasn't changed and we are still under half of the pause
+    // budget after the first iteration, then we can be reasonably sure that
+    // the next iteration will also fit in the other half, keeping us within
+    // the budget even in the worst case.
     do {
       incrementalCollect(false);
     } while (concurrentPhase_ == initialPhase &&
              ygCollectionStats_->getElapsedTime().count() <
-                 kYGIncrementalCollectBudget);
+                 incrementalCollectBudget);
 
   } else if (concurrentPhase_ == Phase::CompleteMarking) {
     incrementalCollect(false);
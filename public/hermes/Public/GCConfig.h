@@ -190,6 +190,26 @@ enum class GCEventKind {
   /* Whether to use mprotect on GC metadata between GCs. */              \
   F(constexpr, bool, ProtectMetadata, false)                             \
                                                                          \
+  /* Number of threads that mark the old generation during a */          \
+  /* concurrent collection, including the background GC thread. Only */  \
+  /* used by Hades on platforms where it runs concurrently. */           \
+  F(constexpr, unsigned, NumMarkThreads, 1)                              \
+                                                                         \
+  /* Number of threads that evacuate the young generation, */            \
+  /* including the thread that collects it. Only used by Hades on */     \
+  /* platforms where it runs concurrently. */                            \
+  F(constexpr, unsigned, NumEvacuationThreads, 1)                        \
+                                                                         \
+  /* Whether object and array allocation sites whose objects keep */     \
+  /* surviving young gen collections allocate directly in the old */     \
+  /* generation. Only used by Hades. */                                  \
+  F(constexpr, bool, AllocationSitePretenuring, false)                   \
+                                                                         \
+  /* Pause time, in milliseconds, that Hades tries to stay under. It */  \
+  /* sizes the young gen, the incremental old gen work done in a */      \
+  /* pause, and how readily the old gen is compacted. */                 \
+  F(constexpr, unsigned, TargetMaxPauseMs, 50)                           \
+                                                                         \
   /* Callout for an analytics event. */                                  \
   F(HERMES_NON_CONSTEXPR,                                                \
     std::function<void(const GCAnalyticsEvent &)>,                       \
@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 namespace hermes {
 namespace vm {
@@ -24,6 +25,17 @@ enum CompilationMode {
   ForceLazyCompilation
 };
 
+/// How JIT compiled code is described to external profilers like Linux perf.
+enum class JITPerfMapMode : int8_t {
+  /// Don't describe JIT compiled code.
+  None,
+  /// Append an entry for every compiled function to /tmp/perf-<pid>.map.
+  PerfMap,
+  /// Write every compiled function to jit-<pid>.dump in the current
+  /// directory, for use with "perf inject --jit".
+  JitDump,
+};
+
 enum class SynthTraceMode : int8_t {
   None,
   Replaying,
@@ -51,6 +63,13 @@ class PinnedHermesValue;
   /* Whether or not the JIT is enabled */                              \
   F(constexpr, bool, EnableJIT, false)                                 \
                                                                        \
+  /* How to describe JIT compiled code to external profilers */        \
+  F(constexpr, JITPerfMapMode, JITPerfMap, JITPerfMapMode::None)       \
+                                                                       \
+  /* Directory where JIT compiled code is stored and reused across     \
+   * runs, or empty to always compile. */                              \
+  F(HERMES_NON_CONSTEXPR, std::string, JITCodeCacheDir, "")            \
+                                                                       \
   /* Whether to allow eval and Function ctor */                        \
   F(constexpr, bool, EnableEval, true)                                 \
                                                                        \
@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -dump-bytecode -fno-inline -O %s | %FileCheck %s
+// RUN: %hermes -O %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+
+// Stores of non-pointer values into the placeholder slots of an object
+// literal don't need a write barrier.
+function foo(x) {
+  return {a: x | 0, b: "s" + x, c: !x};
+}
+// CHECK-LABEL: Function<foo>({{.*}}
+// CHECK:        PutOwnNPBySlotIdx r{{[0-9]+}}, r{{[0-9]+}}, 0
+// CHECK:        PutOwnBySlotIdx r{{[0-9]+}}, r{{[0-9]+}}, 1
+// CHECK:        PutOwnNPBySlotIdx r{{[0-9]+}}, r{{[0-9]+}}, 2
+
+var o = foo(3);
+print(o.a, o.b, o.c);
+// EXEC: 3 s3 false
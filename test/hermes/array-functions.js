@@ -428,6 +428,18 @@ print('empty', a.slice(-10, 10));
 // CHECK-NEXT: empty
 print('empty', a.slice());
 // CHECK-NEXT: empty
+var a = [1, , 3, {}];
+var s = a.slice(1);
+print(s.length, 0 in s, s[1], s[2] === a[3]);
+// CHECK-NEXT: 3 false 3 true
+Array.prototype[1] = 'proto';
+s = a.slice(0, 2);
+print(s.length, s.hasOwnProperty(1), s[1]);
+// CHECK-NEXT: 2 true proto
+delete Array.prototype[1];
+var a = [1, 2, 3];
+print(a.slice({valueOf() { a.length = 1; return 0; }}, 3));
+// CHECK-NEXT: 1,,
 
 print('sort');
 // CHECK-LABEL: sort
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -gc-evacuation-threads=4 %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-evacuation-threads=4 -gc-mark-threads=2 -gc-init-heap=1M %s | %FileCheck --match-full-lines %s
+
+// Young generation collections with several evacuating threads must copy each
+// surviving object exactly once, including objects reachable from many others
+// and objects too large for a promotion buffer.
+
+function makeDag(width, depth) {
+  // Every node in a level points at several nodes of the level below, so the
+  // same objects are found by different threads at once.
+  var level = [];
+  for (var i = 0; i < width; ++i) level.push({value: 1, children: []});
+  for (var d = 1; d < depth; ++d) {
+    var next = [];
+    for (var i = 0; i < width; ++i) {
+      var children = [];
+      for (var j = 0; j < 4; ++j)
+        children.push(level[(i * 7 + j * 13) % width]);
+      next.push({value: d, children: children});
+    }
+    level = next;
+  }
+  return level;
+}
+function sumDag(roots) {
+  var seen = new Set();
+  var sum = 0;
+  var stack = roots.slice();
+  while (stack.length) {
+    var node = stack.pop();
+    if (seen.has(node)) continue;
+    seen.add(node);
+    sum += node.value;
+    for (var i = 0; i < node.children.length; ++i) stack.push(node.children[i]);
+  }
+  return [seen.size, sum];
+}
+
+var dags = [];
+var bigArrays = [];
+var strings = [];
+for (var round = 0; round < 5; ++round) {
+  dags.push(makeDag(2000, 10));
+  // Arrays with more than 2 KiB of elements are promoted on their own.
+  var big = [];
+  for (var i = 0; i < 1000; ++i) big.push({value: i});
+  bigArrays.push(big);
+  for (var i = 0; i < 2000; ++i) strings.push('str' + round + '_' + i);
+  // Generate garbage so the survivors go through young gen collections.
+  var garbage = [];
+  for (var i = 0; i < 50000; ++i) garbage.push({i: i});
+}
+gc();
+
+var nodes = 0, sum = 0;
+for (var i = 0; i < dags.length; ++i) {
+  var r = sumDag(dags[i]);
+  nodes += r[0];
+  sum += r[1];
+}
+print(nodes, sum);
+// CHECK: 100000 460000
+var bigSum = 0;
+for (var i = 0; i < bigArrays.length; ++i)
+  for (var j = 0; j < bigArrays[i].length; ++j) bigSum += bigArrays[i][j].value;
+print(bigSum, strings.length, strings[0], strings[9999]);
+// CHECK-NEXT: 2497500 10000 str0_0 str4_1999
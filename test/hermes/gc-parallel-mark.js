@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -gc-mark-threads=4 %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-mark-threads=4 -gc-init-heap=1M %s | %FileCheck --match-full-lines %s
+
+// Old generation collections with several marking threads must keep every
+// reachable object alive, whether the graph is deep or wide.
+
+function makeTree(depth) {
+  if (depth === 0) return {value: 1};
+  return {left: makeTree(depth - 1), right: makeTree(depth - 1), value: depth};
+}
+function sumTree(node) {
+  if (!node.left) return node.value;
+  return node.value + sumTree(node.left) + sumTree(node.right);
+}
+
+function makeList(n) {
+  var head = null;
+  for (var i = 0; i < n; ++i) head = {next: head, value: i};
+  return head;
+}
+function sumList(node) {
+  var sum = 0;
+  for (; node; node = node.next) sum += node.value;
+  return sum;
+}
+
+var tree = makeTree(14);
+var list = makeList(50000);
+var wide = [];
+for (var i = 0; i < 50000; ++i) wide.push({value: i, name: 'name' + i});
+var symbols = {};
+for (var i = 0; i < 5000; ++i) symbols['prop' + i] = Symbol('sym' + i);
+
+for (var round = 0; round < 3; ++round) {
+  // Generate garbage to start collections while the graph is being marked.
+  var garbage = [];
+  for (var i = 0; i < 100000; ++i) garbage.push({i: i});
+  gc();
+}
+
+print(sumTree(tree), sumList(list));
+// CHECK: 49136 1249975000
+var sum = 0, names = 0;
+for (var i = 0; i < wide.length; ++i) {
+  sum += wide[i].value;
+  if (wide[i].name === 'name' + i) ++names;
+}
+print(sum, names);
+// CHECK-NEXT: 1249975000 50000
+print(symbols.prop0.toString(), symbols.prop4999.toString());
+// CHECK-NEXT: Symbol(sym0) Symbol(sym4999)
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -gc-pretenure %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-pretenure -gc-init-heap=1M -gc-mark-threads=2 %s | %FileCheck --match-full-lines %s
+
+// Objects allocated directly in the old generation by pretenured allocation
+// sites must stay reachable through pointers to young objects stored into
+// them later, and a site must keep working when its objects stop surviving.
+
+function makeRecord(i) {
+  // Every allocating instruction here is its own allocation site.
+  var rec = {id: i, name: 'rec', tags: ['a', 'b', 'c'], next: null};
+  rec.payload = {};
+  rec.list = [0, 0, 0, 0];
+  return rec;
+}
+
+function fill(rec, i) {
+  // These objects are young while rec may already be old.
+  rec.payload.value = {n: i};
+  for (var j = 0; j < rec.list.length; ++j) rec.list[j] = 'x' + (i + j);
+}
+
+// Phase 1: every record is retained, so the sites get pretenured.
+var kept = [];
+for (var i = 0; i < 200000; ++i) {
+  var rec = makeRecord(i);
+  fill(rec, i);
+  if (kept.length) kept[kept.length - 1].next = rec;
+  kept.push(rec);
+}
+gc();
+
+function check(arr) {
+  var sum = 0;
+  for (var i = 0; i < arr.length; ++i) {
+    var rec = arr[i];
+    if (rec.id !== i || rec.payload.value.n !== i) throw new Error('bad ' + i);
+    if (rec.list[3] !== 'x' + (i + 3) || rec.tags[2] !== 'c')
+      throw new Error('bad list ' + i);
+    if (i + 1 < arr.length && rec.next !== arr[i + 1])
+      throw new Error('bad next ' + i);
+    sum += rec.payload.value.n;
+  }
+  return sum;
+}
+print(kept.length, check(kept));
+// CHECK: 200000 19999900000
+
+// Phase 2: the same sites now allocate garbage, so they should go back to
+// the young generation.
+var last;
+for (var i = 0; i < 400000; ++i) {
+  last = makeRecord(i);
+  fill(last, i);
+}
+gc();
+print(last.payload.value.n, last.list[0], check(kept));
+// CHECK: 399999 x399999 19999900000
+
+// Phase 3: sites in code that is later collected are removed together with
+// their runtime module, while the objects they allocated stay alive.
+var evalKept = [];
+for (var k = 0; k < 20; ++k) {
+  evalKept.push(
+    eval(
+      '(function() { var a = []; for (var i = 0; i < 20000; ++i) ' +
+        'a.push({k: ' + k + ', i: i}); return a; })()',
+    ),
+  );
+  gc();
+}
+var evalSum = 0;
+for (var k = 0; k < evalKept.length; ++k)
+  evalSum += evalKept[k][19999].k + evalKept[k][19999].i;
+print(evalSum, check(kept));
+// CHECK-NEXT: 400170 19999900000
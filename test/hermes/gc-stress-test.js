@@ -8,6 +8,8 @@
  */
 
 // RUN: %hermes -O -gc-sanitize-handles=0 %s
+// RUN: %hermes -O -gc-sanitize-handles=0 -gc-mark-threads=4 %s
+// RUN: %hermes -O -gc-sanitize-handles=0 -gc-evacuation-threads=4 %s
 
 'use strict';
 
@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -gc-target-max-pause=1 %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-target-max-pause=1 -gc-print-stats %s 2>&1 | %FileCheck --check-prefix=STATS %s
+// REQUIRES: !gc_malloc
+
+// A tiny pause budget shrinks the young gen and makes compaction rarer, but
+// must not change what the program computes.
+
+var kept = [];
+var sum = 0;
+for (var i = 0; i < 300000; ++i) {
+  var o = {n: i, s: 'v' + i, list: [i, i + 1]};
+  if (i % 3 === 0) kept.push(o);
+  if (kept.length > 20000) {
+    for (var j = 0; j < kept.length; ++j) sum += kept[j].list[1] - kept[j].n;
+    kept = [];
+  }
+}
+print(sum, kept.length);
+// CHECK: 80004 19996
+
+// STATS: "Target max pause (ms)": 1,
+// STATS: "Pauses over target": {{[0-9]+}},
+// STATS: "Pause distribution (ms)": {
+// STATS-NEXT: "<1": {{[0-9]+}},
+// STATS: ">=1024": {{[0-9]+}}
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -target=HBC %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 -target=HBC %s | %FileCheck --match-full-lines %s
+
+// Instructions with a number fast path, mixed with operands that need the
+// generic implementation in the same loop.
+
+function mixed(vals) {
+  'noinline'
+  var s = 0, cnt = 0;
+  for (var i = 0; i < vals.length; ++i) {
+    var v = vals[i];
+    s = s + v;
+    s = s - 1;
+    s = s * 2;
+    s = s / 2;
+    if (v < 3) ++cnt;
+    if (v >= 3) cnt--;
+  }
+  return s + ':' + cnt;
+}
+print(mixed([1, 2, 3, 4]));
+// CHECK: 6:0
+print(mixed([1, '2', 3]));
+// CHECK: 3:1
+print(mixed([1, {valueOf() { return 10; }}, 0.5]));
+// CHECK: 8.5:1
+
+function params(a, b, c) {
+  'noinline'
+  var r = a;
+  if (r === undefined) r = 0;
+  if (b) r += 1;
+  if (!c) r -= 1;
+  return r;
+}
+print(params(), params(1), params(1, true), params(1, true, 'x'));
+// CHECK: -1 0 1 2
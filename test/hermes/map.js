@@ -370,6 +370,28 @@ function testZero() {
 //CHECK-NEXT: true
 }
 
+function testRehash() {
+  print('rehash');
+//CHECK-LABEL: rehash
+  // Grow the map through several rehashes while an iterator is live, and look
+  // up keys through strings that are not the ones inserted.
+  var m = new Map();
+  m.set('k0', 0);
+  var it = m.keys();
+  for (var i = 1; i < 1000; ++i)
+    m.set('k' + i, i);
+  var sum = 0;
+  for (var i = 0; i < 1000; ++i)
+    sum += m.get('k' + String(i));
+  print(sum, it.next().value, it.next().value);
+//CHECK-NEXT: 499500 k0 k1
+  // Shrink it again and check that the iterator continues in order.
+  for (var i = 2; i < 990; ++i)
+    m.delete('k' + i);
+  print(m.size, it.next().value, m.has('k500'), m.get('k995'));
+//CHECK-NEXT: 12 k990 false 995
+}
+
 var o1 = {};
 var o2 = {a: 1};
 var o3 = {a: 1, b: 2};
@@ -381,3 +403,4 @@ testClear(o1, o2, o3);
 testIteration();
 testForEach();
 testZero();
+testRehash();
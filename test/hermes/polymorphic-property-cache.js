@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -target=HBC %s | %FileCheck --match-full-lines %s
+// RUN: %shermes -exec %s | %FileCheck --match-full-lines %s
+
+// Exercise property cache sites that see several hidden classes.
+
+// Reads from objects with the property in different slots.
+print(function () {
+  var objs = [{x: 1}, {a: 0, x: 2}, {a: 0, b: 0, x: 3}, {a: 0, b: 0, c: 0, x: 4}];
+
+  function access(o) {
+    'noinline'
+    return o.x;
+  }
+
+  var sum = 0;
+  for (var i = 0; i < 10; ++i)
+    for (var j = 0; j < objs.length; ++j) sum += access(objs[j]);
+  return sum;
+}());
+// CHECK: 100
+
+// More classes than the cache can hold.
+print(function () {
+  var objs = [];
+  for (var i = 0; i < 8; ++i) {
+    var o = {};
+    for (var j = 0; j < i; ++j) o['p' + j] = j;
+    o.x = i;
+    objs.push(o);
+  }
+
+  function access(o) {
+    'noinline'
+    return o.x;
+  }
+
+  var sum = 0;
+  for (var i = 0; i < 10; ++i)
+    for (var j = 0; j < objs.length; ++j) sum += access(objs[j]);
+  return sum;
+}());
+// CHECK: 280
+
+// Mix own properties and properties found on the prototype.
+print(function () {
+  var proto = {x: 100};
+  var a = Object.create(proto);
+  var b = {x: 1};
+  var c = {a: 0, x: 2};
+
+  function access(o) {
+    'noinline'
+    return o.x;
+  }
+
+  var sum = 0;
+  for (var i = 0; i < 10; ++i) sum += access(a) + access(b) + access(c);
+  // Shadow the prototype property, the cached prototype entry must not be
+  // used anymore.
+  a.x = 1000;
+  sum += access(a);
+  return sum;
+}());
+// CHECK: 2030
+
+// Writes to objects with the property in different slots.
+print(function () {
+  var objs = [{x: 0}, {a: 0, x: 0}, {a: 0, b: 0, x: 0}];
+
+  function store(o, v) {
+    'noinline'
+    o.x = v;
+  }
+
+  for (var i = 0; i < 10; ++i)
+    for (var j = 0; j < objs.length; ++j) store(objs[j], i * 10 + j);
+  return objs.map(function (o) { return o.x; }).join(',');
+}());
+// CHECK: 90,91,92
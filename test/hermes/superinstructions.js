@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -fsuper-instructions %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -fsuper-instructions -dump-bytecode %s | %FileCheck --check-prefix=BC %s
+
+// Exercise the fused parameter and global object property loads.
+
+function getX(o) {
+  'noinline'
+  return o.x;
+}
+// BC-LABEL: Function<getX>({{.*}}
+// BC: GetByIdParam {{.*}}"x"
+
+function getThisY() {
+  'use strict'
+  'noinline'
+  return this.y;
+}
+// BC-LABEL: Function<getThisY>({{.*}}
+// BC: GetByIdParam {{.*}}"y"
+
+print(getX({x: 1}), getX({a: 0, x: 2}), getX(Object.create({x: 3})));
+// CHECK: 1 2 3
+
+print(getThisY.call({y: 'y'}), getX('abc'));
+// CHECK-NEXT: y undefined
+
+print(getX(new Proxy({}, {get: function (t, p) { return 'proxy ' + p; }})));
+// CHECK-NEXT: proxy x
+
+try {
+  getX();
+} catch (e) {
+  print(e.constructor.name);
+}
+// CHECK-NEXT: TypeError
+
+var counter = 0;
+function readGlobals() {
+  'noinline'
+  return counter + Math.max(1, 2);
+}
+// BC-LABEL: Function<readGlobals>({{.*}}
+// BC: GetByIdGlobal {{.*}}"counter"
+// BC: TryGetByIdGlobal {{.*}}"Math"
+
+function readMissing() {
+  'noinline'
+  return missingGlobal;
+}
+
+for (var i = 0; i < 3; ++i) {
+  counter = i;
+  print(readGlobals());
+}
+// CHECK-NEXT: 2
+// CHECK-NEXT: 3
+// CHECK-NEXT: 4
+
+try {
+  readMissing();
+} catch (e) {
+  print(e.constructor.name);
+}
+// CHECK-NEXT: ReferenceError
+
+globalThis.missingGlobal = 'found';
+print(readMissing());
+// CHECK-NEXT: found
+
+Object.defineProperty(globalThis, 'missingGlobal', {
+  get: function () {
+    return 'getter';
+  },
+});
+print(readMissing());
+// CHECK-NEXT: getter
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -fno-inline -Xjit -Xjit-async -Xjit-threshold=10 -Xjit-osr-threshold=10 -Xjit-crash-on-error %s | %FileCheck --match-full-lines %s
+// REQUIRES: jit
+
+// Functions compiled on the background thread keep running in the interpreter
+// until their code is installed, and produce the same results either way.
+
+function add(a, b) {
+  return a + b;
+}
+var s = 0;
+for (var i = 0; i < 100000; ++i)
+  s = add(s, i);
+print(s);
+// CHECK: 4999950000
+
+function loop(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i)
+    s += i % 7;
+  return s;
+}
+print(loop(100000));
+// CHECK: 299995
+
+function obj(o) {
+  return o.x + o.y;
+}
+var t = 0;
+for (var i = 0; i < 10000; ++i)
+  t += obj({x: i, y: 1});
+print(t);
+// CHECK: 50005000
+
+var stats = HermesInternal.getInstrumentedStats();
+print(typeof stats.js_jitNumCompiled, typeof stats.js_jitCompileTime);
+// CHECK: number number
+print(stats.js_jitMaxQueueDepth >= stats.js_jitQueueDepth);
+// CHECK: true
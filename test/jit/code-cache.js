@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: %hermes -fno-inline -Xjit -Xjit-threshold=10 -Xjit-crash-on-error -Xdump-jitcode=2 -Xjit-code-cache=%t %s | %FileCheck --match-full-lines --check-prefix=STORE %s
+// RUN: %hermes -fno-inline -Xjit -Xjit-threshold=10 -Xjit-crash-on-error -Xdump-jitcode=2 -Xjit-code-cache=%t %s | %FileCheck --match-full-lines --check-prefix=LOAD %s
+// REQUIRES: jit, x86_64, linux
+
+// The first run compiles and stores the functions. The second run loads them
+// on their first call, and the results are the same.
+
+function getXY(o) {
+  return o.x + o.y;
+}
+function greet(name) {
+  return 'hello ' + name;
+}
+function loop(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i)
+    s += i;
+  return s;
+}
+
+for (var i = 0; i < 20; ++i) {
+  getXY({x: i, y: 1});
+  greet(i);
+}
+print(getXY({x: 1, y: 2}), greet('world'), loop(2000));
+
+// STORE: JIT successfully compiled FunctionID {{[0-9]+}}, 'getXY'
+// STORE: JIT successfully compiled FunctionID {{[0-9]+}}, 'greet'
+// STORE: JIT successfully compiled FunctionID {{[0-9]+}}, 'loop'
+// STORE-NEXT: 3 hello world 1999000
+
+// LOAD-NOT: JIT compilation
+// LOAD: JIT loaded FunctionID {{[0-9]+}}, 'getXY' from the code cache
+// LOAD-NOT: JIT compilation
+// LOAD: JIT loaded FunctionID {{[0-9]+}}, 'greet' from the code cache
+// LOAD-NOT: JIT compilation
+// LOAD: JIT loaded FunctionID {{[0-9]+}}, 'loop' from the code cache
+// LOAD-NEXT: 3 hello world 1999000
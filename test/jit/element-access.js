@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -Xforce-jit -Xjit-crash-on-error %s | %FileCheck --match-full-lines %s
+// REQUIRES: jit
+
+// GetByVal and PutByVal on arrays and typed arrays, inline and through the
+// slow paths.
+
+function get(o, i) {
+  return o[i];
+}
+function put(o, i, v) {
+  o[i] = v;
+}
+
+var arr = [1, 'two', {x: 3}, , 5];
+print(get(arr, 0), get(arr, 1), get(arr, 2).x, get(arr, 3), get(arr, 5));
+// CHECK: 1 two 3 undefined undefined
+print(get(arr, -1), get(arr, 1.5), get(arr, '4'), get(arr, 'length'));
+// CHECK-NEXT: undefined undefined 5 5
+Array.prototype[3] = 'proto';
+print(get(arr, 3));
+// CHECK-NEXT: proto
+delete Array.prototype[3];
+
+put(arr, 0, 10);
+put(arr, 1, 20);
+put(arr, 2, 'str');
+put(arr, 4, {y: 1});
+put(arr, 6, 7);
+print(arr[0], arr[1], arr[2], arr[4].y, arr[6], arr.length);
+// CHECK-NEXT: 10 20 str 1 7 7
+
+var big = [];
+for (var i = 0; i < 10000; ++i)
+  put(big, i, i * 2);
+var sum = 0;
+for (var i = 0; i < 10000; ++i)
+  sum += get(big, i);
+put(big, 9000, 'x');
+print(sum, get(big, 4095), get(big, 4096), get(big, 9000), get(big, 10000));
+// CHECK-NEXT: 99990000 8190 8192 x undefined
+
+var frozen = Object.freeze([1, 2]);
+put(frozen, 0, 5);
+print(frozen[0]);
+// CHECK-NEXT: 1
+
+var accessor = [1, 2];
+Object.defineProperty(accessor, 1, {get() { return 'getter'; }});
+print(get(accessor, 0), get(accessor, 1));
+// CHECK-NEXT: 1 getter
+
+function typed(ctor, values) {
+  var ta = new ctor(values.length);
+  for (var i = 0; i < values.length; ++i)
+    put(ta, i, values[i]);
+  var res = [];
+  for (var i = 0; i < values.length; ++i)
+    res.push(get(ta, i));
+  return ctor.name + ': ' + res.join(' ');
+}
+var values = [1.5, -1, 255, 256, NaN, 0.5, 2.5, -0.5, 2 ** 32 + 3, 1e300];
+print(typed(Int8Array, values));
+// CHECK-NEXT: Int8Array: 1 -1 -1 0 0 0 2 0 3 0
+print(typed(Uint8Array, values));
+// CHECK-NEXT: Uint8Array: 1 255 255 0 0 0 2 0 3 0
+print(typed(Uint8ClampedArray, values));
+// CHECK-NEXT: Uint8ClampedArray: 2 0 255 255 0 0 2 0 255 255
+print(typed(Int16Array, values));
+// CHECK-NEXT: Int16Array: 1 -1 255 256 0 0 2 0 3 0
+print(typed(Uint16Array, values));
+// CHECK-NEXT: Uint16Array: 1 65535 255 256 0 0 2 0 3 0
+print(typed(Int32Array, values));
+// CHECK-NEXT: Int32Array: 1 -1 255 256 0 0 2 0 3 0
+print(typed(Uint32Array, values));
+// CHECK-NEXT: Uint32Array: 1 4294967295 255 256 0 0 2 0 3 0
+print(typed(Float32Array, values));
+// CHECK-NEXT: Float32Array: 1.5 -1 255 256 NaN 0.5 2.5 -0.5 4294967296 Infinity
+print(typed(Float64Array, values));
+// CHECK-NEXT: Float64Array: 1.5 -1 255 256 NaN 0.5 2.5 -0.5 4294967299 1e+300
+
+var big64 = new BigInt64Array(2);
+put(big64, 0, 5n);
+print(get(big64, 0), get(big64, 1), get(big64, 2));
+// CHECK-NEXT: 5 0 undefined
+
+var ta = new Int32Array(new ArrayBuffer(16), 4, 2);
+put(ta, 0, {valueOf() { return 42; }});
+put(ta, 1, '7');
+put(ta, 2, 9);
+print(get(ta, 0), get(ta, 1), get(ta, 2), ta.length);
+// CHECK-NEXT: 42 7 undefined 2
+
+print(get('abc', 1), get({1: 'one'}, 1), get(new Uint8Array(0), 0));
+// CHECK-NEXT: b one undefined
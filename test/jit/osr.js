@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -fno-inline -Xjit -Xjit-threshold=1000 -Xjit-osr-threshold=100 -Xjit-crash-on-error -Xdump-jitcode=2 %s | %FileCheck --match-full-lines %s
+// REQUIRES: jit
+
+// Functions that are called once but spend their time in a loop are compiled
+// and entered in the middle of the loop.
+
+function sum(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i)
+    s += i;
+  return s;
+}
+print(sum(1000));
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'sum'
+// CHECK: 499500
+
+// Return to native code from the transferred frame.
+function nested(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i)
+    for (var j = 0; j < 10; ++j)
+      s += j;
+  return s;
+}
+print([300].map(nested)[0]);
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'nested'
+// CHECK: 13500
+
+// Exceptions thrown after the transfer are caught in the caller.
+function thrower(n) {
+  for (var i = 0; i < n; ++i) {
+    if (i === 500)
+      throw new Error('thrown at ' + i);
+  }
+}
+try {
+  thrower(1000);
+} catch (e) {
+  print(e.message);
+}
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'thrower'
+// CHECK: thrown at 500
+
+// Exceptions thrown after the transfer are caught in the function itself.
+function catcher(n) {
+  var s = 0;
+  for (var i = 0; i < n; ++i) {
+    try {
+      if (i % 100 === 0)
+        throw i;
+      s += 1;
+    } catch (e) {
+      s += e;
+    }
+  }
+  return s;
+}
+print(catcher(1000));
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'catcher'
+// CHECK: 5490
+
+// Every function above was entered in the middle of its loop.
+print(HermesInternal.getInstrumentedStats().js_jitNumOSREntries);
+// CHECK: 4
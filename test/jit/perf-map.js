@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: cd %t && %hermes -fno-inline -Xforce-jit -Xjit-perf-map=jitdump %s | %FileCheck --match-full-lines %s
+// RUN: cat %t/jit-*.dump | grep -a -o "JS:foo [^[:cntrl:]]*" | %FileCheck --check-prefix=DUMP %s
+// REQUIRES: jit, linux
+
+function foo(x) {
+  return x + 1;
+}
+
+var sum = 0;
+for (var i = 0; i < 10; ++i)
+  sum = foo(sum);
+print(sum);
+
+// CHECK: 10
+// DUMP: JS:foo {{.*}}perf-map.js:13:1
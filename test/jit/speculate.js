@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -fno-inline -Xjit -Xjit-threshold=10 -Xjit-speculate -Xjit-crash-on-error -Xdump-jitcode=2 %s | %FileCheck --match-full-lines %s
+// REQUIRES: jit
+
+// Arithmetic that has only seen numbers is compiled without a generic slow
+// path, and deoptimizes to the interpreter when that no longer holds.
+
+function add(a, b) {
+  return a + b;
+}
+for (var i = 0; i < 100; ++i)
+  add(i, 1);
+print(add('a', 'b'));
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'add'
+// CHECK: JIT deoptimized FunctionID {{[0-9]+}}, 'add'
+// CHECK-NEXT: ab
+
+// The function is recompiled with the updated feedback and doesn't
+// deoptimize anymore.
+var s = '';
+for (var i = 0; i < 100; ++i)
+  s = add(i % 2 ? 'x' : 1, 1);
+print(s);
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'add'
+// CHECK-NOT: JIT deoptimized
+// CHECK: x1
+
+// Exceptions thrown after deoptimizing are caught in the function itself.
+function guarded(a, b) {
+  try {
+    return a * b;
+  } catch (e) {
+    return 'caught ' + e;
+  }
+}
+for (var i = 0; i < 100; ++i)
+  guarded(i, 2);
+print(guarded({valueOf() { throw 'boom'; }}, 2));
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'guarded'
+// CHECK: JIT deoptimized FunctionID {{[0-9]+}}, 'guarded'
+// CHECK-NEXT: caught boom
+
+// Exceptions thrown after deoptimizing are caught in the caller.
+function escaper(a) {
+  return a - 1;
+}
+for (var i = 0; i < 100; ++i)
+  escaper(i);
+try {
+  escaper({valueOf() { throw 'escaped'; }});
+} catch (e) {
+  print(e);
+}
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'escaper'
+// CHECK: JIT deoptimized FunctionID {{[0-9]+}}, 'escaper'
+// CHECK-NEXT: escaped
+
+// Deoptimize in the middle of a loop, with live values in the frame. The rest
+// of the loop may be transferred back to native code.
+function loop(n, x) {
+  var s = 0;
+  for (var i = 0; i < n; ++i)
+    s = s + x;
+  return s;
+}
+for (var i = 0; i < 100; ++i)
+  loop(10, 1);
+print(loop(3, 'z'));
+// CHECK: JIT successfully compiled FunctionID {{[0-9]+}}, 'loop'
+// CHECK: JIT deoptimized FunctionID {{[0-9]+}}, 'loop'
+// CHECK: 0zzz
@@ -90,7 +90,11 @@ static int executeHBCBytecodeFromCL(
                                   .build())
           .withShouldReleaseUnused(vm::kReleaseUnusedNone)
           .withAllocInYoung(flags.GCAllocYoung)
-          .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI);
+          .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI)
+          .withNumMarkThreads(flags.GCMarkThreads)
+          .withNumEvacuationThreads(flags.GCEvacuationThreads)
+          .withAllocationSitePretenuring(flags.GCPretenure)
+          .withTargetMaxPauseMs(flags.GCTargetMaxPause);
 
   std::vector<vm::GCAnalyticsEvent> gcAnalyticsEvents;
   if (flags.GCPrintStats || flags.GCBeforeStats ||
@@ -110,6 +114,8 @@ static int executeHBCBytecodeFromCL(
           .withGCConfig(gcConfigBuilder.build())
           .withMaxNumRegisters(flags.MaxNumRegisters)
           .withEnableJIT(flags.DumpJITCode || flags.EnableJIT || flags.ForceJIT)
+          .withJITPerfMap(flags.JITPerfMap)
+          .withJITCodeCacheDir(flags.JITCodeCacheDir)
           .withEnableEval(cl::EnableEval)
           .withVerifyEvalIR(cl::VerifyIR)
           .withOptimizedEval(cl::OptimizedEval)
@@ -135,7 +141,10 @@ static int executeHBCBytecodeFromCL(
   options.timeLimit = flags.ExecutionTimeLimit;
   options.forceJIT = flags.ForceJIT;
   options.jitThreshold = flags.JITThreshold;
+  options.jitOSRThreshold = flags.JITOSRThreshold;
   options.jitMemoryLimit = flags.JITMemoryLimit;
+  options.jitAsync = flags.JITAsync;
+  options.jitSpeculate = flags.JITSpeculate;
   options.dumpJITCode = flags.DumpJITCode;
   options.jitCrashOnError = flags.JITCrashOnError;
   options.jitEmitAsserts = flags.JITEmitAsserts;
@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Keeps the most recently allocated objects alive in a ring, so that most of
+// them survive a young gen collection and get promoted before they die. The
+// objects have several different sizes, to exercise old gen allocation.
+// Run with -gc-print-stats to see how long the young gen collections take.
+
+var ring = new Array(200000);
+
+function makeObj(i) {
+    switch (i & 3) {
+        case 0:
+            return {a: i};
+        case 1:
+            return {a: i, b: i, c: i, d: i, e: i, f: i, g: i, h: i};
+        case 2:
+            return [i, i, i, i];
+        default:
+            return 'str' + i;
+    }
+}
+
+function promote(n) {
+    var pos = 0;
+    for (var i = 0; i < n; i++) {
+        ring[pos] = makeObj(i);
+        if (++pos === ring.length)
+            pos = 0;
+    }
+    return pos;
+}
+
+print(promote(10000000));
@@ -9,7 +9,9 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <deque>
+#include <thread>
 
 namespace {
 
@@ -137,4 +139,47 @@ TYPED_TEST(BitArrayTest, PrevZeroBit) {
   }
 }
 
+
+TYPED_TEST(BitArrayTest, AtomicTestAndSet) {
+  constexpr size_t N = TypeParam::value;
+  BitArray<N> ba;
+  auto testIndices = this->getTestIndices();
+  for (auto &indices : testIndices) {
+    ba.reset();
+    for (size_t idx : indices) {
+      EXPECT_FALSE(ba.atomicTestAndSet(idx));
+      EXPECT_TRUE(ba.atomicTestAndSet(idx));
+      EXPECT_TRUE(ba.at(idx));
+    }
+    for (size_t from = ba.findNextSetBitFrom(0); from < N;
+         from = ba.findNextSetBitFrom(from + 1)) {
+      EXPECT_EQ(indices.front(), from);
+      indices.pop_front();
+    }
+    EXPECT_EQ(0, indices.size());
+  }
+}
+
+TYPED_TEST(BitArrayTest, AtomicTestAndSetConcurrent) {
+  constexpr size_t N = TypeParam::value;
+  BitArray<N> ba;
+  // Threads set interleaved bits, so they all write to the same words, and
+  // also race on a shared bit that only one of them may see as unset.
+  constexpr unsigned kNumThreads = 4;
+  std::atomic<unsigned> numFirst{0};
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&ba, &numFirst, t] {
+      for (size_t idx = t; idx < N - 1; idx += kNumThreads)
+        ba.atomicTestAndSet(idx);
+      if (!ba.atomicTestAndSet(N - 1))
+        ++numFirst;
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  EXPECT_EQ(1u, numFirst.load());
+  EXPECT_EQ(N, ba.findNextZeroBitFrom(0));
+}
+
 } // namespace
@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <new>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -396,4 +397,94 @@ TEST(GCBasicsTestNCGen, TestIDPersistsAcrossMultipleCollections) {
 }
 #endif
 
+#ifdef HERMESVM_GC_HADES
+/// An idle notification collects the YG once it is at least half full, and
+/// only if a YG collection fits in the idle time.
+TEST(GCBasicsTestNCGen, NotifyIdleCollectsYoungGen) {
+  const GCConfig kGCConfig =
+      TestGCConfigFixedSize(FixedSizeHeapSegment::maxSize() * 10);
+  auto runtime = DummyRuntime::create(kGCConfig);
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.getHeap();
+  using EighthCell = EmptyCell<FixedSizeHeapSegment::maxSize() / 8>;
+  auto numCollections = [&gc]() {
+    GC::HeapInfo info;
+    gc.getHeapInfo(info);
+    return info.numCollections;
+  };
+
+  const unsigned initial = numCollections();
+  EighthCell::create(rt);
+  gc.notifyIdle(std::chrono::milliseconds(1000));
+  EXPECT_EQ(initial, numCollections());
+
+  // The first YG spans a whole segment.
+  for (int i = 0; i < 6; ++i)
+    EighthCell::create(rt);
+  gc.notifyIdle(std::chrono::milliseconds(1000));
+  EXPECT_EQ(initial + 1, numCollections());
+
+  // After a quick collection, the YG is a bit more than half a segment.
+  for (int i = 0; i < 3; ++i)
+    EighthCell::create(rt);
+  gc.notifyIdle(std::chrono::milliseconds(0));
+  EXPECT_EQ(initial + 1, numCollections());
+}
+
+/// An OG allocation during the sweep phase sweeps the segments holding garbage
+/// on the mutator instead of growing the heap. When the mutator sweeps the
+/// last segment, the collection is still finished normally.
+TEST(GCBasicsTestNCGen, AllocLongLivedDuringSweep) {
+  const GCConfig kGCConfig =
+      TestGCConfigFixedSize(FixedSizeHeapSegment::maxSize() * 16);
+  auto runtime = DummyRuntime::create(kGCConfig);
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.getHeap();
+  using EighthCell = EmptyCell<FixedSizeHeapSegment::maxSize() / 8>;
+  GCScope scope{rt};
+
+  // Fill a few OG segments with garbage. Every segment ends with free space
+  // that is too small for another cell.
+  constexpr size_t kNumGarbage = 4 * 7;
+  for (size_t i = 0; i < kNumGarbage; ++i)
+    EighthCell::createLongLived(rt);
+
+  size_t numAllocated = 0;
+  gc.whileSweepingForTest([&]() {
+    GC::HeapInfo before;
+    gc.getHeapInfo(before);
+    EXPECT_TRUE(gc.isSweepingForTest());
+    EXPECT_LT(0u, gc.sweepSegmentsRemainingForTest());
+    // Nothing has been swept yet, so every allocation must sweep until it
+    // finds the space of some garbage. Keep allocating until the mutator has
+    // swept every segment.
+    while (gc.sweepSegmentsRemainingForTest()) {
+      rt.makeHandle(EighthCell::createLongLived(rt));
+      ++numAllocated;
+    }
+    GC::HeapInfo after;
+    gc.getHeapInfo(after);
+    EXPECT_EQ(before.heapSize, after.heapSize);
+    // The background thread has not had a chance to finish the collection.
+    EXPECT_TRUE(gc.isSweepingForTest());
+  });
+
+  // The background thread finds nothing left to sweep and ends the
+  // collection. In incremental mode the next YG collection does it instead.
+  if (kConcurrentGC) {
+    while (gc.isSweepingForTest())
+      std::this_thread::yield();
+  } else {
+    rt.collect();
+  }
+  EXPECT_FALSE(gc.isSweepingForTest());
+
+  // The cells allocated during the sweep survive the next collection.
+  rt.collect();
+  GC::HeapInfo info;
+  gc.getHeapInfo(info);
+  EXPECT_LE(numAllocated * EighthCell::size(), info.allocatedBytes);
+}
+#endif
+
 } // namespace
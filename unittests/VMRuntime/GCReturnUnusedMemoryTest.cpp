@@ -70,6 +70,68 @@ TEST(GCReturnUnusedMemoryTest, CollectReturnsFreeMemory) {
 #endif // _WINDOWS
 }
 
+TEST(GCReturnUnusedMemoryTest, CompactReturnsSparseSegments) {
+  auto runtime = DummyRuntime::create(TestGCConfigFixedSize(64 << 20));
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.getHeap();
+
+  using TenthCell = EmptyCell<FixedSizeHeapSegment::maxSize() / 10>;
+
+  GCScope scope{rt};
+  // Spread the surviving cells over several segments, leaving each of them
+  // mostly empty.
+  std::vector<Handle<TenthCell>> kept;
+  for (size_t i = 0; i < 30; ++i) {
+    TenthCell *cell = TenthCell::createLongLived(rt);
+    if (i % 10 == 0)
+      kept.push_back(rt.makeHandle(cell));
+  }
+  rt.collect();
+  GCBase::HeapInfo before;
+  gc.getHeapInfo(before);
+
+  gc.compact("test", 0.5);
+  GCBase::HeapInfo compacted;
+  gc.getHeapInfo(compacted);
+  // The surviving cells fit in a single OG segment, next to the YG.
+  EXPECT_LT(compacted.heapSize, before.heapSize);
+  EXPECT_EQ(2 * FixedSizeHeapSegment::storageSize(), compacted.heapSize);
+  EXPECT_EQ(before.allocatedBytes, compacted.allocatedBytes);
+  for (Handle<TenthCell> cell : kept)
+    EXPECT_EQ(heapAlignSize(TenthCell::size()), cell->getAllocatedSize());
+}
+
+TEST(GCReturnUnusedMemoryTest, MemoryPressureReleasesEmptySegments) {
+  auto runtime = DummyRuntime::create(TestGCConfigFixedSize(64 << 20));
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.getHeap();
+
+  using TenthCell = EmptyCell<FixedSizeHeapSegment::maxSize() / 10>;
+
+  GCScope scope{rt};
+  // Grow the OG to several segments, then make all of it garbage.
+  for (size_t i = 0; i < 30; ++i)
+    TenthCell::createLongLived(rt);
+  rt.collect();
+  GCBase::HeapInfo before;
+  gc.getHeapInfo(before);
+
+  gc.setMemoryPressure(0.6);
+  GCBase::HeapInfo released;
+  gc.getHeapInfo(released);
+  // Only the YG is left.
+  EXPECT_LT(released.heapSize, before.heapSize);
+  EXPECT_EQ(FixedSizeHeapSegment::storageSize(), released.heapSize);
+
+  // Without pressure, the OG can grow back.
+  gc.setMemoryPressure(0);
+  for (size_t i = 0; i < 30; ++i)
+    rt.makeHandle(TenthCell::createLongLived(rt));
+  GCBase::HeapInfo grown;
+  gc.getHeapInfo(grown);
+  EXPECT_GT(grown.heapSize, released.heapSize);
+}
+
 } // namespace
 
 #endif
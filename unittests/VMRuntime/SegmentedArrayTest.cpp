@@ -8,6 +8,7 @@
 #include "hermes/VM/SegmentedArray.h"
 #include "hermes/VM/Casting.h"
 #include "hermes/VM/HermesValueTraits.h"
+#include "hermes/VM/StringPrimitive.h"
 
 #include "VMRuntimeTestHelpers.h"
 
@@ -76,4 +77,66 @@ TEST_F(SegmentedArrayTest, AllowTrimming) {
   EXPECT_EQ(array->size(runtime), array->capacity());
 }
 
+#ifdef HERMESVM_GC_HADES
+TEST_F(SegmentedArrayTest, SetWithBarrierIfNeeded) {
+  // Overwriting a string or symbol with a number still needs the snapshot
+  // write barrier while the OG is being marked: the old value may only be
+  // reachable from somewhere the marker doesn't look at again, like a handle
+  // created after the roots were marked.
+  constexpr SegmentedArray::size_type kSize = 100;
+  MutableHandle<SegmentedArray> array{runtime};
+  array = std::move(*SegmentedArray::create(runtime, kSize));
+
+  MutableHandle<StringPrimitive> str{runtime};
+  MutableHandle<> val{runtime};
+  for (SegmentedArray::size_type i = 0; i < kSize; i++) {
+    GCScopeMarkerRAII marker{runtime};
+    std::string name = std::to_string(i);
+    auto strRes =
+        StringPrimitive::create(runtime, createASCIIRef(name.c_str()));
+    ASSERT_FALSE(isException(strRes));
+    str = vmcast<StringPrimitive>(*strRes);
+    // Alternate between strings and symbols, which both need the barrier.
+    if (i % 2) {
+      auto symbolRes =
+          runtime.getIdentifierTable().createNotUniquedSymbol(runtime, str);
+      ASSERT_FALSE(isException(symbolRes));
+      val = HermesValue::encodeSymbolValue(*symbolRes);
+    } else {
+      val = str.getHermesValue();
+    }
+    ASSERT_RETURNED(SegmentedArray::push_back(array, runtime, val));
+  }
+  // Move everything to OG.
+  runtime.collect("test");
+
+  // Move every value into a handle and overwrite its element with a number.
+  std::vector<Handle<>> moved;
+  runtime.getHeap().whileMarkingForTest([&]() {
+    for (SegmentedArray::size_type i = 0; i < kSize; i++) {
+      moved.push_back(runtime.makeHandle(array->at(runtime, i)));
+      array->setWithBarrierIfNeeded(
+          runtime, i, HermesValue::encodeTrustedNumberValue(i));
+    }
+  });
+
+  // Reuse any memory that the collection wrongly freed.
+  for (SegmentedArray::size_type i = 0; i < kSize; i++) {
+    GCScopeMarkerRAII marker{runtime};
+    ASSERT_FALSE(
+        isException(StringPrimitive::create(runtime, createASCIIRef("xx"))));
+  }
+
+  for (SegmentedArray::size_type i = 0; i < kSize; i++) {
+    std::string name = std::to_string(i);
+    const StringPrimitive *value = i % 2
+        ? runtime.getIdentifierTable().getStringPrim(
+              runtime, moved[i]->getSymbol())
+        : moved[i]->getString();
+    EXPECT_TRUE(value->equals(StringView(name.c_str())));
+    EXPECT_EQ(i, array->at(runtime, i).getNumber());
+  }
+}
+#endif
+
 } // namespace